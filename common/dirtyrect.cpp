@@ -0,0 +1,164 @@
+#include "dirtyrect.h"
+#include <stdlib.h>
+#include <string.h>
+
+DirtyRectClass::DirtyRectClass(void)
+    : Width(0)
+    , Height(0)
+    , Shadow(nullptr)
+    , Left(nullptr)
+    , Right(nullptr)
+    , Count(0)
+    , Area(0)
+    , IsFull(true)
+    , IsTouched(false)
+{
+}
+
+DirtyRectClass::~DirtyRectClass(void)
+{
+    Free();
+}
+
+bool DirtyRectClass::Init(int width, int height)
+{
+    Free();
+
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+
+    Shadow = (unsigned char*)malloc((size_t)width * height);
+    Left = (int*)malloc(height * sizeof(int));
+    Right = (int*)malloc(height * sizeof(int));
+
+    if (Shadow == nullptr || Left == nullptr || Right == nullptr) {
+        Free();
+        return false;
+    }
+
+    Width = width;
+    Height = height;
+
+    for (int y = 0; y < Height; y++) {
+        Left[y] = Width;
+        Right[y] = -1;
+    }
+
+    /*
+    **	Nothing has been presented yet, so the first Find must give the whole surface.
+    */
+    IsFull = true;
+    IsTouched = false;
+    return true;
+}
+
+void DirtyRectClass::Free(void)
+{
+    free(Shadow);
+    free(Left);
+    free(Right);
+    Shadow = nullptr;
+    Left = nullptr;
+    Right = nullptr;
+    Width = 0;
+    Height = 0;
+    Count = 0;
+    Area = 0;
+}
+
+void DirtyRectClass::Mark(int y, int left, int right)
+{
+    if (left < Left[y]) {
+        Left[y] = left;
+    }
+    if (right > Right[y]) {
+        Right[y] = right;
+    }
+}
+
+void DirtyRectClass::Add(Rect const& rect)
+{
+    int x1 = rect.X < 0 ? 0 : rect.X;
+    int y1 = rect.Y < 0 ? 0 : rect.Y;
+    int x2 = rect.X + rect.Width < Width ? rect.X + rect.Width : Width;
+    int y2 = rect.Y + rect.Height < Height ? rect.Y + rect.Height : Height;
+
+    for (int y = y1; y < y2 && x1 < x2; y++) {
+        Mark(y, x1, x2 - 1);
+    }
+}
+
+int DirtyRectClass::Find(unsigned char const* pixels, int pitch)
+{
+    Count = 0;
+    Area = 0;
+
+    if (Shadow == nullptr) {
+        return (0);
+    }
+
+    if (IsFull) {
+        for (int y = 0; y < Height; y++) {
+            memcpy(Shadow + y * Width, pixels + y * pitch, Width);
+            Left[y] = Width;
+            Right[y] = -1;
+        }
+
+        Rects[0] = Rect(0, 0, Width, Height);
+        Count = 1;
+        Area = Width * Height;
+        IsFull = false;
+        IsTouched = false;
+        return (Count);
+    }
+
+    if (IsTouched) {
+        for (int y = 0; y < Height; y++) {
+            unsigned char const* src = pixels + y * pitch;
+            unsigned char const* shadow = Shadow + y * Width;
+
+            if (memcmp(src, shadow, Width) != 0) {
+                int left = 0;
+                int right = Width - 1;
+
+                while (src[left] == shadow[left]) {
+                    left++;
+                }
+                while (src[right] == shadow[right]) {
+                    right--;
+                }
+                Mark(y, left, right);
+            }
+        }
+        IsTouched = false;
+    }
+
+    for (int y = 0; y < Height; y++) {
+        if (Left[y] > Right[y]) {
+            continue;
+        }
+
+        memcpy(Shadow + y * Width + Left[y], pixels + y * pitch + Left[y], Right[y] - Left[y] + 1);
+
+        Rect* last = (Count > 0) ? &Rects[Count - 1] : nullptr;
+
+        if (last != nullptr && (y - (last->Y + last->Height) <= MERGE_GAP || Count == MAX_RECTS)) {
+            int x1 = Left[y] < last->X ? Left[y] : last->X;
+            int x2 = Right[y] + 1 > last->X + last->Width ? Right[y] + 1 : last->X + last->Width;
+            last->X = x1;
+            last->Width = x2 - x1;
+            last->Height = y + 1 - last->Y;
+        } else {
+            Rects[Count++] = Rect(Left[y], y, Right[y] + 1 - Left[y], 1);
+        }
+
+        Left[y] = Width;
+        Right[y] = -1;
+    }
+
+    for (int index = 0; index < Count; index++) {
+        Area += Rects[index].Size();
+    }
+    return (Count);
+}
@@ -0,0 +1,89 @@
+#ifndef DIRTYRECT_H
+#define DIRTYRECT_H
+
+#include "rect.h"
+
+/*
+**	Works out which parts of an 8 bit surface changed since it was last presented, so that
+**	only those need converting and uploading. The game draws to the visible page through a
+**	lock rather than through calls the surface can see, so after Touch() the surface is
+**	compared row by row against a copy of what was presented last. Rects the surface does
+**	know about (blits, fills, the software cursor) can be added directly, and Add_All()
+**	forces a full refresh, as a palette change needs.
+**
+**	Changed rows close to each other are merged, so a frame normally comes out as a handful
+**	of rects; there are never more than MAX_RECTS.
+*/
+class DirtyRectClass
+{
+public:
+    enum
+    {
+        MAX_RECTS = 16,
+        MERGE_GAP = 8 // Rows that can lie unchanged between two changed ones that are merged.
+    };
+
+    DirtyRectClass(void);
+    ~DirtyRectClass(void);
+
+    bool Init(int width, int height);
+    void Free(void);
+
+    void Add(Rect const& rect);
+    void Add_All(void)
+    {
+        IsFull = true;
+    }
+    void Touch(void)
+    {
+        IsTouched = true;
+    }
+
+    /*
+    **	Finds the rects that changed since the last call and brings the copy up to date. The
+    **	rects are then read with Get_Rect.
+    */
+    int Find(unsigned char const* pixels, int pitch);
+
+    Rect const& Get_Rect(int index) const
+    {
+        return (Rects[index]);
+    }
+
+    int Get_Count(void) const
+    {
+        return (Count);
+    }
+
+    /*
+    **	The number of pixels in the rects from the last Find.
+    */
+    int Get_Area(void) const
+    {
+        return (Area);
+    }
+
+private:
+    void Mark(int y, int left, int right);
+
+    int Width;
+    int Height;
+    unsigned char* Shadow;
+
+    /*
+    **	The changed span of each row; Left is greater than Right for a row that is unchanged.
+    */
+    int* Left;
+    int* Right;
+
+    Rect Rects[MAX_RECTS];
+    int Count;
+    int Area;
+    bool IsFull;
+    bool IsTouched;
+
+    DirtyRectClass(DirtyRectClass const&);
+    DirtyRectClass& operator=(DirtyRectClass const&);
+};
+
+#endif /* DIRTYRECT_H */
@@ -1,7 +1,10 @@
 #include "framelimit.h"
+#include "framepace.h"
 #include "wwmouse.h"
 #include "settings.h"
+#include "debugstring.h"
 #include <chrono>
+#include <string.h>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -14,46 +17,210 @@ extern WWMouseClass* WWMouse;
 #ifdef SDL_BUILD
 void Video_Render_Frame();
 #endif
+#ifdef SDL2_BUILD
+FrameStatsType Video_Present_Stats(bool reset);
+#endif
+
+static FramePacerClass Pacer;
+static FrameStatsClass GameStats;
+static FrameStatsClass RenderStats;
+static FrameHistogramClass Histograms[FH_COUNT];
+static bool OverlayVisible = false;
+
+void Get_Frame_Stats(FrameStatsType& game, FrameStatsType& render, FrameStatsType& present, bool reset)
+{
+    game = GameStats.Get(reset);
+    render = RenderStats.Get(reset);
+#ifdef SDL2_BUILD
+    present = Video_Present_Stats(reset);
+#else
+    present = FrameStatsType();
+#endif
+}
+
+FrameHistogramClass const& Get_Frame_Histogram(FrameHistogramEnum which)
+{
+    return Histograms[which];
+}
+
+void Dump_Frame_Histograms()
+{
+    enum
+    {
+        DUMP_BAR_WIDTH = 40
+    };
+
+    static char const* const names[FH_COUNT] = {"frame", "logic", "render"};
+
+    DBG_INFO("Frame times over the last %d frames, frame limit %d:",
+             Histograms[FH_FRAME].Get_Frames(),
+             Pacer.Get_Rate());
+
+    for (int which = 0; which < FH_COUNT; which++) {
+        FrameHistogramClass const& histogram = Histograms[which];
+        int fullest = 0;
+
+        for (int bucket = 0; bucket < FrameHistogramClass::BUCKETS; bucket++) {
+            if (histogram.Get_Count(bucket) > fullest) {
+                fullest = histogram.Get_Count(bucket);
+            }
+        }
+
+        DBG_INFO("  %s: 50%% %d us, 90%% %d us, 99%% %d us, worst %d us",
+                 names[which],
+                 histogram.Get_Percentile(50),
+                 histogram.Get_Percentile(90),
+                 histogram.Get_Percentile(99),
+                 histogram.Get_Worst());
+
+        for (int bucket = 0; bucket < FrameHistogramClass::BUCKETS; bucket++) {
+            int count = histogram.Get_Count(bucket);
+            char bar[DUMP_BAR_WIDTH + 1];
+
+            if (count == 0) {
+                continue;
+            }
+
+            int length = count * DUMP_BAR_WIDTH / fullest;
+            length = length > 0 ? length : 1;
+            memset(bar, '#', length);
+            bar[length] = '\0';
+
+            DBG_INFO("    %5.1f ms%c %4d %s",
+                     bucket * FrameHistogramClass::BUCKET_WIDTH / 1000.0f,
+                     bucket == FrameHistogramClass::BUCKETS - 1 ? '+' : ' ',
+                     count,
+                     bar);
+        }
+    }
+}
+
+void Toggle_Frame_Overlay()
+{
+    OverlayVisible = !OverlayVisible;
+}
+
+void Get_Frame_Overlay(FrameOverlayType& overlay)
+{
+    overlay.Visible = OverlayVisible;
+    if (!OverlayVisible) {
+        return;
+    }
+
+    overlay.Target = -1;
+    if (Pacer.Get_Rate() > 0) {
+        int period = int(std::chrono::duration_cast<std::chrono::microseconds>(Pacer.Get_Period()).count());
+        if (period / FrameHistogramClass::BUCKET_WIDTH < FrameHistogramClass::BUCKETS) {
+            overlay.Target = period / FrameHistogramClass::BUCKET_WIDTH;
+        }
+    }
+
+    for (int which = 0; which < FH_COUNT; which++) {
+        FrameHistogramClass const& histogram = Histograms[which];
+        int fullest = 1;
+
+        for (int bucket = 0; bucket < FrameHistogramClass::BUCKETS; bucket++) {
+            if (histogram.Get_Count(bucket) > fullest) {
+                fullest = histogram.Get_Count(bucket);
+            }
+        }
+
+        for (int bucket = 0; bucket < FrameHistogramClass::BUCKETS; bucket++) {
+            overlay.Bars[which][bucket] = (unsigned char)(histogram.Get_Count(bucket) * 255 / fullest);
+        }
+    }
+}
+
+/*
+** Notes the times of a frame, and every so often logs how both the game thread and the
+** presentation are keeping up.
+*/
+static void Measure_Frame(std::chrono::steady_clock::time_point start,
+                          std::chrono::steady_clock::duration logic,
+                          std::chrono::steady_clock::duration render)
+{
+    enum
+    {
+        FRAME_STATS_LOG_RATE = 600
+    };
+
+    static auto last_start = start;
+    static int frames = 0;
+
+    auto interval = std::chrono::duration_cast<std::chrono::microseconds>(start - last_start).count();
+    auto logic_time = std::chrono::duration_cast<std::chrono::microseconds>(logic).count();
+    auto render_time = std::chrono::duration_cast<std::chrono::microseconds>(render).count();
+    last_start = start;
+
+    GameStats.Add(interval);
+    RenderStats.Add(render_time);
+    Histograms[FH_FRAME].Add(interval);
+    Histograms[FH_LOGIC].Add(logic_time);
+    Histograms[FH_RENDER].Add(render_time);
+
+    if (++frames == FRAME_STATS_LOG_RATE) {
+        FrameStatsType game, render, present;
+
+        Get_Frame_Stats(game, render, present, true);
+        DBG_INFO("Frame_Limiter: game %d us per frame (worst %d), render %d us (worst %d), present %d us (worst %d), "
+                 "%d of %d frames dropped.",
+                 game.Average,
+                 game.Worst,
+                 render.Average,
+                 render.Worst,
+                 present.Average,
+                 present.Worst,
+                 present.Dropped,
+                 render.Frames);
+        frames = 0;
+    }
+}
 
 void Frame_Limiter(FrameLimitFlags flags)
 {
-    static auto frame_start = std::chrono::steady_clock::now();
-#ifdef SDL_BUILD
-    static auto render_avg = 0;
+    static auto last_return = std::chrono::steady_clock::now();
+    static auto logic = std::chrono::steady_clock::duration::zero();
 
-    auto render_start = std::chrono::steady_clock::now();
-    auto render_remaining = std::chrono::duration_cast<std::chrono::milliseconds>(frame_start - render_start).count();
+    auto now = std::chrono::steady_clock::now();
 
-    if (!(flags & FrameLimitFlags::FL_FORCE_RENDER) && render_remaining > render_avg) {
+    /*
+    ** Time spent in the game between calls adds up to the logic time of the next frame.
+    */
+    logic += now - last_return;
+    Pacer.Set_Rate(Settings.Video.FrameLimit);
+
+#ifdef SDL_BUILD
+    /*
+    ** Without FL_FORCE_RENDER a frame is only rendered once it is due. Until then the caller
+    ** gets to carry on with input and comes back; wait for the frame to be due, or with
+    ** FL_NO_BLOCK just yield.
+    */
+    if (!(flags & FrameLimitFlags::FL_FORCE_RENDER) && !Pacer.Is_Due(now)) {
         if (!(flags & FrameLimitFlags::FL_NO_BLOCK)) {
-            ms_sleep(unsigned(render_remaining));
+            FramePacerClass::Sleep_Until(Pacer.Get_Deadline());
         } else {
             ms_sleep(1); // Unconditionally yield for minimum time.
         }
+        last_return = std::chrono::steady_clock::now();
         return;
     }
+#endif
 
-    Video_Render_Frame();
-
-    auto render_end = std::chrono::steady_clock::now();
-    auto render_time = std::chrono::duration_cast<std::chrono::milliseconds>(render_end - render_start).count();
+    if (!(flags & FrameLimitFlags::FL_NO_BLOCK)) {
+        FramePacerClass::Sleep_Until(Pacer.Get_Deadline());
+    }
 
-    // keep up some average so we have an idea if we need to skip a frame or not
-    render_avg = (render_avg + render_time) / 2;
-#endif
+    auto frame_start = std::chrono::steady_clock::now();
 
-    if (Settings.Video.FrameLimit > 0 && !(flags & FrameLimitFlags::FL_NO_BLOCK)) {
 #ifdef SDL_BUILD
-        auto frame_end = render_end;
-#else
-        auto frame_end = std::chrono::steady_clock::now();
+    Video_Render_Frame();
 #endif
-        int64_t _ms_per_tick = 1000 / Settings.Video.FrameLimit;
-        auto remaining =
-            _ms_per_tick - std::chrono::duration_cast<std::chrono::milliseconds>(frame_end - frame_start).count();
-        if (remaining > 0) {
-            ms_sleep(unsigned(remaining));
-        }
-        frame_start = std::chrono::steady_clock::now();
-    }
+
+    auto frame_end = std::chrono::steady_clock::now();
+
+    Pacer.Next_Frame(frame_start);
+    Measure_Frame(frame_start, logic, frame_end - frame_start);
+
+    logic = std::chrono::steady_clock::duration::zero();
+    last_return = frame_end;
 }
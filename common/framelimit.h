@@ -1,6 +1,8 @@
 #ifndef FRAMELIMIT_H
 #define FRAMELIMIT_H
 
+#include "framestats.h"
+
 enum FrameLimitFlags
 {
     FL_NONE = 0,
@@ -10,4 +12,42 @@ enum FrameLimitFlags
 
 void Frame_Limiter(FrameLimitFlags flags = FL_FORCE_RENDER);
 
+/*
+** Frame times since the last reset: game is the time between frames on the game thread, render
+** the part of it spent handing the frame to the video backend, and present the time taken to
+** convert and present a frame, which is done on a thread of its own when RenderThread is set.
+*/
+void Get_Frame_Stats(FrameStatsType& game, FrameStatsType& render, FrameStatsType& present, bool reset = false);
+
+enum FrameHistogramEnum
+{
+    FH_FRAME,
+    FH_LOGIC,
+    FH_RENDER,
+    FH_COUNT
+};
+
+/*
+** Rolling histograms of the time from one frame to the next, the part of it spent in the game
+** rather than in the frame limiter, and the part spent rendering. Dump_Frame_Histograms writes
+** them to the log.
+*/
+FrameHistogramClass const& Get_Frame_Histogram(FrameHistogramEnum which);
+void Dump_Frame_Histograms();
+
+/*
+** What the video backend needs to draw the histograms over the screen: the height of every bar
+** out of 255, against the fullest bucket of its histogram, and the bucket the frame limit falls
+** in, or -1 if there is no limit or it is off the end.
+*/
+struct FrameOverlayType
+{
+    bool Visible;
+    int Target;
+    unsigned char Bars[FH_COUNT][FrameHistogramClass::BUCKETS];
+};
+
+void Toggle_Frame_Overlay();
+void Get_Frame_Overlay(FrameOverlayType& overlay);
+
 #endif /* FRAMELIMIT_H */
@@ -0,0 +1,96 @@
+#include "framepace.h"
+#include "mssleep.h"
+#include <thread>
+
+FramePacerClass::FramePacerClass(void)
+    : Rate(0)
+    , Period(ClockType::duration::zero())
+    , Deadline()
+{
+}
+
+void FramePacerClass::Set_Rate(int rate)
+{
+    if (rate == Rate) {
+        return;
+    }
+
+    Rate = rate > 0 ? rate : 0;
+    if (Rate > 0) {
+        Period = std::chrono::duration_cast<ClockType::duration>(std::chrono::nanoseconds(1000000000 / Rate));
+    } else {
+        Period = ClockType::duration::zero();
+    }
+}
+
+bool FramePacerClass::Is_Due(ClockType::time_point now) const
+{
+    return (Rate == 0 || now >= Deadline);
+}
+
+void FramePacerClass::Next_Frame(ClockType::time_point start)
+{
+    if (Rate == 0 || start - Deadline > Period) {
+        Deadline = start + Period;
+    } else {
+        Deadline += Period;
+    }
+}
+
+TickFractionClass::TickFractionClass(void)
+    : Ticks(0)
+    , Last()
+    , Interval(ClockType::duration::zero())
+{
+}
+
+void TickFractionClass::Tick(ClockType::time_point now)
+{
+    if (Ticks > 0) {
+        Interval = now - Last;
+    }
+    if (Ticks < 2) {
+        Ticks++;
+    }
+    Last = now;
+}
+
+void TickFractionClass::Reset(void)
+{
+    Ticks = 0;
+    Interval = ClockType::duration::zero();
+}
+
+int TickFractionClass::Get_Fraction(ClockType::time_point now) const
+{
+    if (Ticks < 2 || Interval <= ClockType::duration::zero()
+        || Interval > std::chrono::microseconds(MAX_INTERVAL_MICROSECONDS)) {
+        return (FRACTION_ONE);
+    }
+
+    auto elapsed = now - Last;
+    if (elapsed <= ClockType::duration::zero()) {
+        return (0);
+    }
+    if (elapsed >= Interval) {
+        return (FRACTION_ONE);
+    }
+    return ((int)(elapsed.count() * FRACTION_ONE / Interval.count()));
+}
+
+void FramePacerClass::Sleep_Until(ClockType::time_point when)
+{
+    for (;;) {
+        auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(when - ClockType::now()).count();
+
+        if (remaining <= 0) {
+            return;
+        }
+
+        if (remaining >= SPIN_MICROSECONDS + 1000) {
+            ms_sleep(unsigned((remaining - SPIN_MICROSECONDS) / 1000));
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}
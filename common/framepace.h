@@ -0,0 +1,94 @@
+#ifndef FRAMEPACE_H
+#define FRAMEPACE_H
+
+#include <chrono>
+
+/*
+**	Spaces frames evenly at a given rate. Deadlines are kept in steady_clock time and each one
+**	is the last plus the frame period, so that a frame started a little late is made up for by
+**	the next rather than pushing every later frame back. Only when it falls a whole frame
+**	behind, after a load for instance, does the pacer start again from the present.
+*/
+class FramePacerClass
+{
+public:
+    typedef std::chrono::steady_clock ClockType;
+
+    /*
+    **	Sleeping can overshoot by about a scheduler tick, so the last part of a wait is spent
+    **	yielding instead.
+    */
+    enum
+    {
+        SPIN_MICROSECONDS = 2000
+    };
+
+    FramePacerClass(void);
+
+    /*
+    **	Frames per second, or 0 for no limit.
+    */
+    void Set_Rate(int rate);
+    int Get_Rate(void) const
+    {
+        return Rate;
+    }
+    ClockType::duration Get_Period(void) const
+    {
+        return Period;
+    }
+
+    ClockType::time_point Get_Deadline(void) const
+    {
+        return Deadline;
+    }
+    bool Is_Due(ClockType::time_point now) const;
+
+    /*
+    **	Notes that a frame was started at the time given, and sets the deadline for the next.
+    */
+    void Next_Frame(ClockType::time_point start);
+
+    static void Sleep_Until(ClockType::time_point when);
+
+private:
+    int Rate;
+    ClockType::duration Period;
+    ClockType::time_point Deadline;
+};
+
+/*
+**	Tells how far the present time has got from the last simulation tick towards the next, out
+**	of FRACTION_ONE, so that a frame drawn between ticks can show objects part way along their
+**	moves. The next tick is expected as long after the last as that was after the one before.
+**	A gap longer than MAX_INTERVAL_MICROSECONDS, such as a pause or a dialog, is not taken as
+**	the tick rate and everything is shown where it is until the ticks settle again.
+*/
+class TickFractionClass
+{
+public:
+    typedef FramePacerClass::ClockType ClockType;
+
+    enum
+    {
+        FRACTION_ONE = 256,
+        MAX_INTERVAL_MICROSECONDS = 250000
+    };
+
+    TickFractionClass(void);
+
+    void Tick(ClockType::time_point now);
+    void Reset(void);
+
+    /*
+    **	From 0 just as a tick is taken, to FRACTION_ONE once the next is due or past due.
+    */
+    int Get_Fraction(ClockType::time_point now) const;
+
+private:
+    int Ticks;
+    ClockType::time_point Last;
+    ClockType::duration Interval;
+};
+
+#endif /* FRAMEPACE_H */
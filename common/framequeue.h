@@ -0,0 +1,386 @@
+#ifndef FRAMEQUEUE_H
+#define FRAMEQUEUE_H
+
+#include "queue.h"
+
+/*
+**	This is a QueueClass that also keeps every object it holds in an index by the frame the
+**	object is due on and by the house (key) it belongs to. The objects themselves are stored
+**	and removed exactly as in QueueClass; the index just lets a caller visit the objects that
+**	are due on a frame without scanning the whole line.
+**
+**	Objects not yet due sit in a ring of per-frame buckets. Advance() moves the buckets up to
+**	a frame into per-key "due" lists, which are kept in queue order. An object stays in its
+**	due list until it is retired or drops off the head of the line, so anything not handled
+**	on its frame is still found on later frames, just as a full scan would find it.
+**
+**	The object type must have unsigned "Frame" and "ID" members; ID values must be below
+**	'keys'. Both 'size' and 'frames' MUST be exact powers of two.
+*/
+template <class T, int size, int frames, int keys> class FrameQueueClass : public QueueClass<T, size>
+{
+public:
+    FrameQueueClass(void);
+
+    void Init(void);
+    int Next(void);
+    int Add(T const&);
+
+    /*
+    **	Brings every object due on or before the frame specified into the due lists.
+    */
+    void Advance(unsigned frame);
+
+    /*
+    **	Reschedules every object that is neither retired nor excluded by the filter, and whose
+    **	frame lies between 'from' and 'to' (exclusive), to the frame 'to'.
+    */
+    void Delay(unsigned from, unsigned to, int (*filter)(T const&));
+
+    /*
+    **	These walk the due list of a key in queue order. They return the internal slot of the
+    **	object, or -1 at the end of the list.
+    */
+    int First_Due(int key) const;
+    int Next_Due(int slot) const;
+
+    /*
+    **	Removes an object from the due lists once the caller is finished with it.
+    */
+    void Retire(int slot);
+
+    /*
+    **	Converts an internal slot into the index used by operator[].
+    */
+    int Position(int slot)
+    {
+        return ((slot - this->Get_Head()) & (size - 1));
+    }
+
+private:
+    enum
+    {
+        SLOT_NONE,
+        SLOT_BUCKET,
+        SLOT_DUE
+    };
+
+    void Place(int slot);
+    void Link_Due(int slot);
+    void Unlink(int slot);
+
+    /*
+    **	The frame that the due lists are current to.
+    */
+    unsigned Now;
+
+    /*
+    **	The most recent reschedule window and the number of objects added since it was applied.
+    */
+    unsigned DelayFrom;
+    unsigned DelayTo;
+    int Unchecked;
+
+    int Bucket[frames];
+    int DueHead[keys];
+    int DueTail[keys];
+
+    int Prev[size];
+    int Link[size];
+    char Where[size];
+};
+
+template <class T, int size, int frames, int keys>
+inline FrameQueueClass<T, size, frames, keys>::FrameQueueClass(void)
+{
+    Init();
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Init -- Initializes queue and its index to empty state.                    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys> inline void FrameQueueClass<T, size, frames, keys>::Init(void)
+{
+    QueueClass<T, size>::Init();
+
+    Now = 0;
+    DelayFrom = 0;
+    DelayTo = 0;
+    Unchecked = 0;
+    for (int index = 0; index < frames; index++) {
+        Bucket[index] = -1;
+    }
+    for (int index = 0; index < keys; index++) {
+        DueHead[index] = -1;
+        DueTail[index] = -1;
+    }
+    for (int index = 0; index < size; index++) {
+        Where[index] = SLOT_NONE;
+    }
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Add -- Add object to queue and index it.                                   *
+ *                                                                                             *
+ *    Objects due on or before the current frame go straight to the end of their due list,     *
+ *    since they are the newest in the line. The rest wait in the bucket for their frame.      *
+ *                                                                                             *
+ * INPUT:   object   -- The object that is to be added to the queue.                           *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the object added successfully?                                           *
+ *                                                                                             *
+ * WARNINGS:   If the queue is full, then the object won't be added.                           *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys>
+inline int FrameQueueClass<T, size, frames, keys>::Add(T const& q)
+{
+    int slot = this->Get_Tail();
+
+    if (!QueueClass<T, size>::Add(q)) {
+        return (false);
+    }
+
+    Place(slot);
+    Unchecked++;
+    return (true);
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Next -- Throws out the head of the line.                                   *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns the number of object remaining in the queue.                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys> inline int FrameQueueClass<T, size, frames, keys>::Next(void)
+{
+    if (this->Count) {
+        Unlink(this->Get_Head());
+    }
+
+    int count = QueueClass<T, size>::Next();
+    if (Unchecked > count) {
+        Unchecked = count;
+    }
+    return (count);
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Advance -- Brings the objects due on a frame into the due lists.           *
+ *                                                                                             *
+ *    Normally this only visits the buckets of the frames passed since the last call. If the   *
+ *    frame went backwards, or jumped further than the ring covers, the whole index is built   *
+ *    again from the queue.                                                                    *
+ *                                                                                             *
+ * INPUT:   frame -- The frame the caller is about to process.                                 *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys>
+inline void FrameQueueClass<T, size, frames, keys>::Advance(unsigned frame)
+{
+    T* array = this->Get_Array();
+
+    if (frame < Now || frame - Now >= (unsigned)frames) {
+        for (int index = 0; index < frames; index++) {
+            Bucket[index] = -1;
+        }
+        for (int index = 0; index < keys; index++) {
+            DueHead[index] = -1;
+            DueTail[index] = -1;
+        }
+        Now = frame;
+        for (int index = 0; index < this->Count; index++) {
+            int slot = (this->Get_Head() + index) & (size - 1);
+            Where[slot] = SLOT_NONE;
+            Place(slot);
+        }
+        return;
+    }
+
+    while (Now != frame) {
+        Now++;
+
+        /*
+        **	A bucket can also hold objects due a whole turn of the ring later; those stay.
+        */
+        int slot = Bucket[Now & (frames - 1)];
+        while (slot != -1) {
+            int next = Link[slot];
+            if (array[slot].Frame <= Now) {
+                Unlink(slot);
+                Link_Due(slot);
+            }
+            slot = next;
+        }
+    }
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Delay -- Reschedules the objects due within a window of frames.            *
+ *                                                                                             *
+ *    Applying the same window to the same object twice changes nothing, so only objects       *
+ *    added since the last call are examined, unless the window itself has changed.            *
+ *                                                                                             *
+ * INPUT:   from     -- Objects due after this frame are affected.                             *
+ *                                                                                             *
+ *          to       -- Objects due before this frame are moved to it.                         *
+ *                                                                                             *
+ *          filter   -- Returns false for objects that must not be moved.                      *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys>
+inline void FrameQueueClass<T, size, frames, keys>::Delay(unsigned from, unsigned to, int (*filter)(T const&))
+{
+    T* array = this->Get_Array();
+    int start = this->Count - Unchecked;
+
+    if (from != DelayFrom || to != DelayTo) {
+        DelayFrom = from;
+        DelayTo = to;
+        start = 0;
+    }
+    Unchecked = 0;
+
+    for (int index = start; index < this->Count; index++) {
+        int slot = (this->Get_Head() + index) & (size - 1);
+        if (Where[slot] != SLOT_NONE && array[slot].Frame > from && array[slot].Frame < to && filter(array[slot])) {
+            Unlink(slot);
+            array[slot].Frame = to;
+            Place(slot);
+        }
+    }
+}
+
+template <class T, int size, int frames, int keys>
+inline int FrameQueueClass<T, size, frames, keys>::First_Due(int key) const
+{
+    return (DueHead[key]);
+}
+
+template <class T, int size, int frames, int keys>
+inline int FrameQueueClass<T, size, frames, keys>::Next_Due(int slot) const
+{
+    return (Link[slot]);
+}
+
+template <class T, int size, int frames, int keys>
+inline void FrameQueueClass<T, size, frames, keys>::Retire(int slot)
+{
+    Unlink(slot);
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Place -- Files an unindexed object into its bucket or due list.            *
+ *                                                                                             *
+ * INPUT:   slot  -- The internal slot of the object.                                          *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys>
+inline void FrameQueueClass<T, size, frames, keys>::Place(int slot)
+{
+    unsigned frame = this->Get_Array()[slot].Frame;
+
+    if (frame <= Now) {
+        Link_Due(slot);
+        return;
+    }
+
+    int& head = Bucket[frame & (frames - 1)];
+    Prev[slot] = -1;
+    Link[slot] = head;
+    if (head != -1) {
+        Prev[head] = slot;
+    }
+    head = slot;
+    Where[slot] = SLOT_BUCKET;
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Link_Due -- Inserts an object into its due list in queue order.            *
+ *                                                                                             *
+ *    The search starts from the end of the list, since the object is usually the newest.      *
+ *                                                                                             *
+ * INPUT:   slot  -- The internal slot of the object.                                          *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys>
+inline void FrameQueueClass<T, size, frames, keys>::Link_Due(int slot)
+{
+    int key = this->Get_Array()[slot].ID;
+    int position = Position(slot);
+
+    int after = DueTail[key];
+    while (after != -1 && Position(after) > position) {
+        after = Prev[after];
+    }
+
+    Prev[slot] = after;
+    if (after == -1) {
+        Link[slot] = DueHead[key];
+        DueHead[key] = slot;
+    } else {
+        Link[slot] = Link[after];
+        Link[after] = slot;
+    }
+    if (Link[slot] == -1) {
+        DueTail[key] = slot;
+    } else {
+        Prev[Link[slot]] = slot;
+    }
+    Where[slot] = SLOT_DUE;
+}
+
+/***********************************************************************************************
+ * FrameQueueClass::Unlink -- Removes an object from whichever list it is in.                  *
+ *                                                                                             *
+ * INPUT:   slot  -- The internal slot of the object.                                          *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The object's Frame and ID must not have changed since it was filed.             *
+ *=============================================================================================*/
+template <class T, int size, int frames, int keys>
+inline void FrameQueueClass<T, size, frames, keys>::Unlink(int slot)
+{
+    if (Where[slot] == SLOT_NONE) {
+        return;
+    }
+
+    if (Prev[slot] != -1) {
+        Link[Prev[slot]] = Link[slot];
+    } else if (Where[slot] == SLOT_BUCKET) {
+        Bucket[this->Get_Array()[slot].Frame & (frames - 1)] = Link[slot];
+    } else {
+        DueHead[this->Get_Array()[slot].ID] = Link[slot];
+    }
+
+    if (Link[slot] != -1) {
+        Prev[Link[slot]] = Prev[slot];
+    } else if (Where[slot] == SLOT_DUE) {
+        DueTail[this->Get_Array()[slot].ID] = Prev[slot];
+    }
+
+    Where[slot] = SLOT_NONE;
+}
+
+#endif
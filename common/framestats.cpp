@@ -0,0 +1,124 @@
+#include "framestats.h"
+
+FrameStatsClass::FrameStatsClass(void)
+    : Frames(0)
+    , Dropped(0)
+    , Total(0)
+    , Worst(0)
+    , Last(0)
+{
+}
+
+void FrameStatsClass::Add(int64_t microseconds)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    Frames++;
+    Total += microseconds;
+    Last = microseconds;
+    if (microseconds > Worst) {
+        Worst = microseconds;
+    }
+}
+
+void FrameStatsClass::Drop(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    Dropped++;
+}
+
+FrameStatsType FrameStatsClass::Get(bool reset)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    FrameStatsType stats;
+
+    stats.Frames = Frames;
+    stats.Dropped = Dropped;
+    stats.Average = Frames > 0 ? (int)(Total / Frames) : 0;
+    stats.Worst = (int)Worst;
+    stats.Last = (int)Last;
+
+    if (reset) {
+        Frames = 0;
+        Dropped = 0;
+        Total = 0;
+        Worst = 0;
+    }
+    return (stats);
+}
+
+void FrameStatsClass::Reset(void)
+{
+    Get(true);
+}
+
+FrameHistogramClass::FrameHistogramClass(void)
+{
+    Clear();
+}
+
+void FrameHistogramClass::Clear(void)
+{
+    for (int index = 0; index < BUCKETS; index++) {
+        Counts[index] = 0;
+    }
+    Next = 0;
+    Frames = 0;
+}
+
+static int Bucket_Of(int microseconds)
+{
+    int bucket = microseconds / FrameHistogramClass::BUCKET_WIDTH;
+    return (bucket < FrameHistogramClass::BUCKETS ? bucket : FrameHistogramClass::BUCKETS - 1);
+}
+
+void FrameHistogramClass::Add(int64_t microseconds)
+{
+    int sample = microseconds < 0 ? 0 : (microseconds > INT32_MAX ? INT32_MAX : (int)microseconds);
+
+    /*
+    **	Once full, the oldest frame makes way for the new one.
+    */
+    if (Frames == HISTORY) {
+        Counts[Bucket_Of(Samples[Next])]--;
+    } else {
+        Frames++;
+    }
+
+    Samples[Next] = sample;
+    Counts[Bucket_Of(sample)]++;
+    Next = (Next + 1) % HISTORY;
+}
+
+int FrameHistogramClass::Get_Worst(void) const
+{
+    int worst = 0;
+
+    for (int index = 0; index < Frames; index++) {
+        if (Samples[index] > worst) {
+            worst = Samples[index];
+        }
+    }
+    return (worst);
+}
+
+int FrameHistogramClass::Get_Percentile(int percent) const
+{
+    int wanted = (Frames * percent + 99) / 100;
+    int counted = 0;
+
+    if (Frames == 0) {
+        return (0);
+    }
+
+    for (int index = 0; index < BUCKETS - 1; index++) {
+        counted += Counts[index];
+        if (counted >= wanted) {
+            int worst = Get_Worst();
+            int top = (index + 1) * BUCKET_WIDTH;
+            return (top < worst ? top : worst);
+        }
+    }
+    return (Get_Worst());
+}
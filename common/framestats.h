@@ -0,0 +1,95 @@
+#ifndef FRAMESTATS_H
+#define FRAMESTATS_H
+
+#include <stdint.h>
+#include <mutex>
+
+/*
+**	A summary of the frame times collected since the last reset. Times are in microseconds.
+*/
+struct FrameStatsType
+{
+    int Frames;
+    int Dropped;
+    int Average;
+    int Worst;
+    int Last;
+};
+
+/*
+**	Collects the time taken by each frame of one thread so that any other thread can read
+**	them, for instance the presentation thread's times from the game thread. Frames that
+**	were given up on rather than timed are counted as dropped.
+*/
+class FrameStatsClass
+{
+public:
+    FrameStatsClass(void);
+
+    void Add(int64_t microseconds);
+    void Drop(void);
+
+    /*
+    **	Gives the summary, and with reset starts collecting afresh in the same step so that
+    **	no frame is missed or counted twice.
+    */
+    FrameStatsType Get(bool reset = false);
+    void Reset(void);
+
+private:
+    std::mutex Mutex;
+
+    int Frames;
+    int Dropped;
+    int64_t Total;
+    int64_t Worst;
+    int64_t Last;
+
+    FrameStatsClass(FrameStatsClass const&);
+    FrameStatsClass& operator=(FrameStatsClass const&);
+};
+
+/*
+**	A histogram of the last HISTORY frame times, in buckets of BUCKET_WIDTH microseconds with
+**	anything longer in the last one. Each new frame pushes out the oldest, so it always shows
+**	how frames are being delivered now rather than since the game started. It is meant to be
+**	used from one thread only.
+*/
+class FrameHistogramClass
+{
+public:
+    enum
+    {
+        BUCKETS = 64,
+        BUCKET_WIDTH = 500,
+        HISTORY = 600
+    };
+
+    FrameHistogramClass(void);
+
+    void Add(int64_t microseconds);
+    void Clear(void);
+
+    int Get_Frames(void) const
+    {
+        return Frames;
+    }
+    int Get_Count(int bucket) const
+    {
+        return Counts[bucket];
+    }
+    int Get_Worst(void) const;
+
+    /*
+    **	The time that the given percentage of frames took no longer than, to the bucket.
+    */
+    int Get_Percentile(int percent) const;
+
+private:
+    int Samples[HISTORY];
+    int Counts[BUCKETS];
+    int Next;
+    int Frames;
+};
+
+#endif /* FRAMESTATS_H */
@@ -173,7 +173,187 @@ int LCW_Uncompress(void const* source, void* dest, unsigned length)
     return (int)(dest_ptr - (unsigned char*)dest);
 }
 
-int LCW_Comp(const void* src, void* dst, unsigned int bytes)
+/*
+**	The reach of the LCW copy commands. Copies by absolute offset can only start in the first
+**	64k of the data; the short copy by relative offset reaches back 4k, for at most 10 bytes.
+*/
+enum
+{
+    LCW_MIN_COUNT = 3,
+    LCW_MAX_COUNT = 0xFFFF,
+    LCW_MAX_ABSOLUTE = 0xFFFF,
+    LCW_MAX_RELATIVE = 0xFFF,
+    LCW_MAX_RELATIVE_COUNT = 10,
+    LCW_MAX_MEDIUM_COUNT = 0x40
+};
+
+/*
+**	Finds earlier matches for LCW_Comp. Every position is entered in a chain of the earlier
+**	positions that start with the same three bytes (give or take hash collisions), most recent
+**	first, so only those need to be compared. Positions beyond the first 64k are only of use
+**	to the short copy, so once a chain goes out of its reach the search jumps straight to the
+**	newest position in the first 64k, using the chain heads as they were when it was passed.
+*/
+class LCWMatchFinder
+{
+public:
+    LCWMatchFinder(unsigned char const* start, unsigned length, int effort)
+        : Start(start)
+        , Length(length)
+        , Effort(effort)
+        , Count(0)
+        , FarHead(NULL)
+    {
+        int bits = 10;
+        while (bits < 16 && (1U << bits) < length) {
+            ++bits;
+        }
+        Shift = 32 - bits;
+
+        Head = new int[1 << bits];
+        Prev = new int[length];
+        memset(Head, -1, sizeof(int) << bits);
+        if (length > LCW_MAX_ABSOLUTE + 1) {
+            FarHead = new int[1 << bits];
+            memset(FarHead, -1, sizeof(int) << bits);
+        }
+    }
+
+    ~LCWMatchFinder(void)
+    {
+        delete[] Head;
+        delete[] Prev;
+        delete[] FarHead;
+    }
+
+    int Find(unsigned pos, unsigned& match);
+
+private:
+    unsigned Hash(unsigned pos) const
+    {
+        return ((Start[pos] << 16 | Start[pos + 1] << 8 | Start[pos + 2]) * 2654435761U) >> Shift;
+    }
+
+    unsigned char const* Start;
+    unsigned Length;
+    int Effort;
+    int Shift;
+
+    /*
+    **	The positions before Count have been entered in the chains.
+    */
+    unsigned Count;
+
+    int* Head;
+    int* Prev;
+    int* FarHead;
+
+    LCWMatchFinder(LCWMatchFinder const&);
+    LCWMatchFinder& operator=(LCWMatchFinder const&);
+};
+
+/***************************************************************************
+ * LCWMatchFinder::Find -- Finds the longest usable match for a position.  *
+ *                                                                         *
+ * All positions up to this one are entered in the chains first, so        *
+ * positions must be asked for in increasing order.                        *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *      unsigned position to find a match for                              *
+ *      unsigned & set to the position of the match                        *
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *     int number of bytes that can be copied from the match; less than    *
+ *     LCW_MIN_COUNT if there is none.                                     *
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *     Matches that start beyond the first 64k are cut to the 10 bytes a   *
+ *     short copy can hold.                                                *
+ *=========================================================================*/
+int LCWMatchFinder::Find(unsigned pos, unsigned& match)
+{
+    while (Count < pos && Count + LCW_MIN_COUNT <= Length) {
+        if (Count == LCW_MAX_ABSOLUTE + 1) {
+            memcpy(FarHead, Head, sizeof(int) << (32 - Shift));
+        }
+        unsigned hash = Hash(Count);
+        Prev[Count] = Head[hash];
+        Head[hash] = Count;
+        ++Count;
+    }
+
+    if (pos + LCW_MIN_COUNT > Length) {
+        return 0;
+    }
+
+    int limit = Length - pos < LCW_MAX_COUNT ? Length - pos : LCW_MAX_COUNT;
+    int best = 0;
+    unsigned hash = Hash(pos);
+    int tries = Effort;
+
+    for (int chk = Head[hash]; chk >= 0 && tries-- > 0; chk = Prev[chk]) {
+        int usable = limit;
+
+        if (chk > LCW_MAX_ABSOLUTE) {
+            if (pos - chk > LCW_MAX_RELATIVE) {
+                /*
+                **	Nothing from here back to the first 64k can be reached.
+                */
+                chk = FarHead[hash];
+                if (chk < 0) {
+                    break;
+                }
+            } else if (usable > LCW_MAX_RELATIVE_COUNT) {
+                usable = LCW_MAX_RELATIVE_COUNT;
+            }
+        }
+
+        if (usable <= best || Start[chk + best] != Start[pos + best]) {
+            continue;
+        }
+
+        int len = 0;
+        while (len < usable && Start[chk + len] == Start[pos + len]) {
+            ++len;
+        }
+
+        /*
+        **	Keep the nearest of equal matches; it is the most likely to fit a short copy.
+        */
+        if (len > best) {
+            best = len;
+            match = chk;
+            if (best == limit) {
+                break;
+            }
+        }
+    }
+
+    return best;
+}
+
+/***************************************************************************
+ * LCW_Comp -- Compress data into an LCW encoded data block.               *
+ *                                                                         *
+ * This produces the command codes described for LCW_Uncompress. Runs of   *
+ * a single byte are found directly; other matches are found through       *
+ * chains of earlier positions with the same first bytes, checking at most *
+ * effort of them for each position.                                       *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *      void * source ptr                                                  *
+ *      void * destination ptr                                             *
+ *      unsigned int length of uncompressed data                           *
+ *      int how many earlier positions to check for matches                *
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *     int # of destination bytes written                                  *
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *     The destination must hold length + length / 63 + 2 bytes for data   *
+ *     that doesn't compress.                                              *
+ *=========================================================================*/
+int LCW_Comp(const void* src, void* dst, unsigned int bytes, int effort)
 {
     if (!bytes) {
         return 0;
@@ -184,6 +364,7 @@ int LCW_Comp(const void* src, void* dst, unsigned int bytes)
     const unsigned char* getstart = getp;
     const unsigned char* getend = getp + bytes;
     unsigned char* putstart = putp;
+    LCWMatchFinder finder(getstart, bytes, effort);
     bool cmd_one;
     // Write a starting cmd1 and set bool to have cmd1 in progress
     unsigned char* cmd_onep = putp;
@@ -199,7 +380,7 @@ int LCW_Comp(const void* src, void* dst, unsigned int bytes)
             const unsigned char* rlemax = (getend - getp) < 0xFFFF ? getend : getp + 0xFFFF;
             const unsigned char* rlep;
 
-            for (rlep = getp + 1; *rlep == *getp && rlep < rlemax; ++rlep)
+            for (rlep = getp + 1; rlep < rlemax && *rlep == *getp; ++rlep)
                 ;
 
             unsigned short run_length = rlep - getp;
@@ -217,45 +398,11 @@ int LCW_Comp(const void* src, void* dst, unsigned int bytes)
         }
 
         // current block size for an offset copy
-        int block_size = 0;
-        const unsigned char* offstart;
-
-        // Set where we start looking for matching runs.
-        offstart = getstart;
-
-        // Look for matching runs
-        const unsigned char* offchk = offstart;
-        const unsigned char* offsetp = getp;
-        while (offchk < getp) {
-            // Move offchk to next matching position
-            while (offchk < getp && *offchk != *getp) {
-                ++offchk;
-            }
-
-            // If the checking pointer has reached current pos, break
-            if (offchk >= getp) {
-                break;
-            }
-
-            // find out how long the run of matches goes for
-            //<= because it can consider the current pixel as part of a run
-            int i;
-            for (i = 1; &getp[i] < getend; ++i) {
-                if (offchk[i] != getp[i]) {
-                    break;
-                }
-            }
-
-            if (i >= block_size) {
-                block_size = i;
-                offsetp = offchk;
-            }
-
-            ++offchk;
-        }
+        unsigned offset_pos = 0;
+        int block_size = finder.Find(getp - getstart, offset_pos);
 
         // decide what encoding to use for current run
-        if (block_size <= 2) {
+        if (block_size < LCW_MIN_COUNT) {
             // short copy 0b10??????
             // check we have an existing 1 byte command and if its value is still
             // small enough to handle additional bytes
@@ -273,10 +420,10 @@ int LCW_Comp(const void* src, void* dst, unsigned int bytes)
             }
         } else {
             unsigned short offset;
-            unsigned short rel_offset = getp - offsetp;
-            if (block_size > 0xA || (rel_offset > 0xFFF)) {
+            unsigned rel_offset = (getp - getstart) - offset_pos;
+            if (block_size > LCW_MAX_RELATIVE_COUNT || rel_offset > LCW_MAX_RELATIVE) {
                 // write 5 byte command 0b11111111
-                if (block_size > 0x40) {
+                if (block_size > LCW_MAX_MEDIUM_COUNT) {
                     *putp++ = 0xFF;
                     *putp++ = block_size;
                     *putp++ = block_size >> 8;
@@ -285,7 +432,7 @@ int LCW_Comp(const void* src, void* dst, unsigned int bytes)
                     *putp++ = (block_size - 3) | 0xC0;
                 }
 
-                offset = offsetp - getstart;
+                offset = offset_pos;
                 // write 2 byte command? 0b0???????
             } else {
                 offset = rel_offset << 8 | (16 * (block_size - 3) + (rel_offset >> 8));
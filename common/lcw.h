@@ -35,7 +35,18 @@
 #ifndef LCW_H
 #define LCW_H
 
+/*
+**	How hard LCW_Comp looks for matches; the most earlier positions it checks for each one.
+**	Higher levels compress a little better and take longer.
+*/
+typedef enum LCWEffortType
+{
+    LCW_EFFORT_FAST = 4,
+    LCW_EFFORT_NORMAL = 32,
+    LCW_EFFORT_BEST = 0x10000
+} LCWEffortType;
+
 int LCW_Uncompress(void const* source, void* dest, unsigned length);
-int LCW_Comp(void const* source, void* dest, unsigned length);
+int LCW_Comp(void const* source, void* dest, unsigned length, int effort = LCW_EFFORT_NORMAL);
 
 #endif
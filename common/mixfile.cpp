@@ -33,13 +33,16 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   MixFileClass::Add_To_Index -- Adds the files in this mixfile to the lookup index.         *
  *   MixFileClass::Cache -- Caches the named mixfile into RAM.                                 *
  *   MixFileClass::Cache -- Loads this particular mixfile's data into RAM.                     *
  *   MixFileClass::Finder -- Finds the mixfile object that matches the name specified.         *
  *   MixFileClass::Free -- Uncaches a cached mixfile.                                          *
+ *   MixFileClass::Map -- Caches this mixfile's data by mapping it from the file.              *
  *   MixFileClass::MixFileClass -- Constructor for mixfile object.                             *
  *   MixFileClass::Offset -- Searches in mixfile for matching file and returns offset if found.*
  *   MixFileClass::Retrieve -- Retrieves a pointer to the specified data file.                 *
+ *   MixFileClass::Unmap -- Releases the mapping made by Map().                                *
  *   MixFileClass::~MixFileClass -- Destructor for the mixfile object.                         *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
@@ -53,3 +56,11 @@ template class MixFileClass<CCFileClass>;
 **	with the mixfile system.
 */
 template <class T, class TCRC> VanillaList<MixFileClass<T, TCRC>> MixFileClass<T, TCRC>::MixList;
+
+/*
+**	This finds any embedded file in the registered mixfiles by the CRC of its name.
+*/
+template <class T, class TCRC> MixIndexClass MixFileClass<T, TCRC>::Index;
+template <class T, class TCRC> bool MixFileClass<T, TCRC>::IsIndexStale = false;
+template <class T, class TCRC> std::mutex MixFileClass<T, TCRC>::ListLock;
+template <class T, class TCRC> bool MixFileClass<T, TCRC>::IsMappingAllowed = true;
@@ -29,6 +29,10 @@
 #include "shastraw.h"
 #include "wwstd.h"
 #include "rndstraw.h"
+#include "mixindex.h"
+#include "debugstring.h"
+
+#include <mutex>
 
 #ifndef _WIN32
 #include <libgen.h> // For basename()
@@ -50,6 +54,20 @@ static char* basename_vita(const char* filename)
 #define _MAX_PATH PATH_MAX
 #endif
 
+/*
+**	On Linux the data of a cached mixfile is mapped from the file rather than read into the
+**	heap, so the page cache holds it once for everybody and pages that are never used are
+**	never read.
+*/
+#ifdef __linux__
+#define MIXFILE_MAPPING
+#include <chrono>
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 void Prog_End(const char*, bool);
 bool Force_CD_Available(int);
 void Emergency_Exit(int);
@@ -107,9 +125,17 @@ public:
         return Count;
     }
 
+    /*
+    **	Should Cache() map mixfiles rather than read them, where that is supported?
+    */
+    static bool IsMappingAllowed;
+
 private:
     static MixFileClass* Finder(char const* filename);
     // int Offset(int crc, int * size = 0) const;	// ST - 5/10/2019
+    void Add_To_Index(void);
+    bool Map(void);
+    void Unmap(void);
 
     /*
     **	If this mixfile has an attached message digest, then this flag
@@ -131,6 +157,15 @@ private:
     */
     unsigned IsAllocated : 1;
 
+    /*
+    **	If the cached data is a private copy-on-write mapping of the file, then this flag will
+    **	be true. Writes to it go to copies of the pages and never reach the file. Mapping is
+    **	the start of the mapped pages, which may be before Data.
+    */
+    unsigned IsMapped : 1;
+    void* Mapping;
+    size_t MappingSize;
+
 /*
     **	This is the initial file header. It tells how many files are embedded
     **	within this mixfile and the total size of all embedded files.
@@ -171,6 +206,20 @@ private:
     void* Data; // Pointer to raw data.
 
     static VanillaList<MixFileClass<T, TCRC>> MixList;
+
+    /*
+    **	Every embedded file of every registered mixfile, by CRC. When a mixfile is deleted
+    **	the index is marked stale and is rebuilt from MixList on the next search.
+    */
+    static MixIndexClass Index;
+    static bool IsIndexStale;
+
+    /*
+    **	Files may be looked up from threads other than the game thread, so MixList, Index and
+    **	IsIndexStale are only used while holding this. It doesn't make it safe to cache or free
+    **	a mixfile that another thread is reading from.
+    */
+    static std::mutex ListLock;
 };
 
 /***********************************************************************************************
@@ -227,6 +276,7 @@ template <class T, class TCRC> MixFileClass<T, TCRC>::~MixFileClass(void)
         delete[] static_cast<char*>(Data);
         IsAllocated = false;
     }
+    Unmap();
     Data = NULL;
 
     if (HeaderBuffer != NULL) {
@@ -235,9 +285,12 @@ template <class T, class TCRC> MixFileClass<T, TCRC>::~MixFileClass(void)
     }
 
     /*
-    **	Unlink this mixfile object from the chain.
+    **	Unlink this mixfile object from the chain. Its files may have hidden those of a
+    **	later mixfile, so the index has to be rebuilt.
     */
+    std::lock_guard<std::mutex> lock(ListLock);
     this->Unlink();
+    IsIndexStale = true;
 }
 
 /***********************************************************************************************
@@ -262,6 +315,9 @@ MixFileClass<T, TCRC>::MixFileClass(char const* filename)
     : IsDigest(false)
     , IsEncrypted(false)
     , IsAllocated(false)
+    , IsMapped(false)
+    , Mapping(NULL)
+    , MappingSize(0)
     , Filename(0)
     , Count(0)
     , DataSize(0)
@@ -359,7 +415,9 @@ MixFileClass<T, TCRC>::MixFileClass(char const* filename)
     /*
     **	Attach to list of mixfiles.
     */
+    std::lock_guard<std::mutex> lock(ListLock);
     MixList.Add_Tail(this);
+    Add_To_Index();
 }
 
 /***********************************************************************************************
@@ -384,6 +442,9 @@ MixFileClass<T, TCRC>::MixFileClass(char const* filename, PKey const* key)
     : IsDigest(false)
     , IsEncrypted(false)
     , IsAllocated(false)
+    , IsMapped(false)
+    , Mapping(NULL)
+    , MappingSize(0)
     , Filename(0)
     , Count(0)
     , DataSize(0)
@@ -491,7 +552,9 @@ MixFileClass<T, TCRC>::MixFileClass(char const* filename, PKey const* key)
     /*
     **	Attach to list of mixfiles.
     */
+    std::lock_guard<std::mutex> lock(ListLock);
     MixList.Add_Tail(this);
+    Add_To_Index();
 }
 
 /***********************************************************************************************
@@ -538,6 +601,7 @@ template <class T, class TCRC> void const* MixFileClass<T, TCRC>::Retrieve(char
  *=============================================================================================*/
 template <class T, class TCRC> MixFileClass<T, TCRC>* MixFileClass<T, TCRC>::Finder(char const* filename)
 {
+    std::lock_guard<std::mutex> lock(ListLock);
     MixFileClass<T, TCRC>* ptr = MixList.First();
     while (ptr->Is_Valid()) {
 #ifdef _WIN32
@@ -618,6 +682,22 @@ template <class T, class TCRC> bool MixFileClass<T, TCRC>::Cache(Buffer const* b
     if (Data != NULL)
         return (true);
 
+#ifdef MIXFILE_MAPPING
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    if (buffer == NULL && IsMappingAllowed && Map()) {
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        DBG_INFO("MixFileClass::Cache %s: mapped %d bytes in %d ms, peak RSS %ld KB",
+                 Filename,
+                 DataSize,
+                 int(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+                         .count()),
+                 usage.ru_maxrss);
+        return (true);
+    }
+#endif
+
     /*
     **	If a buffer was supplied (and it is big enough), then use it as the data block
     **	pointer. Otherwise, the data block must be allocated.
@@ -688,6 +768,16 @@ template <class T, class TCRC> bool MixFileClass<T, TCRC>::Cache(Buffer const* b
             }
         }
 
+#ifdef MIXFILE_MAPPING
+        struct rusage usage;
+        getrusage(RUSAGE_SELF, &usage);
+        DBG_INFO("MixFileClass::Cache %s: read %d bytes in %d ms, peak RSS %ld KB",
+                 Filename,
+                 DataSize,
+                 int(std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start)
+                         .count()),
+                 usage.ru_maxrss);
+#endif
         return (true);
     }
     IsAllocated = false;
@@ -716,17 +806,122 @@ template <class T, class TCRC> void MixFileClass<T, TCRC>::Free(void)
     if (Data != NULL && IsAllocated) {
         delete[] Data;
     }
+    Unmap();
     Data = NULL;
     IsAllocated = false;
 }
 
-inline int compfunc(void const* ptr1, void const* ptr2)
+/***********************************************************************************************
+ * MixFileClass::Map -- Caches this mixfile's data by mapping it from the file.                *
+ *                                                                                             *
+ *    The data region of the mixfile (and the digest after it) is mapped from the file, and    *
+ *    is pointed at it. The embedded files are never encrypted, so they can be used directly   *
+ *    from the mapping. If there is a digest, it is checked just as Cache() would.             *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the data mapped? If not, it should be read instead.                      *
+ *                                                                                             *
+ * WARNINGS:   A mixfile that is held inside a cached mixfile can't be mapped.                 *
+ *=============================================================================================*/
+template <class T, class TCRC> bool MixFileClass<T, TCRC>::Map(void)
 {
-    if (*(int32_t const*)ptr1 < *(int32_t const*)ptr2)
-        return (-1);
-    if (*(int32_t const*)ptr1 > *(int32_t const*)ptr2)
-        return (1);
-    return (0);
+#ifdef MIXFILE_MAPPING
+    T file(Filename);
+
+    if (!file.Open(READ) || file.Get_File_Handle() == NULL) {
+        return (false);
+    }
+
+    /*
+    **	DataStart is the offset in the file on disk, even for a mixfile held in another one.
+    **	The mapping must start on a page boundary, so it starts a little before the data.
+    */
+    int fd = fileno(file.Get_File_Handle());
+    size_t length = DataSize + (IsDigest ? 20 : 0);
+    off_t page = sysconf(_SC_PAGESIZE);
+    off_t start = DataStart - (DataStart % page);
+    size_t lead = DataStart - start;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)(DataStart + length)) {
+        return (false);
+    }
+
+    /*
+    **	The mapping is private so that any code that patches data it has retrieved only gets
+    **	its own copy of the pages it touches, as it would have with the data in the heap.
+    */
+    void* mapping = mmap(NULL, lead + length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, start);
+    if (mapping == MAP_FAILED) {
+        return (false);
+    }
+
+    Mapping = mapping;
+    MappingSize = lead + length;
+    IsMapped = true;
+    Data = (char*)mapping + lead;
+
+    if (IsDigest) {
+        SHAEngine sha;
+        char digest[20];
+        sha.Hash(Data, DataSize);
+        sha.Result(digest);
+        if (memcmp((char*)Data + DataSize, digest, sizeof(digest)) != 0) {
+            Unmap();
+            Data = NULL;
+            return (false);
+        }
+    }
+
+    return (true);
+#else
+    return (false);
+#endif
+}
+
+/***********************************************************************************************
+ * MixFileClass::Unmap -- Releases the mapping made by Map().                                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Data is left pointing at the released mapping; the caller clears it.            *
+ *=============================================================================================*/
+template <class T, class TCRC> void MixFileClass<T, TCRC>::Unmap(void)
+{
+#ifdef MIXFILE_MAPPING
+    if (IsMapped) {
+        munmap(Mapping, MappingSize);
+    }
+#endif
+    IsMapped = false;
+    Mapping = NULL;
+    MappingSize = 0;
+}
+
+/***********************************************************************************************
+ * MixFileClass::Add_To_Index -- Adds the files in this mixfile to the lookup index.           *
+ *                                                                                             *
+ *    Files that an earlier mixfile already holds are left out, since the search would find    *
+ *    those first.                                                                             *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Mixfiles must be added in MixList order.                                        *
+ *=============================================================================================*/
+template <class T, class TCRC> void MixFileClass<T, TCRC>::Add_To_Index(void)
+{
+    if (IsIndexStale) {
+        return;
+    }
+
+    for (int index = 0; index < Count; index++) {
+        Index.Add(HeaderBuffer[index].CRC, this, &HeaderBuffer[index]);
+    }
 }
 
 /***********************************************************************************************
@@ -783,44 +978,43 @@ bool MixFileClass<T, TCRC>::Offset(char const* filename, void** realptr, MixFile
 template <class T, class TCRC>
 bool MixFileClass<T, TCRC>::Offset(int hash, void** realptr, MixFileClass** mixfile, int* offset, int* size)
 {
-    MixFileClass<T, TCRC>* ptr;
-    SubBlock key;
-    key.CRC = hash;
+    std::lock_guard<std::mutex> lock(ListLock);
 
     /*
-    **	Sweep through all registered mixfiles, trying to find the file in question.
+    **	Bring the index up to date if a mixfile has been deleted since it was built.
     */
-    ptr = MixList.First();
-    while (ptr->Is_Valid()) {
-        SubBlock* block;
-
-        /*
-        **	Binary search for the file in this mixfile. If it is found, then extract the
-        **	appropriate information and store it in the locations provided and then return.
-        */
-        block = (SubBlock*)bsearch(&key, ptr->HeaderBuffer, ptr->Count, sizeof(SubBlock), compfunc);
-        if (block != NULL) {
-            if (mixfile != NULL)
-                *mixfile = ptr;
-            if (size != NULL)
-                *size = block->Size;
-            if (realptr != NULL)
-                *realptr = NULL;
-            if (offset != NULL)
-                *offset = block->Offset;
-            if (realptr != NULL && ptr->Data != NULL) {
-                *realptr = (char*)ptr->Data + block->Offset;
-            }
-            if (ptr->Data == NULL && offset != NULL) {
-                *offset += ptr->DataStart;
-            }
-            return (true);
+    if (IsIndexStale) {
+        Index.Clear();
+        IsIndexStale = false;
+        for (MixFileClass<T, TCRC>* ptr = MixList.First(); ptr->Is_Valid(); ptr = (MixFileClass<T, TCRC>*)ptr->Next()) {
+            ptr->Add_To_Index();
         }
+    }
 
-        /*
-        **	Advance to next mixfile.
-        */
-        ptr = (MixFileClass<T, TCRC>*)ptr->Next();
+    /*
+    **	Look the file up in the index of all registered mixfiles. If it is found, then extract
+    **	the appropriate information and store it in the locations provided and then return.
+    */
+    void const* owner = NULL;
+    SubBlock const* block = (SubBlock const*)Index.Find(hash, &owner);
+    if (block != NULL) {
+        MixFileClass<T, TCRC>* ptr = (MixFileClass<T, TCRC>*)owner;
+
+        if (mixfile != NULL)
+            *mixfile = ptr;
+        if (size != NULL)
+            *size = block->Size;
+        if (realptr != NULL)
+            *realptr = NULL;
+        if (offset != NULL)
+            *offset = block->Offset;
+        if (realptr != NULL && ptr->Data != NULL) {
+            *realptr = (char*)ptr->Data + block->Offset;
+        }
+        if (ptr->Data == NULL && offset != NULL) {
+            *offset += ptr->DataStart;
+        }
+        return (true);
     }
 
     /*
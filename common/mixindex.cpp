@@ -0,0 +1,107 @@
+#include "mixindex.h"
+
+#include <stddef.h>
+#include <string.h>
+
+/*
+**	CRCs are already well mixed, but mixing them again stops runs of close values from
+**	clustering in the table.
+*/
+static inline unsigned Mix_Hash(int32_t crc)
+{
+    return ((uint32_t)crc * 2654435761U) ^ ((uint32_t)crc >> 16);
+}
+
+MixIndexClass::MixIndexClass(void)
+    : Table(NULL)
+    , Size(0)
+    , Used(0)
+{
+}
+
+MixIndexClass::~MixIndexClass(void)
+{
+    delete[] Table;
+}
+
+/*
+**	Adds an embedded file, unless a file with the same CRC was added before it.
+*/
+void MixIndexClass::Add(int32_t crc, void const* mixfile, void const* block)
+{
+    if ((unsigned)(Used + 1) * 2 > Size) {
+        Grow();
+    }
+
+    unsigned mask = Size - 1;
+    for (unsigned slot = Mix_Hash(crc) & mask;; slot = (slot + 1) & mask) {
+        EntryType& entry = Table[slot];
+        if (entry.MixFile == NULL) {
+            entry.CRC = crc;
+            entry.MixFile = mixfile;
+            entry.Block = block;
+            Used++;
+            return;
+        }
+        if (entry.CRC == crc) {
+            return;
+        }
+    }
+}
+
+/*
+**	Returns the header entry for the CRC and the mixfile it belongs to, or NULL if no mixfile
+**	holds a file with that CRC.
+*/
+void const* MixIndexClass::Find(int32_t crc, void const** mixfile) const
+{
+    if (Used == 0) {
+        return (NULL);
+    }
+
+    unsigned mask = Size - 1;
+    for (unsigned slot = Mix_Hash(crc) & mask;; slot = (slot + 1) & mask) {
+        EntryType const& entry = Table[slot];
+        if (entry.MixFile == NULL) {
+            return (NULL);
+        }
+        if (entry.CRC == crc) {
+            if (mixfile != NULL) {
+                *mixfile = entry.MixFile;
+            }
+            return (entry.Block);
+        }
+    }
+}
+
+void MixIndexClass::Clear(void)
+{
+    if (Table != NULL) {
+        memset(Table, 0, Size * sizeof(EntryType));
+    }
+    Used = 0;
+}
+
+/*
+**	Doubles the table, keeping it at most half full so probes stay short.
+*/
+void MixIndexClass::Grow(void)
+{
+    EntryType* old = Table;
+    unsigned oldsize = Size;
+
+    Size = (Size == 0) ? 1024 : Size * 2;
+    Table = new EntryType[Size];
+    memset(Table, 0, Size * sizeof(EntryType));
+    Used = 0;
+
+    /*
+    **	Every CRC in the old table is different, so re-adding them keeps the same entries.
+    */
+    for (unsigned slot = 0; slot < oldsize; slot++) {
+        if (old[slot].MixFile != NULL) {
+            Add(old[slot].CRC, old[slot].MixFile, old[slot].Block);
+        }
+    }
+    delete[] old;
+}
@@ -0,0 +1,45 @@
+#ifndef MIXINDEX_H
+#define MIXINDEX_H
+
+#include <stdint.h>
+
+/*
+**	Maps the CRC of an embedded file name straight to the mixfile that holds it and its entry
+**	in that mixfile's header, so that a file can be found with one hash probe instead of a
+**	binary search in every registered mixfile. The first entry added for a CRC is the one
+**	kept; mixfiles are added in search order, so it is the one the search would have found.
+*/
+class MixIndexClass
+{
+public:
+    MixIndexClass(void);
+    ~MixIndexClass(void);
+
+    void Add(int32_t crc, void const* mixfile, void const* block);
+    void const* Find(int32_t crc, void const** mixfile) const;
+    void Clear(void);
+
+    int Count(void) const
+    {
+        return (Used);
+    }
+
+private:
+    struct EntryType
+    {
+        int32_t CRC;
+        void const* MixFile; // NULL if the slot is empty.
+        void const* Block;
+    };
+
+    void Grow(void);
+
+    EntryType* Table;
+    unsigned Size; // Always a power of two.
+    int Used;
+
+    MixIndexClass(MixIndexClass const&);
+    MixIndexClass& operator=(MixIndexClass const&);
+};
+
+#endif /* MIXINDEX_H */
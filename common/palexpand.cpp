@@ -0,0 +1,111 @@
+#include "palexpand.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define PALEXPAND_AVX2
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define PALEXPAND_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define PALEXPAND_NEON
+#endif
+
+void Palette_Expand_Scalar(uint32_t const* table,
+                           unsigned char const* src,
+                           int src_pitch,
+                           void* dst,
+                           int dst_pitch,
+                           int width,
+                           int height)
+{
+    unsigned char* dst_row = (unsigned char*)dst;
+
+    for (int y = 0; y < height; y++, src += src_pitch, dst_row += dst_pitch) {
+        uint32_t* out = (uint32_t*)dst_row;
+
+        for (int x = 0; x < width; x++) {
+            out[x] = table[src[x]];
+        }
+    }
+}
+
+/*
+**	Expands one row. The lookups are unrolled by the width of a vector store, and what is left
+**	over at the end of the row is done one pixel at a time.
+*/
+static inline void Expand_Row(uint32_t const* table, unsigned char const* src, uint32_t* out, int width)
+{
+    int x = 0;
+
+#if defined(PALEXPAND_AVX2)
+    for (; x + 8 <= width; x += 8) {
+        __m256i pixels = _mm256_setr_epi32(table[src[x]],
+                                           table[src[x + 1]],
+                                           table[src[x + 2]],
+                                           table[src[x + 3]],
+                                           table[src[x + 4]],
+                                           table[src[x + 5]],
+                                           table[src[x + 6]],
+                                           table[src[x + 7]]);
+        _mm256_storeu_si256((__m256i*)(out + x), pixels);
+    }
+#elif defined(PALEXPAND_SSE2)
+    for (; x + 8 <= width; x += 8) {
+        __m128i lo = _mm_setr_epi32(table[src[x]], table[src[x + 1]], table[src[x + 2]], table[src[x + 3]]);
+        __m128i hi = _mm_setr_epi32(table[src[x + 4]], table[src[x + 5]], table[src[x + 6]], table[src[x + 7]]);
+        _mm_storeu_si128((__m128i*)(out + x), lo);
+        _mm_storeu_si128((__m128i*)(out + x + 4), hi);
+    }
+#elif defined(PALEXPAND_NEON)
+    for (; x + 8 <= width; x += 8) {
+        uint32_t lo[4] = {table[src[x]], table[src[x + 1]], table[src[x + 2]], table[src[x + 3]]};
+        uint32_t hi[4] = {table[src[x + 4]], table[src[x + 5]], table[src[x + 6]], table[src[x + 7]]};
+        vst1q_u32(out + x, vld1q_u32(lo));
+        vst1q_u32(out + x + 4, vld1q_u32(hi));
+    }
+#else
+    for (; x + 4 <= width; x += 4) {
+        uint32_t a = table[src[x]];
+        uint32_t b = table[src[x + 1]];
+        uint32_t c = table[src[x + 2]];
+        uint32_t d = table[src[x + 3]];
+        out[x] = a;
+        out[x + 1] = b;
+        out[x + 2] = c;
+        out[x + 3] = d;
+    }
+#endif
+
+    for (; x < width; x++) {
+        out[x] = table[src[x]];
+    }
+}
+
+void Palette_Expand(uint32_t const* table,
+                    unsigned char const* src,
+                    int src_pitch,
+                    void* dst,
+                    int dst_pitch,
+                    int width,
+                    int height)
+{
+    unsigned char* dst_row = (unsigned char*)dst;
+
+    for (int y = 0; y < height; y++, src += src_pitch, dst_row += dst_pitch) {
+        Expand_Row(table, src, (uint32_t*)dst_row, width);
+    }
+}
+
+char const* Palette_Expand_Kernel(void)
+{
+#if defined(PALEXPAND_AVX2)
+    return "AVX2";
+#elif defined(PALEXPAND_SSE2)
+    return "SSE2";
+#elif defined(PALEXPAND_NEON)
+    return "NEON";
+#else
+    return "scalar";
+#endif
+}
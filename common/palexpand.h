@@ -0,0 +1,40 @@
+#ifndef PALEXPAND_H
+#define PALEXPAND_H
+
+#include <stdint.h>
+
+/*
+**	Expands 8 bit pixels to 32 bit ones through a 256 entry table of ready made pixels, as
+**	presenting a palettised surface on a true colour display needs. The table holds each
+**	colour already in the display's pixel format, so expanding is a lookup per pixel and
+**	nothing else.
+**
+**	A table lookup can't be vectorised without a gather, which is slow or missing on most
+**	CPUs, so the fast versions do the lookups with ordinary loads and only the stores with
+**	SSE2, AVX2 or NEON, whichever the compiler targets. Palette_Expand_Scalar is the plain
+**	version, which the others must match.
+**
+**	Pitches are in bytes.
+*/
+void Palette_Expand(uint32_t const* table,
+                    unsigned char const* src,
+                    int src_pitch,
+                    void* dst,
+                    int dst_pitch,
+                    int width,
+                    int height);
+
+void Palette_Expand_Scalar(uint32_t const* table,
+                           unsigned char const* src,
+                           int src_pitch,
+                           void* dst,
+                           int dst_pitch,
+                           int width,
+                           int height);
+
+/*
+**	The name of the version Palette_Expand uses in this build.
+*/
+char const* Palette_Expand_Kernel(void);
+
+#endif /* PALEXPAND_H */
@@ -0,0 +1,54 @@
+#include "radixsort.h"
+#include <string.h>
+
+void Radix_Sort(unsigned* keys, void** items, int count, unsigned* keytemp, void** itemtemp)
+{
+    if (count < 2) {
+        return;
+    }
+
+    unsigned* srckey = keys;
+    void** srcitem = items;
+    unsigned* dstkey = keytemp;
+    void** dstitem = itemtemp;
+
+    for (int shift = 0; shift < 32; shift += 8) {
+        int offsets[256];
+        memset(offsets, 0, sizeof(offsets));
+        for (int index = 0; index < count; index++) {
+            offsets[(srckey[index] >> shift) & 0xFF]++;
+        }
+
+        /*
+        **	A byte that is the same in every key would leave the order as it is.
+        */
+        if (offsets[(srckey[0] >> shift) & 0xFF] == count) {
+            continue;
+        }
+
+        int total = 0;
+        for (int digit = 0; digit < 256; digit++) {
+            int size = offsets[digit];
+            offsets[digit] = total;
+            total += size;
+        }
+
+        for (int index = 0; index < count; index++) {
+            int pos = offsets[(srckey[index] >> shift) & 0xFF]++;
+            dstkey[pos] = srckey[index];
+            dstitem[pos] = srcitem[index];
+        }
+
+        unsigned* tempkey = srckey;
+        srckey = dstkey;
+        dstkey = tempkey;
+        void** tempitem = srcitem;
+        srcitem = dstitem;
+        dstitem = tempitem;
+    }
+
+    if (srckey != keys) {
+        memcpy(keys, srckey, count * sizeof(keys[0]));
+        memcpy(items, srcitem, count * sizeof(items[0]));
+    }
+}
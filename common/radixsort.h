@@ -0,0 +1,11 @@
+#ifndef RADIXSORT_H
+#define RADIXSORT_H
+
+/*
+**	Stable least significant digit radix sort of 32 bit keys, one byte per pass. Each item
+**	moves with its key and items with equal keys keep their order, so the result depends on
+**	nothing but the input. The scratch arrays must hold count entries.
+*/
+void Radix_Sort(unsigned* keys, void** items, int count, unsigned* keytemp, void** itemtemp);
+
+#endif /* RADIXSORT_H */
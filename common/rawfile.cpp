@@ -40,8 +40,10 @@
  *   RawFileClass::Open -- Assigns name and opens file in one operation.                       *
  *   RawFileClass::Open -- Opens the file object with the rights specified.                    *
  *   RawFileClass::RawFileClass -- Simple constructor for a file object.                       *
+ *   RawFileClass::Raw_Read -- Reads from the file, bypassing the read-ahead buffer.           *
  *   RawFileClass::Raw_Seek -- Performs a seek on the unbiased file                            *
  *   RawFileClass::Read -- Reads the specified number of bytes into a memory buffer.           *
+ *   RawFileClass::Read_Ahead -- Reads from the file through the read-ahead buffer.            *
  *   RawFileClass::Seek -- Reposition the file pointer as indicated.                           *
  *   RawFileClass::Set_Name -- Manually sets the name for a file object.                       *
  *   RawFileClass::Size -- Determines size of file (in bytes).                                 *
@@ -70,6 +72,9 @@
 
 #include <sys/stat.h>
 
+int RawFileClass::ReadAheadWindow = 0x8000;
+RawFileStatsType RawFileClass::Stats;
+
 /***********************************************************************************************
  * RawFileClass::Error -- Handles displaying a file error message.                             *
  *                                                                                             *
@@ -125,6 +130,14 @@ RawFileClass::RawFileClass(char const* filename)
     , BiasLength(-1)
     , Handle(nullptr)
     , Filename(nullptr)
+    , IsReadAhead(false)
+    , ReadAhead(nullptr)
+    , ReadAheadSize(0)
+    , ReadAheadStart(0)
+    , ReadAheadFill(0)
+    , ReadAheadIndex(0)
+    , FilePos(0)
+    , ReadEnd(-1)
 {
     Set_Name(filename);
 }
@@ -275,6 +288,23 @@ int RawFileClass::Open(int rights)
             break;
         }
 
+        /*
+        **	Files opened for reading don't use the stdio buffer, so that every low level read
+        **	is a single system call of a known size. The read-ahead buffer takes its place.
+        */
+        FilePos = 0;
+        ReadEnd = -1;
+        ReadAheadFill = 0;
+        ReadAheadIndex = 0;
+        IsReadAhead = false;
+        if (Handle != nullptr && rights == READ) {
+            setvbuf(Handle, NULL, _IONBF, 0);
+            if (ReadAheadWindow > 0) {
+                IsReadAhead = true;
+                ReadAheadSize = ReadAheadWindow;
+            }
+        }
+
         /*
         **	Biased files must be positioned past the bias start position.
         */
@@ -409,6 +439,12 @@ void RawFileClass::Close(void)
         */
         Handle = nullptr;
 
+        delete[] ReadAhead;
+        ReadAhead = nullptr;
+        ReadAheadFill = 0;
+        ReadAheadIndex = 0;
+        IsReadAhead = false;
+
         /*
         **	Clear any positioning information incase class is reused to open another file.
         */
@@ -468,22 +504,11 @@ int RawFileClass::Read(void* buffer, int size)
         size = size < remainder ? size : remainder;
     }
 
-    int total = 0;
-    while (size > 0) {
-        clearerr(Handle);
-        bytesread = fread(buffer, 1, size, Handle);
-        if (ferror(Handle)) {
-            size -= bytesread;
-            total += bytesread;
-            Error(errno, true, Filename);
-            continue;
-        }
-        size -= bytesread;
-        total += bytesread;
-        if (bytesread == 0)
-            break;
+    if (IsReadAhead) {
+        bytesread = Read_Ahead(buffer, size);
+    } else {
+        bytesread = Raw_Read(buffer, size);
     }
-    bytesread = total;
 
     /*
     **	Close the file if it was opened by this routine and return
@@ -876,6 +901,32 @@ int RawFileClass::Raw_Seek(int pos, int dir)
         Error(EBADF, false, Filename);
     } else {
 
+        /*
+        **	With read-ahead the true file position is known, so asking for the position costs
+        **	nothing, and a seek that stays inside the buffer only moves the buffer index.
+        **	Otherwise the buffer is dropped; the true position is past the one the caller
+        **	sees, so a relative seek is turned into an absolute one first.
+        */
+        if (IsReadAhead) {
+            int current = (ReadAheadFill > 0) ? ReadAheadStart + ReadAheadIndex : FilePos;
+
+            if (dir == SEEK_CUR) {
+                pos += current;
+                dir = SEEK_SET;
+            }
+            if (dir == SEEK_SET) {
+                if (pos == current) {
+                    return (pos);
+                }
+                if (ReadAheadFill > 0 && pos >= ReadAheadStart && pos <= ReadAheadStart + ReadAheadFill) {
+                    ReadAheadIndex = pos - ReadAheadStart;
+                    return (pos);
+                }
+            }
+            ReadAheadFill = 0;
+            ReadAheadIndex = 0;
+        }
+
         clearerr(Handle);
 
         /*
@@ -886,12 +937,15 @@ int RawFileClass::Raw_Seek(int pos, int dir)
         ** guard this case so that sequential ::Read's do not take too much time.
         */
         if (!(pos == 0 && dir == SEEK_CUR)) {
+            Stats.Seeks++;
             if (fseek(Handle, pos, dir) < 0) {
                 Error(errno, false, Filename);
             }
         }
 
+        Stats.Seeks++;
         pos = ftell(Handle);
+        FilePos = pos;
     }
     /*
     **	Return with the new position of the file. This will range between zero and the number of
@@ -899,3 +953,107 @@ int RawFileClass::Raw_Seek(int pos, int dir)
     */
     return (pos);
 }
+
+/***********************************************************************************************
+ * RawFileClass::Raw_Read -- Reads from the file, bypassing the read-ahead buffer.             *
+ *                                                                                             *
+ *    This performs the low level reads for Read. A read error is reported and the read is     *
+ *    tried again.                                                                             *
+ *                                                                                             *
+ * INPUT:   buffer   -- Pointer to the buffer to read data into.                               *
+ *                                                                                             *
+ *          size     -- The number of bytes to read.                                           *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes read into the buffer.                             *
+ *                                                                                             *
+ * WARNINGS:   The file must be open. Any data in the read-ahead buffer is not looked at.      *
+ *=============================================================================================*/
+int RawFileClass::Raw_Read(void* buffer, int size)
+{
+    int total = 0;
+
+    while (size > 0) {
+        clearerr(Handle);
+        int bytesread = fread((char*)buffer + total, 1, size, Handle);
+        Stats.Reads++;
+        Stats.Bytes += bytesread;
+        FilePos += bytesread;
+        if (ferror(Handle)) {
+            size -= bytesread;
+            total += bytesread;
+            Error(errno, true, Filename);
+            continue;
+        }
+        size -= bytesread;
+        total += bytesread;
+        if (bytesread == 0)
+            break;
+    }
+    return (total);
+}
+
+/***********************************************************************************************
+ * RawFileClass::Read_Ahead -- Reads from the file through the read-ahead buffer.              *
+ *                                                                                             *
+ *    Whatever is left in the buffer is used first. If more is needed and this read carries    *
+ *    on from where the last one ended, the buffer is refilled with one large read and the     *
+ *    rest is taken from it. Reads that jump about, or that are as large as the buffer, go     *
+ *    straight to the file, so random access doesn't read data that is never used.             *
+ *                                                                                             *
+ * INPUT:   buffer   -- Pointer to the buffer to read data into.                               *
+ *                                                                                             *
+ *          size     -- The number of bytes to read. This must already be limited to the       *
+ *                      bias range.                                                            *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes read into the buffer.                             *
+ *                                                                                             *
+ * WARNINGS:   The file must be open with read-ahead in use.                                   *
+ *=============================================================================================*/
+int RawFileClass::Read_Ahead(void* buffer, int size)
+{
+    char* ptr = (char*)buffer;
+    int start = (ReadAheadFill > 0) ? ReadAheadStart + ReadAheadIndex : FilePos;
+    bool sequential = (ReadEnd == -1 || ReadEnd == start);
+    int total = 0;
+
+    if (ReadAheadIndex < ReadAheadFill) {
+        total = size < ReadAheadFill - ReadAheadIndex ? size : ReadAheadFill - ReadAheadIndex;
+        memcpy(ptr, ReadAhead + ReadAheadIndex, total);
+        ReadAheadIndex += total;
+        Stats.Buffered++;
+        if (total == size) {
+            ReadEnd = start + total;
+            return (total);
+        }
+        ptr += total;
+        size -= total;
+    }
+
+    /*
+    **	The buffer is used up, so the true file position is now where the caller is. A biased
+    **	file doesn't read ahead past the end of its range.
+    */
+    ReadAheadFill = 0;
+    ReadAheadIndex = 0;
+
+    int window = ReadAheadSize;
+    if (BiasLength != -1 && BiasStart + BiasLength - FilePos < window) {
+        window = BiasStart + BiasLength - FilePos;
+    }
+
+    if (!sequential || size >= window) {
+        total += Raw_Read(ptr, size);
+    } else {
+        if (ReadAhead == nullptr) {
+            ReadAhead = new char[ReadAheadSize];
+        }
+        ReadAheadStart = FilePos;
+        ReadAheadFill = Raw_Read(ReadAhead, window);
+        ReadAheadIndex = size < ReadAheadFill ? size : ReadAheadFill;
+        memcpy(ptr, ReadAhead, ReadAheadIndex);
+        total += ReadAheadIndex;
+    }
+
+    ReadEnd = start + total;
+    return (total);
+}
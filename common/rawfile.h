@@ -44,6 +44,7 @@
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <atomic>
 
 #include "wwfile.h"
 
@@ -51,6 +52,19 @@
 #define WWERROR -1
 #endif
 
+/*
+**	Counts of the low level operations done by RawFileClass::Read and RawFileClass::Seek, for
+**	all files together. Every low level read or seek is one system call, so these show how
+**	much the read-ahead buffer saves.
+*/
+struct RawFileStatsType
+{
+    std::atomic<long long> Reads;    // Low level reads.
+    std::atomic<long long> Seeks;    // Low level seeks and position queries.
+    std::atomic<long long> Bytes;    // Bytes read by the low level reads.
+    std::atomic<long long> Buffered; // Reads served (at least in part) from a read-ahead buffer.
+};
+
 /*
 **	This is the definition of the raw file class. It is derived from the abstract base FileClass
 **	and handles the interface to the low level DOS routines. This is the first class in the
@@ -112,6 +126,15 @@ public:
     */
     char* Filename;
 
+    /*
+    **	The size of the read-ahead buffer given to files opened for reading; zero turns
+    **	read-ahead off. Small reads that carry on from where the last read ended are served
+    **	from this buffer, which is filled with one large read.
+    */
+    static int ReadAheadWindow;
+
+    static RawFileStatsType Stats;
+
 protected:
     /*
     **	This function returns the largest size a low level DOS read or write may
@@ -129,6 +152,34 @@ private:
     **	This is the low level DOS handle. A -1 indicates an empty condition.
     */
     FILE* Handle;
+
+    int Raw_Read(void* buffer, int size);
+    int Read_Ahead(void* buffer, int size);
+
+    /*
+    **	Is the read-ahead buffer used for this file? It is only used for files opened for
+    **	reading, and only allocated once a read needs it.
+    */
+    unsigned IsReadAhead : 1;
+
+    /*
+    **	The read-ahead buffer holds ReadAheadFill bytes read from file offset ReadAheadStart,
+    **	of which the first ReadAheadIndex have been used. While it holds data, the true file
+    **	position is past the position the caller sees.
+    */
+    char* ReadAhead;
+    int ReadAheadSize;
+    int ReadAheadStart;
+    int ReadAheadFill;
+    int ReadAheadIndex;
+
+    /*
+    **	The true position of the file, and the position the last read ended at (-1 if there
+    **	has been no read since the file was opened). A read starting where the last one
+    **	ended is taken to be part of a sequential stream.
+    */
+    int FilePos;
+    int ReadEnd;
 };
 
 /***********************************************************************************************
@@ -174,6 +225,14 @@ inline RawFileClass::RawFileClass(void)
     , BiasLength(-1)
     , Handle(nullptr)
     , Filename(0)
+    , IsReadAhead(false)
+    , ReadAhead(nullptr)
+    , ReadAheadSize(0)
+    , ReadAheadStart(0)
+    , ReadAheadFill(0)
+    , ReadAheadIndex(0)
+    , FilePos(0)
+    , ReadEnd(-1)
 {
 }
 
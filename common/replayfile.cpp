@@ -0,0 +1,182 @@
+#include "replayfile.h"
+#include "wwfile.h"
+
+ReplayFileClass::ReplayFileClass(void)
+    : File(NULL)
+{
+}
+
+/*
+**	Starts using a file that is already open. Nothing is read or written yet.
+*/
+void ReplayFileClass::Open(FileClass* file)
+{
+    File = file;
+    Blocks.Clear();
+}
+
+void ReplayFileClass::Close(void)
+{
+    File = NULL;
+    Blocks.Clear();
+}
+
+void ReplayFileClass::Write_Header(void)
+{
+    int magic = MAGIC;
+    int version = VERSION;
+
+    File->Write(&magic, sizeof(magic));
+    File->Write(&version, sizeof(version));
+}
+
+/*
+**	Reads the magic value and version from the current position. Returns false if the file
+**	is not in this format; the position it is left at is then undefined.
+*/
+bool ReplayFileClass::Read_Header(void)
+{
+    int magic = 0;
+    int version = 0;
+
+    File->Read(&magic, sizeof(magic));
+    File->Read(&version, sizeof(version));
+    return (magic == MAGIC && version == VERSION);
+}
+
+/*
+**	Leaves room for a block header at the current position and returns where it goes. The
+**	header is only written by End_Block(), once the length of the data is known.
+*/
+int ReplayFileClass::Begin_Block(void)
+{
+    int offset = File->Seek(0, SEEK_CUR);
+
+    File->Seek(sizeof(BlockHeader), SEEK_CUR);
+    return (offset);
+}
+
+/*
+**	Writes the header of a block that was started at offset, now that everything up to the
+**	current position is its data, and adds it to the index.
+*/
+void ReplayFileClass::End_Block(int offset, int type, int frame, int size)
+{
+    BlockHeader header;
+    IndexEntry entry;
+    int end = File->Seek(0, SEEK_CUR);
+
+    header.Type = type;
+    header.Frame = frame;
+    header.Size = size;
+    header.Length = end - offset - sizeof(header);
+    File->Seek(offset, SEEK_SET);
+    File->Write(&header, sizeof(header));
+    File->Seek(end, SEEK_SET);
+
+    entry.Type = type;
+    entry.Frame = frame;
+    entry.Offset = offset;
+    Blocks.Add(entry);
+}
+
+/*
+**	Writes the index of every block and the trailer that locates it. Nothing more can be
+**	added to the file after this.
+*/
+void ReplayFileClass::Write_Index(int frame)
+{
+    BlockHeader header;
+    int offset = File->Seek(0, SEEK_CUR);
+    int magic = MAGIC;
+
+    header.Type = BLOCK_INDEX;
+    header.Frame = frame;
+    header.Size = 0;
+    header.Length = Blocks.Count() * sizeof(IndexEntry);
+
+    File->Write(&header, sizeof(header));
+    for (int index = 0; index < Blocks.Count(); index++) {
+        File->Write(&Blocks[index], sizeof(IndexEntry));
+    }
+    File->Write(&offset, sizeof(offset));
+    File->Write(&magic, sizeof(magic));
+}
+
+/*
+**	Finds every block, starting with the one at the current position. The index is used if
+**	the trailer is there. A file that was never closed, or was cut short, has no trailer, so
+**	the block headers are scanned instead. The file is left at the first block.
+*/
+void ReplayFileClass::Read_Index(void)
+{
+    BlockHeader header;
+    IndexEntry entry;
+    int start = File->Seek(0, SEEK_CUR);
+    int size = File->Size();
+    int offset = 0;
+    int magic = 0;
+
+    Blocks.Clear();
+
+    if (size >= start + (int)(sizeof(offset) + sizeof(magic))) {
+        File->Seek(size - (sizeof(offset) + sizeof(magic)), SEEK_SET);
+        File->Read(&offset, sizeof(offset));
+        File->Read(&magic, sizeof(magic));
+    }
+
+    if (magic == MAGIC && offset >= start && offset < size) {
+        File->Seek(offset, SEEK_SET);
+        if (File->Read(&header, sizeof(header)) == sizeof(header) && header.Type == BLOCK_INDEX) {
+            for (int index = 0; index < header.Length / (int)sizeof(IndexEntry); index++) {
+                if (File->Read(&entry, sizeof(entry)) != sizeof(entry)) {
+                    break;
+                }
+                Blocks.Add(entry);
+            }
+        }
+    } else {
+        offset = start;
+        for (;;) {
+            File->Seek(offset, SEEK_SET);
+            if (File->Read(&header, sizeof(header)) != sizeof(header) || header.Type == BLOCK_INDEX
+                || header.Length < 0 || offset + (int)sizeof(header) + header.Length > size) {
+                break;
+            }
+            entry.Type = header.Type;
+            entry.Frame = header.Frame;
+            entry.Offset = offset;
+            Blocks.Add(entry);
+            offset += sizeof(header) + header.Length;
+        }
+    }
+
+    File->Seek(start, SEEK_SET);
+}
+
+/*
+**	Moves to the data of the block in the index entry. Returns false if the block there is
+**	not of the type expected or does not fit in the file.
+*/
+bool ReplayFileClass::Read_Block(IndexEntry const& entry, int type, BlockHeader& header)
+{
+    File->Seek(entry.Offset, SEEK_SET);
+    if (File->Read(&header, sizeof(header)) != sizeof(header) || header.Type != type || header.Length < 0) {
+        return (false);
+    }
+    return (entry.Offset + (int)sizeof(header) + header.Length <= File->Size());
+}
+
+/*
+**	Reads the header of the block at the current position and leaves the file at its data.
+**	Returns false at the index, at the end of the file, or at a block cut short.
+*/
+bool ReplayFileClass::Next_Block(BlockHeader& header)
+{
+    int offset = File->Seek(0, SEEK_CUR);
+
+    if (File->Read(&header, sizeof(header)) != sizeof(header) || header.Type == BLOCK_INDEX || header.Length < 0) {
+        return (false);
+    }
+    return (offset + (int)sizeof(header) + header.Length <= File->Size());
+}
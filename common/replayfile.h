@@ -0,0 +1,101 @@
+#ifndef REPLAYFILE_H
+#define REPLAYFILE_H
+
+#include "vector.h"
+
+class FileClass;
+
+/*
+**	The block container that recorded games are stored in. The file starts with a magic value
+**	and a version, followed by whatever values the game needs to start the same game again,
+**	and then the blocks. Each block is a BlockHeader and Length bytes of data. Closing the
+**	file adds an index block listing every block, and a trailer of the index block's offset
+**	and the magic value again. A file that was never closed has no trailer; its blocks are
+**	found by scanning the headers instead, up to the last block that is complete.
+**
+**	What goes in each block is up to the caller, which writes the data between Begin_Block()
+**	and End_Block(), and reads it after Read_Block() or Next_Block().
+*/
+class ReplayFileClass
+{
+public:
+    enum
+    {
+        MAGIC = 0x594C5052, // "RPLY"
+        VERSION = 1
+    };
+
+    typedef enum BlockType : int
+    {
+        BLOCK_FRAMES,
+        BLOCK_KEYFRAME,
+        BLOCK_INDEX
+    } BlockType;
+
+    /*
+    **	Every block in the file starts with this header. Size is the uncompressed length of
+    **	the data, if the caller needs it, and Length is the number of bytes in the file that
+    **	follow the header.
+    */
+    typedef struct BlockHeader
+    {
+        int Type;
+        int Frame;
+        int Size;
+        int Length;
+    } BlockHeader;
+
+    /*
+    **	One entry of the index; the block starting at file offset Offset.
+    */
+    typedef struct IndexEntry
+    {
+        int Type;
+        int Frame;
+        int Offset;
+
+        bool operator==(IndexEntry const& entry) const
+        {
+            return (Offset == entry.Offset);
+        }
+        bool operator!=(IndexEntry const& entry) const
+        {
+            return (Offset != entry.Offset);
+        }
+    } IndexEntry;
+
+    ReplayFileClass(void);
+
+    void Open(FileClass* file);
+    void Close(void);
+
+    void Write_Header(void);
+    bool Read_Header(void);
+
+    int Begin_Block(void);
+    void End_Block(int offset, int type, int frame, int size);
+    void Write_Index(int frame);
+
+    void Read_Index(void);
+    bool Read_Block(IndexEntry const& entry, int type, BlockHeader& header);
+    bool Next_Block(BlockHeader& header);
+
+    int Count(void) const
+    {
+        return (Blocks.Count());
+    }
+    IndexEntry const& operator[](int index) const
+    {
+        return (Blocks[index]);
+    }
+
+private:
+    FileClass* File;
+
+    /*
+    **	Every block in the file, in file order.
+    */
+    DynamicVectorClass<IndexEntry> Blocks;
+};
+
+#endif /* REPLAYFILE_H */
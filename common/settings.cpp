@@ -32,6 +32,8 @@ SettingsClass::SettingsClass()
     Video.FrameLimit = 120;
     Video.InterpolationMode = 2;
     Video.HardwareCursor = false;
+    Video.RenderThread = false;
+    Video.MotionInterpolation = false;
     Video.DOSMode = false;
     Video.Scaler = "nearest";
     Video.Driver = "default";
@@ -71,6 +73,8 @@ void SettingsClass::Load(INIClass& ini)
     Video.Height = ini.Get_Int("Video", "Height", Video.Height);
     Video.FrameLimit = ini.Get_Int("Video", "FrameLimit", Video.FrameLimit);
     Video.HardwareCursor = ini.Get_Bool("Video", "HardwareCursor", Video.HardwareCursor);
+    Video.RenderThread = ini.Get_Bool("Video", "RenderThread", Video.RenderThread);
+    Video.MotionInterpolation = ini.Get_Bool("Video", "MotionInterpolation", Video.MotionInterpolation);
     Video.DOSMode = ini.Get_Bool("Video", "DOSMode", Video.DOSMode);
     Video.Scaler = ini.Get_String("Video", "Scaler", Video.Scaler);
     Video.Driver = ini.Get_String("Video", "Driver", Video.Driver);
@@ -118,6 +122,8 @@ void SettingsClass::Save(INIClass& ini)
     ini.Put_Int("Video", "Height", Video.Height);
     ini.Put_Int("Video", "FrameLimit", Video.FrameLimit);
     ini.Put_Bool("Video", "HardwareCursor", Video.HardwareCursor);
+    ini.Put_Bool("Video", "RenderThread", Video.RenderThread);
+    ini.Put_Bool("Video", "MotionInterpolation", Video.MotionInterpolation);
     ini.Put_Bool("Video", "DOSMode", Video.DOSMode);
     ini.Put_String("Video", "Scaler", Video.Scaler);
     ini.Put_String("Video", "Driver", Video.Driver);
@@ -32,6 +32,8 @@ public:
         int FrameLimit;
         int InterpolationMode;
         bool HardwareCursor;
+        bool RenderThread;
+        bool MotionInterpolation;
         bool DOSMode;
         std::string Scaler;
         std::string Driver;
@@ -37,8 +37,11 @@
 
 /*= = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = = =*/
 
+#include "dirtyrect.h"
+#include "framelimit.h"
 #include "gbuffer.h"
 #include "palette.h"
+#include "palexpand.h"
 #include "video.h"
 #include "wwkeyboard.h"
 #include "wwmouse.h"
@@ -46,6 +49,12 @@
 #include "debugstring.h"
 
 #include <SDL.h>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string.h>
+#include <thread>
+#include <vector>
 
 extern WWKeyboardClass* Keyboard;
 static SDL_Window* window;
@@ -53,6 +62,8 @@ static SDL_Renderer* renderer;
 static SDL_Palette* palette;
 static Uint32 pixel_format;
 static SDL_Rect render_dst;
+static bool palette_changed = true;
+static SDL_PixelFormat* palette_format;
 
 static struct
 {
@@ -118,6 +129,9 @@ Uint32 SettingsPixelFormat()
 }
 
 static void Update_HWCursor();
+static void Stop_Present_Thread();
+static bool Pause_Present_Thread();
+static void Resume_Present_Thread(bool paused);
 
 static void Update_HWCursor_Settings()
 {
@@ -315,7 +329,14 @@ bool Set_Video_Mode(int w, int h, int bits_per_pixel)
 #ifdef __vita__
     renderer = SDL_CreateRenderer(window, renderer_index, SDL_RENDERER_TARGETTEXTURE | SDL_RENDERER_PRESENTVSYNC);
 #else
-    renderer = SDL_CreateRenderer(window, renderer_index, SDL_RENDERER_TARGETTEXTURE);
+    /*
+    ** Waiting for vsync only holds up the presentation thread when there is one, so ask for it then.
+    */
+    Uint32 renderer_flags = SDL_RENDERER_TARGETTEXTURE;
+    if (Settings.Video.RenderThread) {
+        renderer_flags |= SDL_RENDERER_PRESENTVSYNC;
+    }
+    renderer = SDL_CreateRenderer(window, renderer_index, renderer_flags);
 #endif
     if (renderer == nullptr) {
         DBG_ERROR("SDL_CreateRenderer failed: %s", SDL_GetError());
@@ -367,6 +388,21 @@ bool Set_Video_Mode(int w, int h, int bits_per_pixel)
                  (pixel_format == info.texture_formats[i] ? " (selected)" : ""));
     }
 
+    /*
+    ** 32-bit formats are expanded from 8-bit through a table of the palette in that format,
+    ** anything else is left to SDL_BlitSurface.
+    */
+    if (palette_format) {
+        SDL_FreeFormat(palette_format);
+        palette_format = nullptr;
+    }
+
+    if (SDL_BYTESPERPIXEL(pixel_format) == 4) {
+        palette_format = SDL_AllocFormat(pixel_format);
+        DBG_INFO("  palette expansion: %s", Palette_Expand_Kernel());
+    }
+    palette_changed = true;
+
     /*
     ** Set requested scaling algorithm.
     */
@@ -402,6 +438,12 @@ bool Set_Video_Mode(int w, int h, int bits_per_pixel)
 
 void Toggle_Video_Fullscreen()
 {
+    /*
+    ** SDL updates the renderer as the window changes, on this thread, so the presentation thread
+    ** must not be using it meanwhile.
+    */
+    bool paused = Pause_Present_Thread();
+
     Settings.Video.Windowed = !Settings.Video.Windowed;
 
     if (!Settings.Video.Windowed) {
@@ -416,7 +458,10 @@ void Toggle_Video_Fullscreen()
         SDL_SetWindowSize(window, Settings.Video.WindowWidth, Settings.Video.WindowHeight);
     }
 
+    palette_changed = true;
     Update_HWCursor_Settings();
+
+    Resume_Present_Thread(paused);
 }
 
 void Get_Video_Scale(float& x, float& y)
@@ -529,6 +574,11 @@ SDL_Rect Get_Render_Rect()
  *=============================================================================================*/
 void Reset_Video_Mode(void)
 {
+    /*
+    ** The presentation thread must be done with the renderer before it goes.
+    */
+    Stop_Present_Thread();
+
     if (hwcursor.Pending) {
         SDL_FreeCursor(hwcursor.Pending);
         hwcursor.Pending = nullptr;
@@ -550,6 +600,11 @@ void Reset_Video_Mode(void)
     SDL_FreePalette(palette);
     palette = nullptr;
 
+    if (palette_format) {
+        SDL_FreeFormat(palette_format);
+        palette_format = nullptr;
+    }
+
     SDL_DestroyWindow(window);
     window = nullptr;
 
@@ -720,6 +775,11 @@ void Set_DD_Palette(void* rpalette)
 
     SDL_SetPaletteColors(palette, colors, 0, 256);
 
+    /*
+    ** Every pixel on screen may have changed colour, so the next frame is converted in full.
+    */
+    palette_changed = true;
+
     /*
     ** Cursor needs to be updated when palette changes.
     */
@@ -765,6 +825,578 @@ SurfaceMonitorClass::SurfaceMonitorClass()
     SurfacesRestored = false;
 }
 
+static FrameStatsClass PresentStats;
+
+/*
+** Converts 8-bit frames to the window format, draws the software cursor over them and presents
+** them. Only the parts of a frame that changed are converted and uploaded.
+*/
+class FramePresenterClass
+{
+public:
+    FramePresenterClass()
+        : windowSurface(nullptr)
+        , texture(nullptr)
+        , cursorRect{0, 0, 0, 0}
+        , presentStart()
+        , presents(0)
+        , presentTime(0)
+        , presentArea(0)
+    {
+    }
+
+    ~FramePresenterClass()
+    {
+        Free();
+    }
+
+    bool Init(int w, int h)
+    {
+        Free();
+
+        windowSurface = SDL_CreateRGBSurfaceWithFormat(0, w, h, SDL_BITSPERPIXEL(pixel_format), pixel_format);
+        if (windowSurface == nullptr) {
+            return false;
+        }
+
+        texture = SDL_CreateTexture(renderer, windowSurface->format->format, SDL_TEXTUREACCESS_STREAMING, w, h);
+        if (texture == nullptr) {
+            Free();
+            return false;
+        }
+
+        return dirty.Init(w, h);
+    }
+
+    void Free()
+    {
+        if (texture) {
+            SDL_DestroyTexture(texture);
+            texture = nullptr;
+        }
+
+        if (windowSurface) {
+            SDL_FreeSurface(windowSurface);
+            windowSurface = nullptr;
+        }
+
+        dirty.Free();
+        cursorRect.w = 0;
+    }
+
+    DirtyRectClass& Get_Dirty()
+    {
+        return dirty;
+    }
+
+    /*
+    ** Converts and uploads the frame and draws it. It is shown once Flip() is called.
+    */
+    void Present(SDL_Surface* surface,
+                 SDL_Palette* colors,
+                 bool palette_changed,
+                 SDL_Surface* cursor,
+                 SDL_Rect cursor_dst,
+                 SDL_Rect const& dst,
+                 FrameOverlayType const& overlay)
+    {
+        if (windowSurface == nullptr) {
+            return;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        presentStart = start;
+
+        if (palette_changed) {
+            Update_Palette_Table(colors);
+            dirty.Add_All();
+        }
+
+        /*
+        ** The software cursor was drawn over the last frame, so what was under it must be
+        ** converted again.
+        */
+        if (cursorRect.w > 0) {
+            dirty.Add(Rect(cursorRect.x, cursorRect.y, cursorRect.w, cursorRect.h));
+            cursorRect.w = 0;
+        }
+
+        /*
+        ** Only the parts of the surface that changed are converted and uploaded.
+        */
+        bool expand = palette_format != nullptr && windowSurface->format->format == palette_format->format;
+
+        SDL_LockSurface(surface);
+        int count = dirty.Find((unsigned char*)surface->pixels, surface->pitch);
+
+        for (int i = 0; i < count; i++) {
+            Rect const& rect = dirty.Get_Rect(i);
+
+            if (expand) {
+                Palette_Expand(paletteTable,
+                               (Uint8*)surface->pixels + rect.Y * surface->pitch + rect.X,
+                               surface->pitch,
+                               (Uint8*)windowSurface->pixels + rect.Y * windowSurface->pitch + rect.X * 4,
+                               windowSurface->pitch,
+                               rect.Width,
+                               rect.Height);
+            } else {
+                SDL_Rect src = {rect.X, rect.Y, rect.Width, rect.Height};
+                SDL_Rect dst = src;
+
+                SDL_BlitSurface(surface, &src, windowSurface, &dst);
+            }
+        }
+        SDL_UnlockSurface(surface);
+
+        if (cursor != nullptr) {
+            /*
+            ** Draw software emulated cursor.
+            */
+            SDL_BlitSurface(cursor, nullptr, windowSurface, &cursor_dst);
+
+            /*
+            ** SDL_BlitSurface clipped cursor_dst to the part actually drawn.
+            */
+            cursorRect = cursor_dst;
+        }
+
+        for (int i = 0; i < count; i++) {
+            Update_Texture(dirty.Get_Rect(i));
+        }
+
+        if (cursorRect.w > 0) {
+            Update_Texture(Rect(cursorRect.x, cursorRect.y, cursorRect.w, cursorRect.h));
+        }
+
+        Measure_Present(start, dirty.Get_Area());
+
+        SDL_RenderClear(renderer);
+        SDL_RenderCopy(renderer, texture, NULL, &dst);
+        if (overlay.Visible) {
+            Draw_Overlay(overlay);
+        }
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+        SDL_RenderFlush(renderer);
+#endif
+    }
+
+    /*
+    ** Shows the frame drawn by Present(). This is where vsync waits.
+    */
+    void Flip()
+    {
+        if (windowSurface == nullptr) {
+            return;
+        }
+
+        SDL_RenderPresent(renderer);
+
+        PresentStats.Add(
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - presentStart)
+                .count());
+    }
+
+private:
+    /*
+    ** Draws the frame time histograms as bar graphs in the top left corner of the window, one
+    ** above the other, with a line where the frame limit falls.
+    */
+    void Draw_Overlay(FrameOverlayType const& overlay)
+    {
+        enum
+        {
+            OVERLAY_MARGIN = 8,
+            OVERLAY_BAR_WIDTH = 3,
+            OVERLAY_HEIGHT = 48
+        };
+
+        static SDL_Color const colors[FH_COUNT] = {
+            {0x40, 0xFF, 0x40, 0xFF},
+            {0x40, 0xA0, 0xFF, 0xFF},
+            {0xFF, 0xC0, 0x40, 0xFF},
+        };
+
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+
+        for (int which = 0; which < FH_COUNT; which++) {
+            SDL_Rect panel = {OVERLAY_MARGIN,
+                              OVERLAY_MARGIN + which * (OVERLAY_HEIGHT + OVERLAY_MARGIN),
+                              FrameHistogramClass::BUCKETS * OVERLAY_BAR_WIDTH,
+                              OVERLAY_HEIGHT};
+
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0xA0);
+            SDL_RenderFillRect(renderer, &panel);
+
+            SDL_SetRenderDrawColor(renderer, colors[which].r, colors[which].g, colors[which].b, colors[which].a);
+            for (int bucket = 0; bucket < FrameHistogramClass::BUCKETS; bucket++) {
+                int height = overlay.Bars[which][bucket] * OVERLAY_HEIGHT / 255;
+
+                if (height > 0) {
+                    SDL_Rect bar = {panel.x + bucket * OVERLAY_BAR_WIDTH,
+                                    panel.y + OVERLAY_HEIGHT - height,
+                                    OVERLAY_BAR_WIDTH - 1,
+                                    height};
+                    SDL_RenderFillRect(renderer, &bar);
+                }
+            }
+
+            if (overlay.Target >= 0) {
+                int x = panel.x + overlay.Target * OVERLAY_BAR_WIDTH;
+
+                SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0xFF, 0xFF);
+                SDL_RenderDrawLine(renderer, x, panel.y, x, panel.y + OVERLAY_HEIGHT - 1);
+            }
+        }
+
+        /*
+        ** SDL_RenderClear uses the draw colour, so put back the black it expects.
+        */
+        SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0xFF);
+    }
+
+    /*
+    ** Maps the palette to the window format the same way SDL_BlitSurface does, alpha included.
+    */
+    void Update_Palette_Table(SDL_Palette* colors)
+    {
+        if (palette_format == nullptr) {
+            return;
+        }
+
+        for (int i = 0; i < 256; i++) {
+            SDL_Color const& color = colors->colors[i];
+            paletteTable[i] = SDL_MapRGBA(palette_format, color.r, color.g, color.b, color.a);
+        }
+    }
+
+    void Update_Texture(Rect const& rect)
+    {
+        SDL_Rect area = {rect.X, rect.Y, rect.Width, rect.Height};
+        Uint8* pixels = (Uint8*)windowSurface->pixels + rect.Y * windowSurface->pitch
+                        + rect.X * windowSurface->format->BytesPerPixel;
+
+        SDL_UpdateTexture(texture, &area, pixels, windowSurface->pitch);
+    }
+
+    /*
+    ** Notes the time taken to convert and upload a frame, and every so often logs the
+    ** average together with how much of the surface changed, so the cost of a present can
+    ** be compared between a still screen and scrolling.
+    */
+    void Measure_Present(std::chrono::steady_clock::time_point start, int area)
+    {
+        enum
+        {
+            PRESENT_LOG_RATE = 600
+        };
+
+        presentTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start)
+                           .count();
+        presentArea += area;
+
+        if (++presents == PRESENT_LOG_RATE) {
+            DBG_INFO("RenderSurface: %d us per present, %d%% of the surface updated.",
+                     (int)(presentTime / presents),
+                     (int)(presentArea * 100 / ((long long)presents * windowSurface->w * windowSurface->h)));
+            presents = 0;
+            presentTime = 0;
+            presentArea = 0;
+        }
+    }
+
+    SDL_Surface* windowSurface;
+    SDL_Texture* texture;
+    DirtyRectClass dirty;
+    SDL_Rect cursorRect;
+    uint32_t paletteTable[256];
+    std::chrono::steady_clock::time_point presentStart;
+    int presents;
+    long long presentTime;
+    long long presentArea;
+};
+
+/*
+** Presents frames on a thread of its own, so that the game thread never waits for the conversion
+** or for vsync. The game thread hands over a copy of the finished 8-bit frame together with the
+** palette and the software cursor. There are two copies, one being presented while the other is
+** filled; a frame that is replaced before the thread got to it is dropped. While the thread runs
+** it is the only one that uses the renderer, except for SDL itself as the game thread pumps the
+** window events, which Pump_Events keeps apart from the drawing.
+*/
+class PresentThreadClass
+{
+public:
+    PresentThreadClass()
+        : Pending(&Frames[0])
+        , Current(&Frames[1])
+        , Palette(nullptr)
+        , IsNew(false)
+        , IsStarting(false)
+        , IsRunning(false)
+        , IsQuitting(false)
+    {
+        for (int i = 0; i < ARRAY_SIZE(Frames); i++) {
+            Frames[i].Surface = nullptr;
+        }
+    }
+
+    ~PresentThreadClass()
+    {
+        Stop();
+    }
+
+    bool Start(int w, int h)
+    {
+        Stop();
+
+        Palette = SDL_AllocPalette(256);
+        if (Palette == nullptr) {
+            return false;
+        }
+
+        for (int i = 0; i < ARRAY_SIZE(Frames); i++) {
+            Frames[i].Surface = SDL_CreateRGBSurface(0, w, h, 8, 0, 0, 0, 0);
+            if (Frames[i].Surface == nullptr) {
+                Free_Frames();
+                return false;
+            }
+            SDL_SetSurfacePalette(Frames[i].Surface, Palette);
+            Frames[i].PaletteChanged = false;
+            Frames[i].CursorW = 0;
+            Frames[i].CursorH = 0;
+        }
+
+        /*
+        ** An OpenGL context can only be current on one thread at a time, so the game thread lets
+        ** go of it and the renderer takes it up again on the presentation thread.
+        */
+        if (SDL_GetWindowFlags(window) & SDL_WINDOW_OPENGL) {
+            SDL_GL_MakeCurrent(window, nullptr);
+        }
+
+        IsNew = false;
+        IsQuitting = false;
+        IsStarting = true;
+        Thread = std::thread(&PresentThreadClass::Run, this, w, h);
+
+        std::unique_lock<std::mutex> lock(Mutex);
+        Signal.wait(lock, [this] { return !IsStarting; });
+        lock.unlock();
+
+        if (!IsRunning) {
+            Thread.join();
+            Free_Frames();
+            return false;
+        }
+        return true;
+    }
+
+    void Stop()
+    {
+        if (Thread.joinable()) {
+            {
+                std::lock_guard<std::mutex> lock(Mutex);
+                IsQuitting = true;
+            }
+            Signal.notify_all();
+            Thread.join();
+        }
+
+        IsRunning = false;
+        Free_Frames();
+    }
+
+    bool Is_Running() const
+    {
+        return IsRunning;
+    }
+
+    /*
+    ** SDL's renderer watches the window events and updates itself from whichever thread pumps
+    ** them, so they are never pumped while a frame is being uploaded and drawn. The lock is not
+    ** held while the frame is shown and vsync waits, so this only ever waits for a short time.
+    */
+    void Pump_Events()
+    {
+        std::lock_guard<std::mutex> lock(RenderMutex);
+        SDL_PumpEvents();
+    }
+
+    void Submit(SDL_Surface* surface,
+                SDL_Palette* colors,
+                bool palette_changed,
+                SDL_Surface* cursor,
+                SDL_Rect cursor_dst,
+                SDL_Rect const& dst,
+                FrameOverlayType const& overlay)
+    {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+
+            /*
+            ** A frame still waiting is replaced, but a palette change in it must not be lost.
+            */
+            if (IsNew) {
+                PresentStats.Drop();
+            } else {
+                Pending->PaletteChanged = false;
+            }
+
+            SDL_Surface* copy = Pending->Surface;
+            SDL_LockSurface(surface);
+            for (int y = 0; y < surface->h; y++) {
+                Uint8* from = (Uint8*)surface->pixels + y * surface->pitch;
+                memcpy((Uint8*)copy->pixels + y * copy->pitch, from, surface->w);
+            }
+            SDL_UnlockSurface(surface);
+
+            if (palette_changed) {
+                memcpy(Pending->Colors, colors->colors, sizeof(Pending->Colors));
+                Pending->PaletteChanged = true;
+            }
+
+            Pending->CursorW = 0;
+            Pending->CursorH = 0;
+            if (cursor != nullptr) {
+                Pending->Cursor.resize(cursor->w * cursor->h);
+                for (int y = 0; y < cursor->h; y++) {
+                    memcpy(&Pending->Cursor[y * cursor->w], (Uint8*)cursor->pixels + y * cursor->pitch, cursor->w);
+                }
+                Pending->CursorW = cursor->w;
+                Pending->CursorH = cursor->h;
+                Pending->CursorDst = cursor_dst;
+            }
+
+            Pending->RenderDst = dst;
+            Pending->Overlay = overlay;
+            IsNew = true;
+        }
+        Signal.notify_one();
+    }
+
+private:
+    struct FrameType
+    {
+        SDL_Surface* Surface;
+        SDL_Color Colors[256];
+        bool PaletteChanged;
+        std::vector<Uint8> Cursor;
+        int CursorW;
+        int CursorH;
+        SDL_Rect CursorDst;
+        SDL_Rect RenderDst;
+        FrameOverlayType Overlay;
+    };
+
+    void Run(int w, int h)
+    {
+        bool ready = Presenter.Init(w, h);
+
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            IsRunning = ready;
+            IsStarting = false;
+        }
+        Signal.notify_all();
+
+        while (ready) {
+            {
+                std::unique_lock<std::mutex> lock(Mutex);
+                Signal.wait(lock, [this] { return IsNew || IsQuitting; });
+
+                if (IsQuitting) {
+                    break;
+                }
+
+                std::swap(Pending, Current);
+                IsNew = false;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(RenderMutex);
+                Present_Frame(*Current);
+            }
+            Presenter.Flip();
+        }
+
+        Presenter.Free();
+
+        if (SDL_GetWindowFlags(window) & SDL_WINDOW_OPENGL) {
+            SDL_GL_MakeCurrent(window, nullptr);
+        }
+    }
+
+    void Present_Frame(FrameType& frame)
+    {
+        SDL_Surface* cursor = nullptr;
+
+        if (frame.PaletteChanged) {
+            SDL_SetPaletteColors(Palette, frame.Colors, 0, 256);
+        }
+
+        if (frame.CursorW > 0) {
+            cursor =
+                SDL_CreateRGBSurfaceFrom(&frame.Cursor[0], frame.CursorW, frame.CursorH, 8, frame.CursorW, 0, 0, 0, 0);
+            if (cursor != nullptr) {
+                SDL_SetSurfacePalette(cursor, Palette);
+                SDL_SetColorKey(cursor, SDL_TRUE, 0);
+            }
+        }
+
+        /*
+        ** What the game drew is only known by comparing, as its blits were made to the original.
+        */
+        Presenter.Get_Dirty().Touch();
+        Presenter.Present(
+            frame.Surface, Palette, frame.PaletteChanged, cursor, frame.CursorDst, frame.RenderDst, frame.Overlay);
+
+        SDL_FreeSurface(cursor);
+    }
+
+    void Free_Frames()
+    {
+        for (int i = 0; i < ARRAY_SIZE(Frames); i++) {
+            if (Frames[i].Surface) {
+                SDL_FreeSurface(Frames[i].Surface);
+                Frames[i].Surface = nullptr;
+            }
+        }
+
+        if (Palette) {
+            SDL_FreePalette(Palette);
+            Palette = nullptr;
+        }
+    }
+
+    FramePresenterClass Presenter;
+    FrameType Frames[2];
+    FrameType* Pending;
+    FrameType* Current;
+    SDL_Palette* Palette;
+
+    std::thread Thread;
+    std::mutex Mutex;
+    std::condition_variable Signal;
+    bool IsNew;
+    bool IsStarting;
+    bool IsRunning;
+    bool IsQuitting;
+
+    /*
+    ** Held while a frame is uploaded and drawn and while the game thread pumps the events.
+    */
+    std::mutex RenderMutex;
+};
+
+static PresentThreadClass PresentThread;
+
+static void Stop_Present_Thread()
+{
+    PresentThread.Stop();
+}
+
 /*
 ** VideoSurfaceDDraw
 */
@@ -776,15 +1408,12 @@ class VideoSurfaceSDL2 : public VideoSurface
 public:
     VideoSurfaceSDL2(int w, int h, GBC_Enum flags)
         : flags(flags)
-        , windowSurface(nullptr)
-        , texture(nullptr)
     {
         surface = SDL_CreateRGBSurface(0, w, h, 8, 0, 0, 0, 0);
         SDL_SetSurfacePalette(surface, palette);
 
         if (flags & GBC_VISIBLE) {
-            windowSurface = SDL_CreateRGBSurfaceWithFormat(0, w, h, SDL_BITSPERPIXEL(pixel_format), pixel_format);
-            texture = SDL_CreateTexture(renderer, windowSurface->format->format, SDL_TEXTUREACCESS_STREAMING, w, h);
+            Start_Presenting();
             frontSurface = this;
         }
     }
@@ -792,18 +1421,11 @@ public:
     virtual ~VideoSurfaceSDL2()
     {
         if (frontSurface == this) {
+            PresentThread.Stop();
             frontSurface = nullptr;
         }
 
         SDL_FreeSurface(surface);
-
-        if (texture) {
-            SDL_DestroyTexture(texture);
-        }
-
-        if (windowSurface) {
-            SDL_FreeSurface(windowSurface);
-        }
     }
 
     virtual void* GetData() const
@@ -836,25 +1458,56 @@ public:
     virtual bool Unlock()
     {
         SDL_UnlockSurface(surface);
+
+        /*
+        ** Anything could have been drawn while it was locked.
+        */
+        if (flags & GBC_VISIBLE) {
+            presenter.Get_Dirty().Touch();
+        }
         return true;
     }
 
     virtual void Blt(const Rect& destRect, VideoSurface* src, const Rect& srcRect, bool mask)
     {
         SDL_BlitSurface(((VideoSurfaceSDL2*)src)->surface, (SDL_Rect*)(&srcRect), surface, (SDL_Rect*)&destRect);
+
+        if (flags & GBC_VISIBLE) {
+            presenter.Get_Dirty().Add(destRect);
+        }
     }
 
     virtual void FillRect(const Rect& rect, unsigned char color)
     {
         SDL_FillRect(surface, (SDL_Rect*)(&rect), color);
+
+        if (flags & GBC_VISIBLE) {
+            presenter.Get_Dirty().Add(rect);
+        }
     }
 
-    void RenderSurface()
+    /*
+    ** Presents on the presentation thread if it is wanted and starts, or on the game thread.
+    */
+    void Start_Presenting()
     {
-        void* pixels;
-        int pitch;
+        if (Settings.Video.RenderThread) {
+            if (PresentThread.Start(surface->w, surface->h)) {
+                DBG_INFO("Presenting on a separate thread");
+            } else {
+                DBG_WARN("Presentation thread failed to start, presenting on the game thread");
+            }
+        }
 
-        SDL_BlitSurface(surface, NULL, windowSurface, NULL);
+        if (!PresentThread.Is_Running()) {
+            presenter.Init(surface->w, surface->h);
+        }
+    }
+
+    void RenderSurface()
+    {
+        SDL_Surface* cursor = nullptr;
+        SDL_Rect cursor_dst = {0, 0, 0, 0};
 
         if (Settings.Video.HardwareCursor) {
             /*
@@ -877,34 +1530,65 @@ public:
             SDL_ShowCursor(!Get_Mouse_State());
         } else if (!Get_Mouse_State() && hwcursor.Surface != nullptr) {
             /*
-            ** Draw software emulated cursor.
+            ** Software emulated cursor is drawn over the frame when it is presented.
             */
             int x, y;
-            SDL_Rect dst;
 
             Get_Video_Mouse(x, y);
 
-            dst.x = x - hwcursor.HotX;
-            dst.y = y - hwcursor.HotY;
-            dst.w = hwcursor.Surface->w;
-            dst.h = hwcursor.Surface->h;
-
-            SDL_BlitSurface(hwcursor.Surface, nullptr, windowSurface, &dst);
+            cursor_dst.x = x - hwcursor.HotX;
+            cursor_dst.y = y - hwcursor.HotY;
+            cursor_dst.w = hwcursor.Surface->w;
+            cursor_dst.h = hwcursor.Surface->h;
+            cursor = hwcursor.Surface;
         }
 
-        SDL_UpdateTexture(texture, NULL, windowSurface->pixels, windowSurface->pitch);
-        SDL_RenderClear(renderer);
-        SDL_RenderCopy(renderer, texture, NULL, &render_dst);
-        SDL_RenderPresent(renderer);
+        FrameOverlayType overlay;
+        Get_Frame_Overlay(overlay);
+
+        if (PresentThread.Is_Running()) {
+            PresentThread.Submit(surface, palette, palette_changed, cursor, cursor_dst, render_dst, overlay);
+        } else {
+            presenter.Present(surface, palette, palette_changed, cursor, cursor_dst, render_dst, overlay);
+            presenter.Flip();
+        }
+        palette_changed = false;
     }
 
 private:
     SDL_Surface* surface;
-    SDL_Surface* windowSurface;
-    SDL_Texture* texture;
     GBC_Enum flags;
+
+    FramePresenterClass presenter;
 };
 
+/*
+** Stops the presentation thread while the game thread changes the window. Returns whether it was
+** running, to be handed to Resume_Present_Thread once the change is made.
+*/
+static bool Pause_Present_Thread()
+{
+    bool paused = PresentThread.Is_Running();
+
+    PresentThread.Stop();
+    return paused;
+}
+
+static void Resume_Present_Thread(bool paused)
+{
+    if (paused && frontSurface) {
+        frontSurface->Start_Presenting();
+    }
+}
+
+/*
+** Pumps the SDL events on the game thread, out of the way of the presentation thread.
+*/
+void Video_Pump_Events()
+{
+    PresentThread.Pump_Events();
+}
+
 void Video_Render_Frame()
 {
     if (frontSurface) {
@@ -912,6 +1596,19 @@ void Video_Render_Frame()
     }
 }
 
+/*
+** Makes the next frame convert and upload the whole surface.
+*/
+void Video_Refresh_Frame()
+{
+    palette_changed = true;
+}
+
+FrameStatsType Video_Present_Stats(bool reset)
+{
+    return PresentStats.Get(reset);
+}
+
 /*
 ** Video
 */
@@ -18,6 +18,7 @@
 #include <alc.h>
 #include <algorithm>
 #include <chrono>
+#include <mutex>
 
 int AudioFlags;
 int TimerIntCount;
@@ -27,6 +28,14 @@ int TickOffset;
 unsigned VQAAudioPaused;
 VQAHandle* AudioVQAHandle;
 
+/*
+**	The movie decoder thread copies audio and queues it with OpenAL as it loads frames, while
+**	the main thread reads the timer and starts, stops and pauses the audio. Everything here that
+**	touches the audio state or the OpenAL source holds this lock. It is recursive since some of
+**	these call each other.
+*/
+static std::recursive_mutex AudioMutex;
+
 // 8192 has some chopping issues, like its not overlapping correctlying between each chunk?
 // 8192 * 4 seems to fix the above for the short sample but there is still slight chopping when INTRO is played.
 #define BUFFER_CHUNK_SIZE 8192 * 4 // was 8192 in RA 8192 is 186ms?
@@ -137,6 +146,8 @@ bool Queue_Audio(ALuint buffer)
 
 void VQA_AudioCallback()
 {
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     if (!VQAAudioPaused && AudioVQAHandle) {
         VQAConfig* config = &AudioVQAHandle->Config;
         VQAData* data = AudioVQAHandle->VQABuf;
@@ -244,6 +255,8 @@ int VQA_StartAudio(VQAHandle* handle)
     VQAData* data = handle->VQABuf;
     VQAAudio* audio = &data->Audio;
 
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     AudioVQAHandle = handle;
 
     // Audio already started, abort.
@@ -293,6 +306,8 @@ void VQA_StopAudio(VQAHandle* handle)
     VQAData* data = handle->VQABuf;
     VQAAudio* audio = &data->Audio;
 
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     if (AudioFlags & VQA_AUDIO_FLAG_AUDIO_DMA_TIMER && alIsSource(audio->OpenALSource)) {
         ALint queued = -1;
         alGetSourcei(audio->OpenALSource, AL_BUFFERS_QUEUED, &queued);
@@ -316,6 +331,8 @@ void VQA_StopAudio(VQAHandle* handle)
 
 void VQA_PauseAudio()
 {
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     if (AudioVQAHandle) {
         VQAData* data = AudioVQAHandle->VQABuf;
 
@@ -336,6 +353,8 @@ void VQA_PauseAudio()
 
 void VQA_ResumeAudio()
 {
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     if (AudioVQAHandle) {
         VQAData* data = AudioVQAHandle->VQABuf;
         if (data) {
@@ -360,6 +379,8 @@ int VQA_CopyAudio(VQAHandle* handle)
     VQAData* data = handle->VQABuf;
     VQAAudio* audio = &data->Audio;
 
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     VQA_AudioCallback();
 
     if (config->OptionFlags & 1) {
@@ -409,6 +430,8 @@ int VQA_CopyAudio(VQAHandle* handle)
 
 void VQA_SetTimer(VQAHandle* handle, int time, int method)
 {
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     if (method == -1) {
         if (AudioFlags & VQA_AUDIO_FLAG_AUDIO_DMA_TIMER) {
             method = VQA_AUDIO_TIMER_METHOD_DMA;
@@ -435,6 +458,8 @@ void VQA_SetTimer(VQAHandle* handle, int time, int method)
 
 unsigned VQA_GetTime(VQAHandle* handle)
 {
+    std::lock_guard<std::recursive_mutex> lock(AudioMutex);
+
     auto now = std::chrono::steady_clock::now().time_since_epoch();
     unsigned result_time =
         unsigned(TickOffset + 60 * (std::chrono::duration_cast<std::chrono::milliseconds>(now).count()) / 1000);
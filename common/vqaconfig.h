@@ -38,6 +38,7 @@ enum VQAOptionEnum
     VQAOPTF_CAPTIONS = 1 << 7,
     VQAOPTF_EVA = 1 << 8,
     VQA_OPTION_512 = 1 << 9,
+    VQAOPTF_DECODETHREAD = 1 << 10, // Decode frames ahead on a thread, drawing only copies them.
 };
 
 enum VQALanguageType
@@ -17,7 +17,16 @@
 #include "vqafile.h"
 #include "vqaloader.h"
 #include "vqapalette.h"
+#include "vqaring.h"
+#include "worker.h"
+#include <chrono>
 #include <string.h>
+#include <thread>
+
+/*
+**	Only one movie plays at a time, so one decoder thread serves them all.
+*/
+static WorkerClass DecodeWorker;
 
 int VQA_DrawFrame_Buffer(VQAHandle* handle)
 {
@@ -75,6 +84,201 @@ int VQA_DrawFrame_Buffer(VQAHandle* handle)
     return VQAERR_NONE;
 }
 
+/*
+**	Copies the next decoded frame out of the ring. The timing and frame skipping follow
+**	VQA_SelectFrame, but since a decoded frame doesn't depend on the ones before it, any late
+**	frame can be dropped in favour of a newer one, not just those up to the next key frame.
+**	Frames dropped are counted in NumSkipped and frames shown a whole frame or more after
+**	their time are counted in NumLate.
+*/
+int VQA_DrawFrame_Ring(VQAHandle* handle)
+{
+    VQAConfig* config = &handle->Config;
+    VQAData* vqabuf = handle->VQABuf;
+    VQADrawer* drawer = &vqabuf->Drawer;
+    VQAFrameRingClass* ring = vqabuf->Ring;
+    VQADecodedFrame* frame = ring->Peek();
+
+    if (frame == nullptr) {
+        ++drawer->WaitsOnLoader;
+        return VQAERR_NOBUFFER;
+    }
+
+    if (!(config->OptionFlags & VQAOPTF_SINGLESTEP)) {
+        unsigned curtime = VQA_GetTime(handle);
+        int desiredframe = config->DrawRate * curtime / 60;
+        drawer->DesiredFrame = desiredframe;
+
+        if (config->DrawRate == config->FrameRate) {
+            if (frame->FrameNum > desiredframe) {
+                return VQAERR_NOT_TIME;
+            }
+        } else if (60u / config->DrawRate > curtime - drawer->LastTime) {
+            return VQAERR_NOT_TIME;
+        }
+
+        if (!(config->DrawFlags & VQACFGF_NOSKIP)) {
+            VQADecodedFrame* next;
+
+            while (frame->FrameNum < desiredframe && (next = ring->Peek(1)) != nullptr
+                   && next->FrameNum <= desiredframe) {
+                if (frame->PaletteSize > 0) {
+                    memcpy(drawer->Palette, frame->Palette, frame->PaletteSize);
+                    drawer->CurPalSize = frame->PaletteSize;
+                    drawer->Flags |= 1;
+                }
+
+                if (config->DrawerCallback != nullptr) {
+                    config->DrawerCallback(nullptr, frame->FrameNum);
+                }
+
+                ring->Release();
+                frame = next;
+                ++drawer->NumSkipped;
+            }
+        }
+
+        if (frame->FrameNum < desiredframe) {
+            ++drawer->NumLate;
+        }
+
+        drawer->LastTime = curtime;
+    }
+
+    drawer->LastFrame = frame->FrameNum;
+
+    /*
+    **	The palette is set from the drawer's copy, since the slot is handed back to the decoder
+    **	before the palette is actually set.
+    */
+    if (frame->PaletteSize > 0) {
+        memcpy(drawer->Palette, frame->Palette, frame->PaletteSize);
+        drawer->CurPalSize = frame->PaletteSize;
+        drawer->Flags |= 1;
+    }
+
+    if (drawer->Flags & 1) {
+        VQA_Flag_To_Set_Palette(drawer->Palette, drawer->CurPalSize, (config->OptionFlags & VQAOPTF_SLOWPAL));
+        drawer->Flags &= ~1;
+    }
+
+    int width = handle->Header.ImageWidth;
+    uint8_t* dest = drawer->ImageBuf + drawer->ScreenOffset;
+
+    for (int y = 0; y < handle->Header.ImageHeight; y++) {
+        memcpy(dest + y * drawer->ImageWidth, frame->Image + y * width, width);
+    }
+
+    int framenum = frame->FrameNum;
+    drawer->LastFrameNum = framenum;
+    ring->Release();
+
+    if (config->DrawerCallback != nullptr) {
+        if (config->DrawerCallback(drawer->ImageBuf, framenum)) {
+            return VQAERR_ERROR;
+        }
+    }
+
+    return VQAERR_NONE;
+}
+
+/*
+**	The decoder thread. This does what VQA_Play and VQA_DrawFrame_Buffer do on the main thread
+**	up to the point of drawing: it loads frames into the frame nodes, decompresses them and
+**	un-VQs them into the ring. Loading carries on while the ring is full, as it is also what
+**	feeds the audio. The audio code locks its own state, as the main thread keeps reading the
+**	movie timer and starting, stopping and pausing the audio meanwhile.
+*/
+static void VQA_DecodeFrames(void* data)
+{
+    VQAHandle* handle = (VQAHandle*)data;
+    VQAData* vqabuf = handle->VQABuf;
+    VQADrawer* drawer = &vqabuf->Drawer;
+    VQAFrameRingClass* ring = vqabuf->Ring;
+    bool loaded_all = false;
+
+    while (!ring->Is_Stopped()) {
+        int rc = VQAERR_NONE;
+
+        if (!loaded_all) {
+            rc = VQA_LoadFrame(handle);
+
+            if (rc == VQAERR_NONE) {
+                ++vqabuf->LoadedFrames;
+            } else if (rc != VQAERR_NOBUFFER && rc != VQAERR_SLEEPING) {
+                loaded_all = true;
+            }
+        }
+
+        VQAFrameNode* curframe = drawer->CurFrame;
+
+        if (!(curframe->Flags & 1)) {
+            if (loaded_all) {
+                ring->Finish();
+                break;
+            }
+
+            if (rc != VQAERR_NONE) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            continue;
+        }
+
+        VQADecodedFrame* frame = ring->Begin_Write(rc == VQAERR_NONE ? 0 : 2);
+
+        if (frame == nullptr) {
+            continue;
+        }
+
+        VQA_PrepareFrame(vqabuf);
+
+        vqabuf->UnVQ(curframe->Codebook->Buffer,
+                     curframe->Pointers,
+                     frame->Image,
+                     drawer->BlocksPerRow,
+                     drawer->NumRows,
+                     handle->Header.ImageWidth);
+
+        frame->PaletteSize = 0;
+
+        if (curframe->Flags & 4) {
+            memcpy(frame->Palette, curframe->Palette, curframe->PaletteSize);
+            frame->PaletteSize = curframe->PaletteSize;
+        }
+
+        frame->FrameNum = curframe->FrameNum;
+        frame->IsKey = (curframe->Flags & 2) != 0;
+
+        curframe->Flags = 0;
+        drawer->CurFrame = curframe->Next;
+        ring->End_Write();
+    }
+}
+
+void VQA_StartDecoder(VQAHandle* handle)
+{
+    VQAFrameRingClass* ring = handle->VQABuf->Ring;
+
+    if (ring != nullptr && !ring->Is_Finished()) {
+        ring->Start();
+        DecodeWorker.Submit(VQA_DecodeFrames, handle);
+    }
+}
+
+/*
+**	Stops the decoder thread. The frames it has decoded stay in the ring for when playing is
+**	resumed.
+*/
+void VQA_StopDecoder(VQAHandle* handle)
+{
+    VQAFrameRingClass* ring = handle->VQABuf->Ring;
+
+    if (ring != nullptr) {
+        ring->Stop();
+        DecodeWorker.Wait();
+    }
+}
+
 int DrawFrame_Nop(VQAHandle* handle)
 {
     return VQAERR_NONE;
@@ -241,6 +445,22 @@ void VQA_ConfigureDrawer(VQAHandle* handle)
 
     data->Draw_Frame = VQA_DrawFrame_Buffer;
     data->Drawer.ScreenOffset = data->Drawer.X1 + data->Drawer.Y1 * data->Drawer.ImageWidth;
+
+    if ((handle->Config.OptionFlags & VQAOPTF_DECODETHREAD) && data->UnVQ != UnVQ_Nop) {
+        int image_size = handle->Header.ImageWidth * handle->Header.ImageHeight;
+
+        if (data->Ring == nullptr) {
+            data->Ring = new VQAFrameRingClass;
+            data->MemUsed += handle->Config.NumFrameBufs * (sizeof(VQADecodedFrame) + image_size);
+        }
+
+        if (data->Ring->Init(handle->Config.NumFrameBufs, image_size)) {
+            data->Draw_Frame = VQA_DrawFrame_Ring;
+        } else {
+            delete data->Ring;
+            data->Ring = nullptr;
+        }
+    }
 }
 
 int VQA_SelectFrame(VQAHandle* handle)
@@ -54,6 +54,7 @@ typedef struct
     int LastFrameNum;
     int DesiredFrame;
     int NumSkipped;
+    int NumLate;
     int WaitsOnFlipper;
     int WaitsOnLoader;
 } VQADrawer;
@@ -64,5 +65,7 @@ void VQA_SetDrawBuffer(VQAHandle* handle, uint8_t* buffer, unsigned width, unsig
 void VQA_ConfigureDrawer(VQAHandle* handle);
 int VQA_SelectFrame(VQAHandle* handle);
 void VQA_PrepareFrame(VQAData* data);
+void VQA_StartDecoder(VQAHandle* handle);
+void VQA_StopDecoder(VQAHandle* handle);
 
 #endif
@@ -18,6 +18,7 @@
 #include "misc.h"
 #include "vqacaption.h"
 #include "vqaconfig.h"
+#include "vqaring.h"
 #include <stdlib.h>
 #include <string.h>
 
@@ -773,6 +774,10 @@ int VQA_Open(VQAHandle* handle, const char* filename, VQAConfig* config)
 
 void VQA_Close(VQAHandle* handle)
 {
+    if (handle->VQABuf) {
+        VQA_StopDecoder(handle);
+    }
+
     if (handle->Config.OptionFlags & 1) {
         VQA_CloseAudio(handle);
     } else {
@@ -1409,6 +1414,8 @@ VQAData* VQA_AllocBuffers(VQAHeader* header, VQAConfig* config)
 
 void VQA_FreeBuffers(VQAData* data, VQAConfig* config, VQAHeader* header)
 {
+    delete data->Ring;
+
     if (data->Foff != nullptr) {
         free(data->Foff);
     }
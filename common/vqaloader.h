@@ -24,6 +24,7 @@ typedef struct _VQAHandle VQAHandle;
 typedef struct _VQAConfig VQAConfig;
 typedef struct _VQACBNode VQACBNode;
 typedef struct _VQAFrameNode VQAFrameNode;
+class VQAFrameRingClass;
 
 typedef int (*DrawFrameFuncPtr)(VQAHandle*);
 typedef int (*PageFlipFuncPtr)(VQAHandle*);
@@ -179,6 +180,7 @@ typedef struct _VQAData
     VQAChunkHeader Chunk;
     VQADrawer Drawer;
     VQAFlipper Flipper;
+    VQAFrameRingClass* Ring; // Decoded frames, when decoding on a thread.
     unsigned Flags; // VQADataFlagEnum
     int* Foff;
     int VBIBit;
@@ -0,0 +1,146 @@
+#include "vqaring.h"
+#include <chrono>
+#include <stdlib.h>
+
+VQAFrameRingClass::VQAFrameRingClass(void)
+    : Frames(nullptr)
+    , Images(nullptr)
+    , Slots(0)
+    , Head(0)
+    , Used(0)
+    , IsFinished(false)
+    , IsStopped(false)
+{
+}
+
+VQAFrameRingClass::~VQAFrameRingClass(void)
+{
+    Free();
+}
+
+bool VQAFrameRingClass::Init(int slots, int image_size)
+{
+    Free();
+
+    if (slots <= 0 || image_size <= 0) {
+        return false;
+    }
+
+    Frames = (VQADecodedFrame*)calloc(slots, sizeof(VQADecodedFrame));
+    Images = (uint8_t*)malloc((size_t)slots * image_size);
+
+    if (Frames == nullptr || Images == nullptr) {
+        Free();
+        return false;
+    }
+
+    for (int index = 0; index < slots; index++) {
+        Frames[index].Image = Images + (size_t)index * image_size;
+    }
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    Slots = slots;
+    Head = 0;
+    Used = 0;
+    IsFinished = false;
+    IsStopped = false;
+    return true;
+}
+
+void VQAFrameRingClass::Free(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    free(Frames);
+    free(Images);
+    Frames = nullptr;
+    Images = nullptr;
+    Slots = 0;
+    Head = 0;
+    Used = 0;
+}
+
+VQADecodedFrame* VQAFrameRingClass::Begin_Write(int timeout)
+{
+    std::unique_lock<std::mutex> lock(Mutex);
+
+    Signal.wait_for(lock, std::chrono::milliseconds(timeout), [this] { return Used < Slots || IsStopped; });
+    if (IsStopped || Used == Slots) {
+        return nullptr;
+    }
+    return &Frames[(Head + Used) % Slots];
+}
+
+void VQAFrameRingClass::End_Write(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Used++;
+    }
+    Signal.notify_all();
+}
+
+void VQAFrameRingClass::Finish(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        IsFinished = true;
+    }
+    Signal.notify_all();
+}
+
+VQADecodedFrame* VQAFrameRingClass::Peek(int index)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+
+    if (index >= Used) {
+        return nullptr;
+    }
+    return &Frames[(Head + index) % Slots];
+}
+
+void VQAFrameRingClass::Release(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        if (Used == 0) {
+            return;
+        }
+        Head = (Head + 1) % Slots;
+        Used--;
+    }
+    Signal.notify_all();
+}
+
+int VQAFrameRingClass::Count(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    return Used;
+}
+
+bool VQAFrameRingClass::Is_Finished(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    return IsFinished;
+}
+
+void VQAFrameRingClass::Stop(void)
+{
+    {
+        std::lock_guard<std::mutex> lock(Mutex);
+        IsStopped = true;
+    }
+    Signal.notify_all();
+}
+
+void VQAFrameRingClass::Start(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    IsStopped = false;
+}
+
+bool VQAFrameRingClass::Is_Stopped(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    return IsStopped;
+}
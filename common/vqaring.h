@@ -0,0 +1,84 @@
+#ifndef VQARING_H
+#define VQARING_H
+
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+
+/*
+**	One decoded movie frame: the 8 bit image at the size of the movie, and the palette if the
+**	frame changes it.
+*/
+struct VQADecodedFrame
+{
+    uint8_t* Image;
+    uint8_t Palette[768];
+    int PaletteSize; // Zero if the frame keeps the current palette.
+    int FrameNum;
+    bool IsKey;
+};
+
+/*
+**	A small ring of decoded frames passed from the movie decoder thread to the thread that
+**	displays them. The decoder fills the slot from Begin_Write() and publishes it with
+**	End_Write(); the display side looks at the oldest frames with Peek() and frees them with
+**	Release(). A slot is only ever touched by one side at a time, so the images are copied
+**	without holding the lock.
+*/
+class VQAFrameRingClass
+{
+public:
+    VQAFrameRingClass(void);
+    ~VQAFrameRingClass(void);
+
+    bool Init(int slots, int image_size);
+    void Free(void);
+
+    /*
+    **	Decoder side. Begin_Write waits up to 'timeout' milliseconds for a free slot; it returns
+    **	NULL if there still isn't one or the ring has been stopped. Finish marks the end of the
+    **	movie.
+    */
+    VQADecodedFrame* Begin_Write(int timeout);
+    void End_Write(void);
+    void Finish(void);
+
+    /*
+    **	Display side. Peek returns the index'th oldest frame waiting, or NULL if there aren't
+    **	that many. Release frees the oldest one.
+    */
+    VQADecodedFrame* Peek(int index = 0);
+    void Release(void);
+    int Count(void);
+    bool Is_Finished(void);
+
+    /*
+    **	Stop wakes and turns away the decoder so that its thread can be joined; Start lets it
+    **	write again. Frames already in the ring are kept.
+    */
+    void Stop(void);
+    void Start(void);
+    bool Is_Stopped(void);
+
+    bool Is_Allocated(void) const
+    {
+        return (Slots > 0);
+    }
+
+private:
+    std::mutex Mutex;
+    std::condition_variable Signal;
+
+    VQADecodedFrame* Frames;
+    uint8_t* Images;
+    int Slots;
+    int Head;
+    int Used;
+    bool IsFinished;
+    bool IsStopped;
+
+    VQAFrameRingClass(VQAFrameRingClass const&);
+    VQAFrameRingClass& operator=(VQAFrameRingClass const&);
+};
+
+#endif /* VQARING_H */
@@ -15,7 +15,10 @@
 #include "vqadrawer.h"
 #include "vqafile.h"
 #include "vqaloader.h"
+#include "vqaring.h"
+#include <chrono>
 #include <string.h>
+#include <thread>
 
 bool VQAMovieDone = false;
 
@@ -111,6 +114,10 @@ VQAErrorType VQA_Play(VQAHandle* handle, VQAPlayMode mode)
             VQA_SetTimer(handle, data->EndTime, config->TimerMethod);
         }
 
+        if (mode != 1) {
+            VQA_StartDecoder(handle);
+        }
+
         while (mode != 1) {
             if (data->Flags & (VQA_DATA_FLAG_VIDEO_MEMORY_SET | VQA_DATA_FLAG_8)) {
                 break;
@@ -118,6 +125,14 @@ VQAErrorType VQA_Play(VQAHandle* handle, VQAPlayMode mode)
 
             if (data->Flags & VQA_DATA_FLAG_VIDEO_MEMORY_SET) {
                 ++VQAMovieDone;
+            } else if (data->Ring != nullptr) {
+                /*
+                **	The decoder thread does the loading; the movie is over once it has decoded
+                **	the last frame.
+                */
+                if (data->Ring->Is_Finished()) {
+                    data->Flags |= VQA_DATA_FLAG_VIDEO_MEMORY_SET;
+                }
             } else {
                 rc = (VQAErrorType)VQA_LoadFrame(handle);
 
@@ -134,8 +149,13 @@ VQAErrorType VQA_Play(VQAHandle* handle, VQAPlayMode mode)
 
             if (config->DrawFlags & 2) {
                 data->Flags |= VQA_DATA_FLAG_8;
-                drawer->CurFrame->Flags = 0;
-                drawer->CurFrame = drawer->CurFrame->Next;
+
+                if (data->Ring != nullptr) {
+                    data->Ring->Release();
+                } else {
+                    drawer->CurFrame->Flags = 0;
+                    drawer->CurFrame = drawer->CurFrame->Next;
+                }
 
             } else {
                 rc = (VQAErrorType)data->Draw_Frame(handle);
@@ -147,6 +167,9 @@ VQAErrorType VQA_Play(VQAHandle* handle, VQAPlayMode mode)
 
                     if (data->Flags & VQA_DATA_FLAG_VIDEO_MEMORY_SET && rc == VQAERR_NOBUFFER) {
                         data->Flags |= VQA_DATA_FLAG_8;
+                    } else if (data->Ring != nullptr) {
+                        // Give the decoder the processor rather than spin waiting for it.
+                        std::this_thread::sleep_for(std::chrono::milliseconds(1));
                     }
                 } else {
                     ++data->DrawnFrames;
@@ -163,6 +186,8 @@ VQAErrorType VQA_Play(VQAHandle* handle, VQAPlayMode mode)
                 // VQA_UpdateMono(handle);
             }
         }
+
+        VQA_StopDecoder(handle);
     } else {
         if (!(data->Flags & VQA_DATA_FLAG_64)) {
             data->Flags |= VQA_DATA_FLAG_64;
@@ -241,6 +266,7 @@ void VQA_GetStats(VQAHandle* handle, VQAStatistics* stats)
     stats->FramesLoaded = data->LoadedFrames;
     stats->FramesDrawn = data->DrawnFrames;
     stats->FramesSkipped = data->Drawer.NumSkipped;
+    stats->FramesLate = data->Drawer.NumLate;
     stats->MaxFrameSize = data->Loader.MaxFrameSize;
     stats->SamplesPlayed = data->Audio.SamplesPlayed;
 }
@@ -29,6 +29,7 @@ typedef struct _VQAStatistics
     int FramesLoaded;
     int FramesDrawn;
     int FramesSkipped;
+    int FramesLate;
     int MaxFrameSize;
     unsigned SamplesPlayed;
     unsigned MemUsed;
@@ -0,0 +1,72 @@
+#include "worker.h"
+
+WorkerClass::WorkerClass(void)
+    : Job(nullptr)
+    , Data(nullptr)
+    , IsRunning(false)
+    , IsQuitting(false)
+{
+}
+
+WorkerClass::~WorkerClass(void)
+{
+    if (Thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(Mutex);
+            IsQuitting = true;
+        }
+        Signal.notify_all();
+        Thread.join();
+    }
+}
+
+void WorkerClass::Submit(JobType job, void* data)
+{
+    std::unique_lock<std::mutex> lock(Mutex);
+
+    Signal.wait(lock, [this] { return Job == nullptr && !IsRunning; });
+    Job = job;
+    Data = data;
+
+    if (!Thread.joinable()) {
+        Thread = std::thread(&WorkerClass::Run, this);
+    }
+    lock.unlock();
+    Signal.notify_all();
+}
+
+void WorkerClass::Wait(void)
+{
+    std::unique_lock<std::mutex> lock(Mutex);
+    Signal.wait(lock, [this] { return Job == nullptr && !IsRunning; });
+}
+
+bool WorkerClass::Is_Busy(void)
+{
+    std::lock_guard<std::mutex> lock(Mutex);
+    return Job != nullptr || IsRunning;
+}
+
+void WorkerClass::Run(void)
+{
+    std::unique_lock<std::mutex> lock(Mutex);
+
+    for (;;) {
+        Signal.wait(lock, [this] { return Job != nullptr || IsQuitting; });
+        if (Job == nullptr) {
+            break;
+        }
+
+        JobType job = Job;
+        void* data = Data;
+        Job = nullptr;
+        IsRunning = true;
+
+        lock.unlock();
+        job(data);
+        lock.lock();
+
+        IsRunning = false;
+        Signal.notify_all();
+    }
+}
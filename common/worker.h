@@ -0,0 +1,49 @@
+#ifndef WORKER_H
+#define WORKER_H
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+/*
+**	Runs jobs on a background thread, one at a time and in the order they were submitted.
+**	The thread is started with the first job and lives until the worker is destroyed. A job
+**	must not touch anything the submitting thread uses until Wait() has returned.
+*/
+class WorkerClass
+{
+public:
+    typedef void (*JobType)(void* data);
+
+    WorkerClass(void);
+    ~WorkerClass(void);
+
+    /*
+    **	Queues a job. If the worker is already running one, this waits for it first.
+    */
+    void Submit(JobType job, void* data);
+
+    /*
+    **	Waits until the worker has finished every job submitted.
+    */
+    void Wait(void);
+
+    bool Is_Busy(void);
+
+private:
+    void Run(void);
+
+    std::thread Thread;
+    std::mutex Mutex;
+    std::condition_variable Signal;
+
+    JobType Job;
+    void* Data;
+    bool IsRunning;
+    bool IsQuitting;
+
+    WorkerClass(WorkerClass const&);
+    WorkerClass& operator=(WorkerClass const&);
+};
+
+#endif /* WORKER_H */
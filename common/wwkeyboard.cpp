@@ -71,6 +71,11 @@
 extern void Focus_Loss();
 extern void Focus_Restore();
 
+#ifdef SDL2_BUILD
+extern void Video_Refresh_Frame();
+extern void Video_Pump_Events();
+#endif
+
 /***********************************************************************************************
  * WWKeyboardClass::WWKeyBoardClass -- Construction for Westwood Keyboard Class                *
  *                                                                                             *
@@ -541,7 +546,16 @@ void WWKeyboardClass::Fill_Buffer_From_System(void)
 #endif
     SDL_Event event;
 
+#ifdef SDL2_BUILD
+    /*
+    ** The events are pumped by the video code, which keeps them apart from the presentation
+    ** thread, and are then only taken from the queue here.
+    */
+    Video_Pump_Events();
+    while (!Is_Buffer_Full() && SDL_PeepEvents(&event, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) > 0) {
+#else
     while (!Is_Buffer_Full() && SDL_PollEvent(&event)) {
+#endif
         unsigned short key;
         switch (event.type) {
         case SDL_QUIT:
@@ -619,6 +633,13 @@ void WWKeyboardClass::Fill_Buffer_From_System(void)
                 break;
             }
             break;
+        case SDL_RENDER_TARGETS_RESET:
+        case SDL_RENDER_DEVICE_RESET:
+            /*
+            ** The texture contents may have been lost.
+            */
+            Video_Refresh_Frame();
+            break;
         case SDL_MOUSEWHEEL:
             if (event.wheel.y > 0) { // scroll up
                 Put_Key_Message(VK_MOUSEWHEEL_UP, false);
@@ -31,6 +31,7 @@
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
  *   BufferPipe::Put -- Submit data to the buffered pipe segment.                              *
+ *   MemoryPipe::Put -- Submit data to the growing memory pipe segment.                        *
  *   FilePipe::Put -- Submit a block of data to the pipe.                                      *
  *   FilePipe::End -- End the file pipe handler.                                               *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -85,6 +86,56 @@ int BufferPipe::Put(void const* source, int slen)
     return (total);
 }
 
+//---------------------------------------------------------------------------------------------------------
+// MemoryPipe
+//---------------------------------------------------------------------------------------------------------
+
+MemoryPipe::~MemoryPipe(void)
+{
+    delete[] BufferPtr;
+    BufferPtr = NULL;
+}
+
+/***********************************************************************************************
+ * MemoryPipe::Put -- Submit data to the growing memory pipe segment.                          *
+ *                                                                                             *
+ *    The data is appended to the buffer. When it doesn't fit, the buffer is doubled in size   *
+ *    (as often as needed), so a large amount of data only causes a few allocations.           *
+ *                                                                                             *
+ * INPUT:   source   -- Pointer to the data to submit.                                         *
+ *                                                                                             *
+ *          length   -- The number of bytes to be submitted.                                   *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes stored.                                           *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+int MemoryPipe::Put(void const* source, int slen)
+{
+    if (source == NULL || slen < 1) {
+        return (0);
+    }
+
+    if (Length + slen > Size) {
+        int size = (Size > 0) ? Size : 0x10000;
+        while (size < Length + slen) {
+            size *= 2;
+        }
+
+        char* buffer = new char[size];
+        if (Length > 0) {
+            memcpy(buffer, BufferPtr, Length);
+        }
+        delete[] BufferPtr;
+        BufferPtr = buffer;
+        Size = size;
+    }
+
+    memcpy(&BufferPtr[Length], source, slen);
+    Length += slen;
+    return (slen);
+}
+
 //---------------------------------------------------------------------------------------------------------
 // FilePipe
 //---------------------------------------------------------------------------------------------------------
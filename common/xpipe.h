@@ -74,6 +74,46 @@ private:
     BufferPipe& operator=(BufferPipe const& pipe);
 };
 
+/*
+**	This is a store-into-memory pipe terminator like BufferPipe, except that the buffer grows to
+**	hold whatever is put into it. The memory is kept when the pipe is cleared, so a pipe that is
+**	used over and over only allocates until it has reached the largest size needed.
+*/
+class MemoryPipe : public Pipe
+{
+public:
+    MemoryPipe(void)
+        : BufferPtr(NULL)
+        , Size(0)
+        , Length(0)
+    {
+    }
+    virtual ~MemoryPipe(void);
+
+    virtual int Put(void const* source, int slen);
+
+    void Clear(void)
+    {
+        Length = 0;
+    }
+    void const* Get_Buffer(void) const
+    {
+        return (BufferPtr);
+    }
+    int Get_Length(void) const
+    {
+        return (Length);
+    }
+
+private:
+    char* BufferPtr;
+    int Size;
+    int Length;
+
+    MemoryPipe(MemoryPipe& rvalue);
+    MemoryPipe& operator=(MemoryPipe const& pipe);
+};
+
 /*
 **	This is a store-to-file pipe terminator. Use it as the final link in a pipe process that
 **	needs to store the data to a file. This can only serve as the last link in the chain
@@ -0,0 +1,349 @@
+#ifndef ZONEUPDATE_H
+#define ZONEUPDATE_H
+
+#include <string.h>
+#include <vector>
+
+/*
+**	Keeps the zones of a map up to date as cells become passable or blocked, without flood
+**	filling the whole map again. The zones always come out exactly as a fresh fill would leave
+**	them, zone numbers included, so updating them here is only a shortcut.
+**
+**	The fresh fill is the one Zone_Reset makes. It visits the cells in order and starts a new
+**	zone at each passable cell that has no zone yet, so every zone starts at its lowest cell and
+**	the zones are numbered in the order they start. The fill itself runs along each row and then
+**	looks at the cells above and below the run, from one cell left of it to its last cell. This
+**	joins a run to the row next to it diagonally on its left but not on its right, and so whether
+**	two cells touching at a corner share a zone depends on the order in which they are found.
+**
+**	A change can therefore only affect the zones from the lowest one that touches a changed
+**	cell, or that starts after a newly passable cell. Those zones are filled again in the same
+**	way. Once everything that was changed has been accounted for and exactly the cells of the old
+**	zones so far have been filled, the rest of the fill can only repeat the old zones, and they
+**	are renumbered instead.
+**
+**	The map type must provide:
+**
+**	    int Cells(void) const
+**	        The number of cells, which are numbered from 0 row by row.
+**
+**	    int X(int cell) const
+**	    int Y(int cell) const
+**	    int XY(int x, int y) const
+**	        Convert between cell numbers and coordinates.
+**
+**	    bool Inside(int x, int y) const
+**	        Does the cell lie within the part of the map that is filled?
+**
+**	    bool Clear(int cell) const
+**	        Is the cell inside and passable to the zone type?
+**
+**	    unsigned char& Zone(int cell)
+**	        The zone number of a cell.
+*/
+template <class MAP> class ZoneUpdateClass
+{
+public:
+    enum
+    {
+        ZONES = 256
+    };
+
+    ZoneUpdateClass(void);
+
+    /*
+    **	Records the zones after they have been filled from scratch. When the fill ran out of zone
+    **	numbers, the zones cannot be updated in place and Update() always fails until the next
+    **	fill. Any changed cells noted before the fill are forgotten.
+    */
+    void Recount(MAP& map, bool overflow);
+
+    bool Is_Overflow(void) const
+    {
+        return Overflow;
+    }
+
+    /*
+    **	Notes a cell that may have become passable or blocked. It is taken into account by the
+    **	next call to Update().
+    */
+    void Changed(MAP& map, int cell);
+
+    /*
+    **	Brings the zones up to date for every cell noted since the last update. Returns false if
+    **	the zone numbers would run out, and the zones must then be filled from scratch.
+    */
+    bool Update(MAP& map);
+
+private:
+    void Tally(MAP& map);
+    void Span(MAP& map, int cell, int zone);
+
+    int Counts[ZONES];
+    int Seeds[ZONES];
+    int Zones;
+    bool Overflow;
+
+    std::vector<int> Pending;
+    std::vector<unsigned char> IsPending;
+
+    /*
+    **	Scratch state for an update. It is shared by every zone type of the map.
+    */
+    static std::vector<unsigned char> Old;
+    static std::vector<int> Stack;
+    static std::vector<int> Opened;
+    static std::vector<int> Closed;
+    static int Filled;
+    static int OpenFilled;
+    static int Highest;
+};
+
+template <class MAP> std::vector<unsigned char> ZoneUpdateClass<MAP>::Old;
+template <class MAP> std::vector<int> ZoneUpdateClass<MAP>::Stack;
+template <class MAP> std::vector<int> ZoneUpdateClass<MAP>::Opened;
+template <class MAP> std::vector<int> ZoneUpdateClass<MAP>::Closed;
+template <class MAP> int ZoneUpdateClass<MAP>::Filled = 0;
+template <class MAP> int ZoneUpdateClass<MAP>::OpenFilled = 0;
+template <class MAP> int ZoneUpdateClass<MAP>::Highest = 0;
+
+template <class MAP>
+ZoneUpdateClass<MAP>::ZoneUpdateClass(void)
+    : Zones(0)
+    , Overflow(false)
+{
+    memset(Counts, 0, sizeof(Counts));
+    memset(Seeds, 0, sizeof(Seeds));
+}
+
+template <class MAP> void ZoneUpdateClass<MAP>::Recount(MAP& map, bool overflow)
+{
+    Tally(map);
+    Overflow = overflow;
+
+    for (size_t index = 0; index < Pending.size(); index++) {
+        IsPending[Pending[index]] = false;
+    }
+    Pending.clear();
+}
+
+/*
+**	Counts the cells of each zone and finds the cell each zone starts at.
+*/
+template <class MAP> void ZoneUpdateClass<MAP>::Tally(MAP& map)
+{
+    memset(Counts, 0, sizeof(Counts));
+    Zones = 0;
+    for (int cell = 0; cell < map.Cells(); cell++) {
+        int zone = map.Zone(cell);
+        if (Counts[zone]++ == 0) {
+            Seeds[zone] = cell;
+        }
+        if (zone > Zones) {
+            Zones = zone;
+        }
+    }
+}
+
+template <class MAP> void ZoneUpdateClass<MAP>::Changed(MAP& map, int cell)
+{
+    if ((int)IsPending.size() != map.Cells()) {
+        IsPending.assign(map.Cells(), false);
+        Pending.clear();
+    }
+    if (!IsPending[cell]) {
+        IsPending[cell] = true;
+        Pending.push_back(cell);
+    }
+}
+
+/*
+**	The same fill as MapClass::Zone_Span, using a stack in place of recursion since the cells
+**	filled do not depend on the order the runs are visited in. It also keeps track of the old
+**	zones the cells filled came from.
+*/
+template <class MAP> void ZoneUpdateClass<MAP>::Span(MAP& map, int cell, int zone)
+{
+    Stack.clear();
+    Stack.push_back(cell);
+
+    while (!Stack.empty()) {
+        int here = Stack.back();
+        Stack.pop_back();
+        if (map.Zone(here) != 0 || !map.Clear(here))
+            continue;
+
+        int y = map.Y(here);
+        int xbegin = map.X(here);
+        int xend = xbegin;
+        while (map.Inside(xbegin - 1, y) && map.Zone(map.XY(xbegin - 1, y)) == 0 && map.Clear(map.XY(xbegin - 1, y))) {
+            xbegin--;
+        }
+        while (map.Inside(xend + 1, y) && map.Zone(map.XY(xend + 1, y)) == 0 && map.Clear(map.XY(xend + 1, y))) {
+            xend++;
+        }
+
+        for (int x = xbegin; x <= xend; x++) {
+            int next = map.XY(x, y);
+            map.Zone(next) = zone;
+            if (Old[next] != 0) {
+                Filled++;
+                if (Old[next] > Highest) {
+                    Highest = Old[next];
+                }
+            } else {
+                OpenFilled++;
+            }
+        }
+
+        for (int x = xbegin - 1; x <= xend; x++) {
+            if (map.Inside(x, y - 1)) {
+                Stack.push_back(map.XY(x, y - 1));
+            }
+            if (map.Inside(x, y + 1)) {
+                Stack.push_back(map.XY(x, y + 1));
+            }
+        }
+    }
+}
+
+template <class MAP> bool ZoneUpdateClass<MAP>::Update(MAP& map)
+{
+    if (Pending.empty()) {
+        return (true);
+    }
+    if (Overflow) {
+        return (false);
+    }
+
+    /*
+    **	Sort out the cells that really did change.
+    */
+    Opened.clear();
+    Closed.clear();
+    for (size_t index = 0; index < Pending.size(); index++) {
+        int cell = Pending[index];
+        IsPending[cell] = false;
+        bool clear = map.Clear(cell);
+        if (clear && map.Zone(cell) == 0) {
+            Opened.push_back(cell);
+        } else if (!clear && map.Zone(cell) != 0) {
+            Closed.push_back(cell);
+        }
+    }
+    Pending.clear();
+    if (Opened.empty() && Closed.empty()) {
+        return (true);
+    }
+
+    /*
+    **	Find the first zone that could come out differently. Every zone before it keeps its
+    **	cells and its number.
+    */
+    int first = Zones + 1;
+    int lowest = map.Cells();
+    for (size_t index = 0; index < Opened.size(); index++) {
+        if (Opened[index] < lowest) {
+            lowest = Opened[index];
+        }
+    }
+    for (int zone = 1; zone < first; zone++) {
+        if (Seeds[zone] > lowest) {
+            first = zone;
+            break;
+        }
+    }
+
+    int closed[ZONES];
+    int lastclosed = 0;
+    memset(closed, 0, sizeof(closed));
+    for (int pass = 0; pass < 2; pass++) {
+        std::vector<int>& cells = (pass == 0) ? Opened : Closed;
+        for (size_t index = 0; index < cells.size(); index++) {
+            int x = map.X(cells[index]);
+            int y = map.Y(cells[index]);
+            for (int dy = -1; dy <= 1; dy++) {
+                for (int dx = -1; dx <= 1; dx++) {
+                    if (map.Inside(x + dx, y + dy)) {
+                        int zone = map.Zone(map.XY(x + dx, y + dy));
+                        if (zone != 0 && zone < first) {
+                            first = zone;
+                        }
+                    }
+                }
+            }
+            if (pass == 1) {
+                int zone = map.Zone(cells[index]);
+                closed[zone]++;
+                if (zone > lastclosed) {
+                    lastclosed = zone;
+                }
+            }
+        }
+    }
+
+    /*
+    **	Clear the zones from that one on and fill them in again, just as the full fill would.
+    */
+    if ((int)Old.size() != map.Cells()) {
+        Old.resize(map.Cells());
+    }
+    for (int cell = 0; cell < map.Cells(); cell++) {
+        Old[cell] = map.Zone(cell);
+        if (Old[cell] >= first) {
+            map.Zone(cell) = 0;
+        }
+    }
+
+    Filled = 0;
+    OpenFilled = 0;
+    Highest = first - 1;
+    int expected = 0;
+    int counted = first - 1;
+    int zone = first;
+    int shift = 0;
+    bool caught = false;
+
+    for (int cell = (first > 1) ? Seeds[first - 1] + 1 : 0; cell < map.Cells(); cell++) {
+        if (map.Zone(cell) != 0 || !map.Clear(cell))
+            continue;
+
+        if (zone >= ZONES) {
+            return (false);
+        }
+        Span(map, cell, zone);
+
+        /*
+        **	Once the new zones so far hold every changed cell that is still passable, and
+        **	exactly the other cells of the old zones they overlap, the remaining cells are the
+        **	same as they were after the old zones got this far. The rest of the fill would
+        **	repeat the old zones that follow.
+        */
+        while (counted < Highest) {
+            counted++;
+            expected += Counts[counted] - closed[counted];
+        }
+        if (Filled == expected && OpenFilled == (int)Opened.size() && lastclosed <= Highest) {
+            shift = zone - Highest;
+            caught = true;
+            break;
+        }
+        zone++;
+    }
+
+    if (caught) {
+        if (Zones + shift >= ZONES) {
+            return (false);
+        }
+        for (int cell = 0; cell < map.Cells(); cell++) {
+            if (Old[cell] > Highest) {
+                map.Zone(cell) = Old[cell] + shift;
+            }
+        }
+    }
+
+    Tally(map);
+    return (true);
+}
+
+#endif /* ZONEUPDATE_H */
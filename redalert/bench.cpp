@@ -32,14 +32,29 @@
  * Functions:                                                                                  *
  *   Benchmark::Begin -- Start the benchmark operation.                                        *
  *   Benchmark::Benchmark -- Constructor for the benchmark object.                             *
+ *   Benchmark::Bucket_Index -- Fetch the histogram bucket for a duration.                     *
+ *   Benchmark::Bucket_Value -- Fetch the lowest duration held by a histogram bucket.          *
  *   Benchmark::End -- Mark the end of a benchmarked operation                                 *
+ *   Benchmark::Percentile -- Fetch the duration below which a percentage of events fall.      *
  *   Benchmark::Reset -- Clear out the benchmark statistics.                                   *
  *   Benchmark::Value -- Fetch the current average benchmark time.                             *
+ *   Heap_Churn -- Times object allocation and freeing in a heap the size of a game heap.      *
+ *   Write_Benchmarks -- Write the benchmark statistics to an INI file.                        *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
-#if (0)
-#include "bench.h"
-#include "mpu.h"
+#include "function.h"
+
+/*
+**	Section names used when writing the benchmark statistics. These must match the order
+**	of the BenchType enumeration.
+*/
+static char const* const BenchNames[BENCH_COUNT] = {
+    "GameFrame", "FindPath", "GreatestThreat", "AI",      "Cell",     "Sidebar",
+    "Radar",     "Tactical", "PCP",            "EvalObject", "EvalCell", "EvalWall",
+    "Power",     "Tabs",     "Shroud",         "Anims",   "Objects",  "Palette",
+    "GScreenRender", "BlitDisplay", "Mission", "Zone",    "Rules",    "Scenario",
+    "Snapshot", "Restore",
+};
 
 /***********************************************************************************************
  * Benchmark::Benchmark -- Constructor for the benchmark object.                               *
@@ -56,10 +71,8 @@
  *   07/18/1996 JLB : Created.                                                                 *
  *=============================================================================================*/
 Benchmark::Benchmark(void)
-    : Average(0)
-    , Counter(0)
-    , TotalCount(0)
 {
+    Reset();
 }
 
 /***********************************************************************************************
@@ -79,9 +92,10 @@ Benchmark::Benchmark(void)
  *=============================================================================================*/
 void Benchmark::Reset(void)
 {
-    Average = 0;
-    Counter = 0;
+    TotalTime = 0;
+    MaxTime = 0;
     TotalCount = 0;
+    memset(Buckets, 0, sizeof(Buckets));
 }
 
 /***********************************************************************************************
@@ -103,7 +117,7 @@ void Benchmark::Begin(bool reset)
 {
     if (reset)
         Reset();
-    Clock = 0;
+    Clock = std::chrono::steady_clock::now();
 }
 
 /***********************************************************************************************
@@ -124,15 +138,13 @@ void Benchmark::Begin(bool reset)
  *=============================================================================================*/
 void Benchmark::End(void)
 {
-    unsigned int value = Clock;
+    uint64_t value = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - Clock).count();
 
-    if (Counter == MAXIMUM_EVENT_COUNT) {
-        Average -= Average / MAXIMUM_EVENT_COUNT;
-        Average += value;
-    } else {
-        Average += value;
-        Counter++;
+    TotalTime += value;
+    if (value > MaxTime) {
+        MaxTime = value;
     }
+    Buckets[Bucket_Index(value)]++;
     TotalCount++;
 }
 
@@ -153,9 +165,213 @@ void Benchmark::End(void)
  *=============================================================================================*/
 unsigned int Benchmark::Value(void) const
 {
-    if (Counter) {
-        return (Average / Counter);
+    if (TotalCount) {
+        return (unsigned int)(TotalTime / TotalCount);
     }
     return (0);
 }
-#endif
\ No newline at end of file
+
+/***********************************************************************************************
+ * Benchmark::Percentile -- Fetch the duration below which a percentage of events fall.        *
+ *                                                                                             *
+ *    This walks the duration histogram until the requested fraction of all events has been    *
+ *    accounted for.                                                                           *
+ *                                                                                             *
+ * INPUT:   percent  -- The percentile to fetch (0..100).                                      *
+ *                                                                                             *
+ * OUTPUT:  Returns with the lower bound of the histogram bucket that holds the percentile.    *
+ *                                                                                             *
+ * WARNINGS:   The value is only as accurate as the bucket it falls in (about 3%).             *
+ *=============================================================================================*/
+uint64_t Benchmark::Percentile(int percent) const
+{
+    if (TotalCount == 0) {
+        return (0);
+    }
+
+    uint64_t rank = ((uint64_t)TotalCount * percent + 99) / 100;
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int index = 0; index < BUCKET_COUNT; index++) {
+        seen += Buckets[index];
+        if (seen >= rank) {
+            uint64_t value = Bucket_Value(index);
+            return (value < MaxTime ? value : MaxTime);
+        }
+    }
+    return (MaxTime);
+}
+
+/***********************************************************************************************
+ * Benchmark::Bucket_Index -- Fetch the histogram bucket for a duration.                       *
+ *                                                                                             *
+ *    Durations below SUB_BUCKETS map directly to a bucket. Above that, every power of two     *
+ *    is split into SUB_BUCKETS linear steps.                                                  *
+ *                                                                                             *
+ * INPUT:   time  -- The duration in nanoseconds.                                              *
+ *                                                                                             *
+ * OUTPUT:  Returns with the bucket index to use.                                              *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+int Benchmark::Bucket_Index(uint64_t time)
+{
+    if (time < SUB_BUCKETS) {
+        return ((int)time);
+    }
+
+    int msb = 0;
+    for (uint64_t value = time; value > 1; value >>= 1) {
+        msb++;
+    }
+    int shift = msb - SUB_BUCKET_BITS;
+    return ((shift + 1) * SUB_BUCKETS + (int)((time >> shift) - SUB_BUCKETS));
+}
+
+/***********************************************************************************************
+ * Benchmark::Bucket_Value -- Fetch the lowest duration held by a histogram bucket.            *
+ *                                                                                             *
+ * INPUT:   index -- The bucket index.                                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the duration in nanoseconds that the bucket starts at.                *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+uint64_t Benchmark::Bucket_Value(int index)
+{
+    if (index < SUB_BUCKETS) {
+        return (index);
+    }
+
+    int shift = index / SUB_BUCKETS - 1;
+    return ((uint64_t)(index % SUB_BUCKETS + SUB_BUCKETS) << shift);
+}
+
+/***********************************************************************************************
+ * Heap_Churn -- Times object allocation and freeing in a heap the size of a game heap.        *
+ *                                                                                             *
+ *    A scratch heap is filled to nine tenths of the limit and then, over and over, a random   *
+ *    object is freed and a new one allocated, the way bullets and animations come and go in  *
+ *    a large battle. The game heaps themselves are left alone.                                *
+ *                                                                                             *
+ * INPUT:   size  -- The size of the objects in the heap.                                      *
+ *                                                                                             *
+ *          count -- The number of objects the heap holds (the rules limit).                   *
+ *                                                                                             *
+ * OUTPUT:  Returns with the mean time of one free and allocate pair in nanoseconds.           *
+ *                                                                                             *
+ * WARNINGS:   The game random number generator is not used, so a benchmark run stays in step  *
+ *             with a normal one.                                                              *
+ *=============================================================================================*/
+static unsigned Heap_Churn(int size, int count)
+{
+    static int const PAIRS = 100000;
+
+    FixedIHeapClass heap(size);
+    if (count <= 0 || !heap.Set_Heap(count)) {
+        return (0);
+    }
+
+    for (int index = 0; index < count * 9 / 10; index++) {
+        heap.Allocate();
+    }
+
+    unsigned seed = 1;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int pair = 0; pair < PAIRS; pair++) {
+        seed = seed * 1103515245 + 12345;
+        if (heap.Count() > 0) {
+            heap.Free(heap.Active_Ptr((seed >> 16) % heap.Count()));
+        }
+        heap.Allocate();
+    }
+    std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+    return ((unsigned)(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / PAIRS));
+}
+
+/***********************************************************************************************
+ * Write_Benchmarks -- Write the benchmark statistics to an INI file.                          *
+ *                                                                                             *
+ *    This is called at the end of a "-BENCHMARK" run. Every probe that recorded at least one  *
+ *    event gets a section holding its count, mean, median, 99th percentile and maximum (all   *
+ *    in nanoseconds). The [Summary] section records the simulated tick rate and the           *
+ *    [HeapChurn] section the cost of freeing and allocating an object at the heap limits.     *
+ *                                                                                             *
+ * INPUT:   filename -- The name of the file to write.                                         *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the file written?                                                        *
+ *                                                                                             *
+ * WARNINGS:   Benches must have been allocated.                                               *
+ *=============================================================================================*/
+bool Write_Benchmarks(char const* filename)
+{
+    if (Benches == NULL) {
+        return (false);
+    }
+
+    INIClass ini;
+    char buffer[32];
+
+    Benchmark const& frame = Benches[BENCH_GAME_FRAME];
+    ini.Put_String("Summary", "Scenario", Scen.ScenarioName);
+    ini.Put_Int("Summary", "Ticks", frame.Count());
+    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)frame.Total());
+    ini.Put_String("Summary", "TotalNS", buffer);
+    double seconds = frame.Total() / 1000000000.0;
+    snprintf(buffer, sizeof(buffer), "%.2f", seconds > 0 ? frame.Count() / seconds : 0.0);
+    ini.Put_String("Summary", "TicksPerSecond", buffer);
+
+    for (int index = BENCH_FIRST; index < BENCH_COUNT; index++) {
+        Benchmark const& bench = Benches[index];
+        if (bench.Count() == 0) {
+            continue;
+        }
+        ini.Put_Int(BenchNames[index], "Count", bench.Count());
+        ini.Put_Int(BenchNames[index], "Mean", bench.Value());
+        snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)bench.Percentile(50));
+        ini.Put_String(BenchNames[index], "P50", buffer);
+        snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)bench.Percentile(99));
+        ini.Put_String(BenchNames[index], "P99", buffer);
+        snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)bench.Max());
+        ini.Put_String(BenchNames[index], "Max", buffer);
+    }
+
+    /*
+    **	With "-COMPAREPATHS", both path finders were run for every path request, so their
+    **	totals can be compared.
+    */
+    if (PathCompare.Requests > 0) {
+        ini.Put_String("PathCompare", "Active", Rule.IsAStarPath ? "AStar" : "Edge");
+        ini.Put_Int("PathCompare", "Requests", PathCompare.Requests);
+        ini.Put_Int("PathCompare", "EdgeLength", PathCompare.EdgeLength);
+        ini.Put_Int("PathCompare", "EdgeChecks", PathCompare.EdgeChecks);
+        ini.Put_Int("PathCompare", "EdgeFailed", PathCompare.EdgeFailed);
+        ini.Put_Int("PathCompare", "AStarLength", PathCompare.AStarLength);
+        ini.Put_Int("PathCompare", "AStarChecks", PathCompare.AStarChecks);
+        ini.Put_Int("PathCompare", "AStarExpanded", PathCompare.AStarExpanded);
+        ini.Put_Int("PathCompare", "AStarFailed", PathCompare.AStarFailed);
+    }
+    if (Rule.IsZonePath) {
+        ini.Put_Int("PathCompare", "ZonePlans", PathCompare.ZonePlans);
+        ini.Put_Int("PathCompare", "ZoneExpanded", PathCompare.ZoneExpanded);
+    }
+    if (Rule.IsPathCache) {
+        ini.Put_Int("PathCompare", "CacheHits", PathCompare.CacheHits);
+        ini.Put_Int("PathCompare", "CacheMisses", PathCompare.CacheMisses);
+    }
+
+    /*
+    **	Object heap churn at the rules limits.
+    */
+    ini.Put_Int("HeapChurn", "Anim", Heap_Churn(sizeof(AnimClass), Rule.AnimMax));
+    ini.Put_Int("HeapChurn", "Bullet", Heap_Churn(sizeof(BulletClass), Rule.BulletMax));
+    ini.Put_Int("HeapChurn", "Infantry", Heap_Churn(sizeof(InfantryClass), Rule.InfantryMax));
+    ini.Put_Int("HeapChurn", "Unit", Heap_Churn(sizeof(UnitClass), Rule.UnitMax));
+
+    CCFileClass file(filename);
+    return (ini.Save(file) > 0);
+}
@@ -34,54 +34,15 @@
 
 #ifndef BENCH_H
 #define BENCH_H
-#if (0)
 
-#include "mpu.h"
-#include "ftimer.h"
+#include <chrono>
+#include <stdint.h>
 
 /*
-**	The "bool" integral type was defined by the C++ committee in
-**	November of '94. Until the compiler supports this, use the following
-**	definition.
-*/
-#ifndef __BORLANDC__
-#ifndef TRUE_FALSE_DEFINED
-#define TRUE_FALSE_DEFINED
-enum
-{
-    false = 0,
-    true = 1
-};
-typedef int bool;
-#endif
-#endif
-
-/*
-**	This is a timer access object that will fetch the internal Pentium
-**	clock value.
-*/
-class PentiumTimerClass
-{
-public:
-    unsigned int operator()(void) const
-    {
-        unsigned int h;
-        unsigned int l = Get_CPU_Clock(h);
-        return ((l >> 4) | (h << 28));
-    }
-    operator unsigned int(void) const
-    {
-        unsigned int h;
-        unsigned int l = Get_CPU_Clock(h);
-        return ((l >> 4) | (h << 28));
-    }
-};
-
-/*
-**	A performance tracking tool object. It is used to track elapsed time. Unlike a simple clock, this
-**	class will keep a running average of the duration. Typical use of this would be to benchmark some
-**	process that occurs multiple times. By benchmarking an average time, inconsistencies in a particular
-**	run can be overcome.
+**	A performance tracking tool object. It is used to track elapsed time. Every event that is
+**	bracketed by Begin() and End() is added to a logarithmic histogram so that the count, mean,
+**	percentiles and maximum of the event duration can be retrieved afterwards. All times are
+**	expressed in nanoseconds.
 */
 class Benchmark
 {
@@ -97,42 +58,55 @@ public:
     {
         return (TotalCount);
     }
+    uint64_t Total(void) const
+    {
+        return (TotalTime);
+    }
+    uint64_t Max(void) const
+    {
+        return (MaxTime);
+    }
+    uint64_t Percentile(int percent) const;
 
 private:
     /*
-    **	The maximum number of events to keep running average of. If
-    **	events exceed this number, then older events drop off the
-    **	accumulated time. This number needs to be as small as
-    **	is reasonable. The larger this number gets, the less magnitude
-    **	that the benchmark timer can handle. Example; At a value of
-    **	256, the magnitude of the timer can only be 24 bits.
+    **	Each power of two is divided into this many linear sub buckets. This bounds the
+    **	error of a reported percentile to roughly 3% of its value.
     */
     enum
     {
-        MAXIMUM_EVENT_COUNT = 256
+        SUB_BUCKET_BITS = 5,
+        SUB_BUCKETS = 1 << SUB_BUCKET_BITS,
+        BUCKET_COUNT = (64 - SUB_BUCKET_BITS + 1) * SUB_BUCKETS
     };
 
+    static int Bucket_Index(uint64_t time);
+    static uint64_t Bucket_Value(int index);
+
     /*
-    **	This is the timer the is used to clock the events.
+    **	The time the current event was started.
     */
-    BasicTimerClass<PentiumTimerClass> Clock;
+    std::chrono::steady_clock::time_point Clock;
 
     /*
-    **	The total time off all events tracked so far.
+    **	The total time of all events tracked so far.
     */
-    unsigned int Average;
+    uint64_t TotalTime;
 
     /*
-    **	The total number of events tracked so far.
+    **	The longest single event tracked so far.
     */
-    unsigned int Counter;
+    uint64_t MaxTime;
 
     /*
-    **	Absolute total number of events (possibly greater than the
-    **	number of events tracked in the average).
+    **	Absolute total number of events.
     */
     unsigned int TotalCount;
+
+    /*
+    **	Number of events that fell into each duration bucket.
+    */
+    unsigned int Buckets[BUCKET_COUNT];
 };
 
 #endif
-#endif
\ No newline at end of file
@@ -535,6 +535,9 @@ void CellClass::Recalc_Attributes(void)
 {
     assert((unsigned)Cell_Number() <= MAP_CELL_TOTAL);
 
+    Invalidate_Path_Cache(Cell_Number());
+    Map.Zone_Mark(Cell_Number());
+
     /*
     **	Special override for interior terrain set so that a non-template or a clear template
     **	is equivalent to impassable rock.
@@ -596,6 +599,8 @@ void CellClass::Occupy_Down(ObjectClass* object)
     if (object == NULL)
         return;
 
+    Invalidate_Path_Cache(Cell_Number());
+
     /*
     **	Always add buildings to the end of the occupation chain. This is necessary because
     **	the occupation chain is a single list even though buildings occupy more than one
@@ -615,6 +620,7 @@ void CellClass::Occupy_Down(ObjectClass* object)
         object->Next = Cell_Occupier();
         OccupierPtr = object;
     }
+    Map.Threat_Down(Cell_Number(), object);
     Map.Radar_Pixel(Cell_Number());
 
     /*
@@ -656,6 +662,7 @@ void CellClass::Occupy_Down(ObjectClass* object)
 
     case RTTI_TERRAIN:
         Flag.Occupy.Monolith = true;
+        Map.Zone_Mark(Cell_Number());
         break;
 
     default:
@@ -688,13 +695,16 @@ void CellClass::Occupy_Up(ObjectClass* object)
     if (object == NULL)
         return;
 
+    Invalidate_Path_Cache(Cell_Number());
+
     ObjectClass* optr = Cell_Occupier(); // Working pointer to the objects in the chain.
 
+    bool found = false;
     if (optr == object) {
         OccupierPtr = object->Next;
         object->Next = 0;
+        found = true;
     } else {
-        bool found = false;
         while (optr != NULL) {
             if (optr->Next == object) {
                 optr->Next = object->Next;
@@ -706,6 +716,9 @@ void CellClass::Occupy_Up(ObjectClass* object)
         }
         //		assert(found);
     }
+    if (found) {
+        Map.Threat_Up(Cell_Number(), object);
+    }
     Map.Radar_Pixel(Cell_Number());
 
     /*
@@ -724,6 +737,7 @@ void CellClass::Occupy_Up(ObjectClass* object)
 
     case RTTI_TERRAIN:
         Flag.Occupy.Monolith = false;
+        Map.Zone_Mark(Cell_Number());
         break;
 
     default:
@@ -1814,9 +1828,9 @@ int CellClass::Reduce_Wall(int damage)
                     **	travellers.
                     */
                     if (wall.IsCrushable) {
-                        Map.Zone_Reset(MZONEF_NORMAL);
+                        Map.Zone_Change(Cell_Number(), MZONEF_NORMAL);
                     } else {
-                        Map.Zone_Reset(MZONEF_CRUSHER | MZONEF_NORMAL);
+                        Map.Zone_Change(Cell_Number(), MZONEF_CRUSHER | MZONEF_NORMAL);
                     }
                     return (true);
                 }
@@ -3381,4 +3395,5 @@ bool CellClass::Is_Jamming(HouseClass* player) const
 void CellClass::Override_Land_Type(LandType type)
 {
     OverrideLand = type;
+    Map.Zone_Mark(Cell_Number());
 }
@@ -386,6 +386,14 @@ void Main_Game(int argc, char* argv[])
 
         Set_Video_Cursor_Clip(false);
 
+        /*
+        **	A benchmark run only plays its one scenario; report the results and quit.
+        */
+        if (Benches != NULL) {
+            Write_Benchmarks("BENCH.INI");
+            break;
+        }
+
         /*
         **	Scenario is done; fade palette to black
         */
@@ -403,7 +411,7 @@ void Main_Game(int argc, char* argv[])
         ** been initialized in that case.)
         */
         if (Session.Record || Session.Play) {
-            Session.RecordFile.Close();
+            Replay.Close();
         }
 
         if (Session.Type == GAME_NULL_MODEM || Session.Type == GAME_MODEM) {
@@ -1661,6 +1669,20 @@ FacingType KN_To_Facing(int input)
  *=============================================================================================*/
 static void Sync_Delay(void)
 {
+    /*
+    ** A benchmark run measures simulation throughput, so never wait.
+    */
+    if (Benches != NULL) {
+        return;
+    }
+
+    /*
+    ** Neither is a playback that is running ahead to a seek target.
+    */
+    if (Replay.Is_Seeking()) {
+        return;
+    }
+
     /*
     ** Slow down with frame limiter first.
     */
@@ -1687,6 +1709,7 @@ static void Sync_Delay(void)
             if (input) {
                 Keyboard_Process(input);
             }
+            Interpolate_Frame();
             Map.Render();
         }
 
@@ -1802,13 +1825,14 @@ bool Main_Loop()
     /*
     **	Update the display, unless we're inside a dialog.
     */
-    if (!Session.Play) {
+    if (!Session.Play && Benches == NULL) {
         if (SpecialDialog == SDLG_NONE && GameInFocus) {
             WWMouse->Erase_Mouse(&HidPage, true);
             Map.Input(input, x, y);
             if (input) {
                 Keyboard_Process(input);
             }
+            Interpolate_Frame();
             Map.Render();
         }
     }
@@ -1817,9 +1841,17 @@ bool Main_Loop()
     ** Save map's position & selected objects, if we're recording the game.
     */
     if (Session.Record || Session.Play) {
+        Replay.Frame_Start();
         Do_Record_Playback();
     }
 
+    /*
+    ** Make sure a game snapshot restores exactly, if asked to.
+    */
+    if (Debug_Check_Snapshot) {
+        Check_Snapshot();
+    }
+
 #ifndef SORTDRAW
     /*
     ** Sort the map's ground layer by y-coordinate value.  This is done
@@ -1831,6 +1863,12 @@ bool Main_Loop()
     DisplayClass::Layer[LAYER_GROUND].Sort();
 #endif
 
+    /*
+    **	Note where everything is drawn before it moves, so that the frames drawn until the next
+    **	tick can show the moves part way through.
+    */
+    Interpolate_Tick();
+
     /*
     **	AI logic operations are performed here.
     */
@@ -1869,6 +1907,17 @@ bool Main_Loop()
 
     Call_Back();
 
+    /*
+    **	A benchmark run simply stops once the scenario has been decided; the
+    **	win and lose sequences would otherwise wait for player input.
+    */
+    if (Benches != NULL && (PlayerWins || PlayerLoses || PlayerRestarts)) {
+        PlayerWins = false;
+        PlayerLoses = false;
+        PlayerRestarts = false;
+        GameActive = false;
+    }
+
     /*
     **	Check for player wins or loses according to global event flag.
     */
@@ -1925,6 +1974,10 @@ bool Main_Loop()
     */
     Frame++;
 
+    if (Benches != NULL && Frame >= BenchTicks) {
+        GameActive = false;
+    }
+
     /*
     ** Is there a memory trasher altering the map??
     */
@@ -2388,9 +2441,9 @@ void Play_Movie(char const* name, ThemeType theme, bool clrscrn, bool immediate)
 //	Mono_Printf("Movie: %s\n", name);
 #endif // CHEAT_KEYS
     /*
-    ** Don't play movies in editor mode
+    ** Don't play movies in editor mode or during a benchmark run
     */
-    if (Debug_Map) {
+    if (Debug_Map || Benches != NULL) {
         return;
     }
 #ifdef CHEAT_KEYS
@@ -2481,8 +2534,22 @@ void Play_Movie(char const* name, ThemeType theme, bool clrscrn, bool immediate)
                 // Set_Palette(BlackPalette);
                 SysMemPage.Clear();
                 InMovie = true;
+                long long reads = RawFileClass::Stats.Reads;
+                long long seeks = RawFileClass::Stats.Seeks;
                 VQA_Play(vqa, VQAMODE_RUN);
+                VQAStatistics stats;
+                VQA_GetStats(vqa, &stats);
                 VQA_Close(vqa);
+                DBG_INFO("Play_Movie: %s took %lld file reads and %lld seeks.",
+                         fullname,
+                         RawFileClass::Stats.Reads - reads,
+                         RawFileClass::Stats.Seeks - seeks);
+                DBG_INFO("Play_Movie: %s drew %d of %d frames, dropped %d and showed %d late.",
+                         fullname,
+                         stats.FramesDrawn,
+                         stats.FramesLoaded,
+                         stats.FramesSkipped,
+                         stats.FramesLate);
                 // Resume_Audio_Thread();
                 InMovie = false;
 #ifdef MOVIE640
@@ -3954,6 +4021,7 @@ static bool Change_Local_Dir(int cd)
             RawFileClass vol(path.c_str());
 
             if (vol.Is_Directory()) {
+                Finish_Prefetch();
                 CDFileClass::Refresh_Search_Drives();
                 path += PathsClass::SEP;
                 CDFileClass::Add_Search_Drive(path.c_str());
@@ -4431,13 +4499,13 @@ static void Do_Record_Playback(void)
         /*
         **	Save the map's location
         */
-        Session.RecordFile.Write(&Map.DesiredTacticalCoord, sizeof(Map.DesiredTacticalCoord));
+        Replay.Write(&Map.DesiredTacticalCoord, sizeof(Map.DesiredTacticalCoord));
 
         /*
         **	Save the current object list count
         */
         count = CurrentObject.Count();
-        Session.RecordFile.Write(&count, sizeof(count));
+        Replay.Write(&count, sizeof(count));
 
         /*
         **	Save a CRC of the selected-object list.
@@ -4447,26 +4515,26 @@ static void Do_Record_Playback(void)
             ltgt = (unsigned int)(CurrentObject[i]->As_Target());
             sum += ltgt;
         }
-        Session.RecordFile.Write(&sum, sizeof(sum));
+        Replay.Write(&sum, sizeof(sum));
 
         /*
         **	Save all selected objects.
         */
         for (i = 0; i < count; i++) {
             tgt = CurrentObject[i]->As_Target();
-            Session.RecordFile.Write(&tgt, sizeof(tgt));
+            Replay.Write(&tgt, sizeof(tgt));
         }
 
         //
         // Save team-selection and formation events
         //
-        Session.RecordFile.Write(&TeamEvent, sizeof(TeamEvent));
-        Session.RecordFile.Write(&TeamNumber, sizeof(TeamNumber));
-        Session.RecordFile.Write(&FormationEvent, sizeof(FormationEvent));
-        Session.RecordFile.Write(TeamFormData, sizeof(TeamFormData));
-        Session.RecordFile.Write(&FormMove, sizeof(FormMove));
-        Session.RecordFile.Write(&FormSpeed, sizeof(FormSpeed));
-        Session.RecordFile.Write(&FormMaxSpeed, sizeof(FormMaxSpeed));
+        Replay.Write(&TeamEvent, sizeof(TeamEvent));
+        Replay.Write(&TeamNumber, sizeof(TeamNumber));
+        Replay.Write(&FormationEvent, sizeof(FormationEvent));
+        Replay.Write(TeamFormData, sizeof(TeamFormData));
+        Replay.Write(&FormMove, sizeof(FormMove));
+        Replay.Write(&FormSpeed, sizeof(FormSpeed));
+        Replay.Write(&FormMaxSpeed, sizeof(FormMaxSpeed));
         TeamEvent = 0;
         TeamNumber = 0;
         FormationEvent = 0;
@@ -4480,13 +4548,13 @@ static void Do_Record_Playback(void)
         /*
         **	Read & set the map's location.
         */
-        if (Session.RecordFile.Read(&coord, sizeof(coord)) == sizeof(coord)) {
+        if (Replay.Read(&coord, sizeof(coord)) == sizeof(coord)) {
             if (coord != Map.DesiredTacticalCoord) {
                 Map.Set_Tactical_Position(coord);
             }
         }
 
-        if (Session.RecordFile.Read(&count, sizeof(count)) == sizeof(count)) {
+        if (Replay.Read(&count, sizeof(count)) == sizeof(count)) {
             /*
             **	Compute a CRC of the current object-selection list.
             */
@@ -4500,7 +4568,7 @@ static void Do_Record_Playback(void)
             **	Load the CRC of the objects on disk; if it doesn't match, select
             **	all objects as they're loaded.
             */
-            Session.RecordFile.Read(&sum2, sizeof(sum2));
+            Replay.Read(&sum2, sizeof(sum2));
             if (sum2 != sum) {
                 Unselect_All();
             }
@@ -4508,7 +4576,7 @@ static void Do_Record_Playback(void)
             AllowVoice = true;
 
             for (i = 0; i < count; i++) {
-                if (Session.RecordFile.Read(&tgt, sizeof(tgt)) == sizeof(tgt)) {
+                if (Replay.Read(&tgt, sizeof(tgt)) == sizeof(tgt)) {
                     obj = As_Object(tgt);
                     if (obj && (sum2 != sum)) {
                         obj->Select();
@@ -4523,9 +4591,9 @@ static void Do_Record_Playback(void)
         //
         // Save team-selection and formation events
         //
-        Session.RecordFile.Read(&TeamEvent, sizeof(TeamEvent));
-        Session.RecordFile.Read(&TeamNumber, sizeof(TeamNumber));
-        Session.RecordFile.Read(&FormationEvent, sizeof(FormationEvent));
+        Replay.Read(&TeamEvent, sizeof(TeamEvent));
+        Replay.Read(&TeamNumber, sizeof(TeamNumber));
+        Replay.Read(&FormationEvent, sizeof(FormationEvent));
         if (TeamEvent) {
             Handle_Team(TeamNumber, TeamEvent - 1);
         }
@@ -4533,15 +4601,18 @@ static void Do_Record_Playback(void)
             Toggle_Formation();
         }
 
-        Session.RecordFile.Read(TeamFormData, sizeof(TeamFormData));
-        Session.RecordFile.Read(&FormMove, sizeof(FormMove));
-        Session.RecordFile.Read(&FormSpeed, sizeof(FormSpeed));
-        Session.RecordFile.Read(&FormMaxSpeed, sizeof(FormMaxSpeed));
+        Replay.Read(TeamFormData, sizeof(TeamFormData));
+        Replay.Read(&FormMove, sizeof(FormMove));
+        Replay.Read(&FormSpeed, sizeof(FormSpeed));
+        Replay.Read(&FormMaxSpeed, sizeof(FormMaxSpeed));
 
         /*
-        **	The map isn't drawn in playback mode, so draw it here.
+        **	The map isn't drawn in playback mode, so draw it here. Frames that are only
+        **	being run through on the way to a seek target aren't drawn at all.
         */
-        Map.Render();
+        if (!Replay.Is_Seeking()) {
+            Map.Render();
+        }
     }
 }
 
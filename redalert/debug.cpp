@@ -38,6 +38,7 @@
 
 #include "function.h"
 #include "vortex.h"
+#include "common/framelimit.h"
 #include <stdarg.h>
 
 #ifdef CHEAT_KEYS
@@ -214,6 +215,17 @@ void Debug_Key(unsigned input)
             PlayerPtr->Flag_To_Lose();
             break;
 
+        /*
+        **	Frame time histograms, to the log or over the screen.
+        */
+        case KN_H:
+            Dump_Frame_Histograms();
+            break;
+
+        case (int)KN_H | (int)KN_ALT_BIT:
+            Toggle_Frame_Overlay();
+            break;
+
         case KN_DELETE:
             if (CurrentObject.Count()) {
                 Map.Recalc();
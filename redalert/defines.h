@@ -576,6 +576,27 @@ inline TARGET Build_Target(RTTIType kind, int value)
 #define MAP_REGION_HEIGHT (((MAP_CELL_H + (REGION_WIDTH - 1)) / REGION_HEIGHT) + 2)
 #define MAP_TOTAL_REGIONS (MAP_REGION_WIDTH * MAP_REGION_HEIGHT)
 
+/*
+**	For long range path planning the map is broken down into sectors of this size. A path
+**	is first planned across the sectors and only the leg through the next few sectors is
+**	searched cell by cell.
+*/
+#define SECTOR_SIZE       8
+#define MAP_SECTOR_WIDTH  (MAP_CELL_W / SECTOR_SIZE)
+#define MAP_SECTOR_HEIGHT (MAP_CELL_H / SECTOR_SIZE)
+#define MAP_TOTAL_SECTORS (MAP_SECTOR_WIDTH * MAP_SECTOR_HEIGHT)
+#define SECTOR_PORTALS    24 // Most zone crossings recorded for one sector.
+#define SECTOR_LOOKAHEAD  3  // Sectors covered by each cell searched leg.
+
+/*
+**	The objects on the map are counted by owner in buckets of this many cells square. Target
+**	scans use the counts to skip the parts of the map that hold nothing worth examining.
+*/
+#define BUCKET_SIZE       4
+#define MAP_BUCKET_WIDTH  (MAP_CELL_W / BUCKET_SIZE)
+#define MAP_BUCKET_HEIGHT (MAP_CELL_H / BUCKET_SIZE)
+#define MAP_TOTAL_BUCKETS (MAP_BUCKET_WIDTH * MAP_BUCKET_HEIGHT)
+
 /**********************************************************************
 **	This enumerates the various known fear states for infantry units.
 **	At these stages, certain events or recovery actions are performed.
@@ -2797,25 +2818,24 @@ typedef enum BenchType : unsigned char
     BENCH_GSCREEN_RENDER, // Rendering of the whole map layered system (with blits).
     BENCH_BLIT_DISPLAY,   // DirectX or shadow blit of hidpage to seenpage.
     BENCH_MISSION,        // Mission list processing.
+    BENCH_ZONE,           // Movement zone updates.
 
     BENCH_RULES,    // Processing of the rules.ini file.
     BENCH_SCENARIO, // Processing of the scenario.ini file.
 
+    BENCH_SNAPSHOT, // Copying the game state to memory.
+    BENCH_RESTORE,  // Restoring the game state from memory.
+
     BENCH_COUNT,
     BENCH_FIRST = 0
 } BenchType;
 
-#if 0
 #define BStart(a)                                                                                                      \
     if (Benches != NULL)                                                                                               \
     Benches[a].Begin()
 #define BEnd(a)                                                                                                        \
     if (Benches != NULL)                                                                                               \
     Benches[a].End()
-#else
-#define BStart(a)
-#define BEnd(a)
-#endif
 
 /**********************************************************************
 **	Working MCGA colors that give a pleasing effect for beveled edges and
@@ -3518,6 +3538,26 @@ typedef struct
     CELL LastFixup;        // stores position of last overlap
 } PathType;
 
+/**************************************************************************
+**	Path finder totals. During a benchmark run with "-COMPAREPATHS", every
+**	path request is given to both the edge following and the A* path finders.
+*/
+typedef struct
+{
+    int Requests;      // Number of path requests compared.
+    int EdgeLength;    // Total moves in the edge following paths.
+    int EdgeChecks;    // Total cells checked by the edge following path finder.
+    int EdgeFailed;    // Number of requests the edge following path finder failed.
+    int AStarLength;   // Total moves in the A* paths.
+    int AStarChecks;   // Total cells checked by the A* path finder.
+    int AStarExpanded; // Total cells expanded by the A* path finder.
+    int AStarFailed;   // Number of requests the A* path finder failed.
+    int ZonePlans;     // Number of requests cut short at a sector waypoint.
+    int ZoneExpanded;  // Total sectors expanded by the zone graph planner.
+    int CacheHits;     // Number of requests that took over a cached path.
+    int CacheMisses;   // Number of requests that found no cached path to use.
+} PathCompareType;
+
 /**********************************************************************
 ** These are special indices into the Waypoint array; slots 0-25 are
 ** reserved for letter-designated Waypoints, the others are special.
@@ -370,6 +370,11 @@ void DisplayClass::Init_Theater(TheaterType theater)
     */
     sprintf(fullname, "%s.MIX", Theaters[theater].Root);
 
+    /*
+    **	The prefetch reads through the mixfile list, so it must be done first.
+    */
+    Finish_Prefetch();
+
     if (Scen.Theater != LastTheater) {
         if (TheaterData != NULL) {
             delete TheaterData;
@@ -50,6 +50,7 @@
 #include "scenario.h"
 #include "theme.h"
 #include "queue.h"
+#include "framequeue.h"
 #include "event.h"
 #include "rules.h"
 #include "ipxmgr.h"
@@ -91,6 +92,8 @@ extern bool Debug_Unshroud;
 extern bool Debug_Threat;
 extern bool Debug_Find_Path;
 extern bool Debug_Check_Map;
+extern bool Debug_Check_CRC;
+extern bool Debug_Check_Snapshot;
 extern bool Debug_Playtest;
 
 extern bool Debug_Heap_Dump;
@@ -152,9 +155,11 @@ extern CCINIClass RuleINI;
 #ifdef FIXIT_CSII //	checked - ajw 9/28/98
 extern CCINIClass AftermathINI;
 #endif
-// extern Benchmark *				Benches;
+extern Benchmark* Benches;
+extern char BenchScenario[_MAX_FNAME + _MAX_EXT];
+extern int BenchTicks;
+extern bool BenchComparePaths;
 extern int MapTriggerID;
-extern int LogicTriggerID;
 extern PKey FastKey;
 extern PKey SlowKey;
 extern RulesClass Rule;
@@ -242,7 +247,7 @@ extern TFixedIHeapClass<WeaponTypeClass> Weapons;
 extern TFixedIHeapClass<WarheadTypeClass> Warheads;
 
 extern QueueClass<EventClass, MAX_EVENTS> OutList;
-extern QueueClass<EventClass, (MAX_EVENTS * 64)> DoList;
+extern FrameQueueClass<EventClass, (MAX_EVENTS * 64), 256, 32> DoList;
 
 #ifdef MIRROR_QUEUE
 extern QueueClass<EventClass, (MAX_EVENTS * 64)> MirrorList;
@@ -308,6 +313,7 @@ extern HousesType Whom;
 extern VQAConfig AnimControl;
 extern int SpareTicks;
 extern int PathCount;
+extern PathCompareType PathCompare;
 extern int CellCount;
 extern int TargetScan;
 extern int SidebarRedraws;
@@ -343,6 +349,7 @@ extern CELL CurrentCell;
 #endif
 
 extern SessionClass Session;
+extern ReplayClass Replay;
 // extern NullModemClass 			NullModem;
 #ifdef NETWORKING
 extern IPXManagerClass Ipx;
@@ -38,12 +38,19 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
+ *   Clear_Path_Cache -- Forgets every path held in the path cache.                            *
  *   Clear_Path_Overlap -- clears the path overlap list                                        *
  *   Find_Path -- Find a path from point a to point b.                                         *
+ *   FootClass::Cache_Path -- Records a freshly found path in the path cache.                  *
+ *   FootClass::Find_Path_AStar -- Find a path with a budgeted A* search over the cell grid.   *
+ *   FootClass::Find_Path_Cached -- Takes over the rest of a path found earlier this frame.    *
+ *   FootClass::Find_Path_Edge -- Find a path by following the line and edges of obstacles.    *
+ *   FootClass::Search_AStar -- Runs one A* search from the source cell toward the destination.*
  *   Find_Path_Cell -- Finds a given cell on a specified path                                  *
  *   Follow_Edge -- Follow an edge to get around an impassable spot.                           *
  *   FootClass::Unravel_Loop -- Unravels a loop in the movement path                           *
  *   Get_New_XY -- Get the new x,y based on current position and direction.                    *
+ *   Invalidate_Path_Cache -- Drops the cached paths that move through the cell specified.     *
  *   Optimize_Moves -- Optimize the move list.                                                 *
  *   Set_Path_Overlap -- Sets the overlap bit for given cell                                   *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
@@ -104,6 +111,11 @@
 
 #define MAX_PATH_EDGE_FOLLOW 400
 
+/*
+**	Number of paths remembered in the path cache.
+*/
+#define PATH_CACHE_SIZE 8
+
 #ifdef NEVER
 typedef enum
 {
@@ -149,6 +161,107 @@ static unsigned int RightOverlap[MAP_CELL_TOTAL / 32]; // overlap list for the r
 static CELL DestLocation;
 static CELL StartLocation;
 
+/*
+**	Per cell state of the A* path finder. Cells carry the number of the search that last
+**	touched them, so nothing needs to be cleared between searches.
+*/
+typedef struct
+{
+    unsigned short Search;  // Search in which the route to this cell was recorded.
+    unsigned short Closed;  // Search in which this cell was expanded.
+    unsigned short Checked; // Search in which the entry cost of this cell was looked up.
+    unsigned char Step;     // Passable_Cell() cost of entering this cell.
+    FacingType Facing;      // Direction moved to enter this cell along the route.
+    int Cost;               // Scaled cost of the best known route to this cell.
+} AStarNodeType;
+
+typedef struct
+{
+    int Score; // Known cost plus estimate to destination.
+    int Guess; // Estimate to destination, used to break ties.
+    CELL Cell;
+} AStarOpenType;
+
+static AStarNodeType AStarNodes[MAP_CELL_TOTAL];
+static AStarOpenType AStarOpen[MAP_CELL_TOTAL];
+static unsigned short AStarSearch = 0;
+
+/*
+**	Number of Passable_Cell() checks performed, used to compare the path finders.
+*/
+static int PassableChecks = 0;
+
+/*
+**	Paths found during the current frame. The units of a group move ask for nearly the same
+**	path one after another, so a later request can take over the rest of an earlier path.
+**	An entry is dropped as soon as one of the cells it passes through changes.
+*/
+typedef struct
+{
+    int Frame;                                 // Frame the path was found in.
+    TechnoTypeClass const* Class;              // Type of object the path was found for.
+    HouseClass const* House;                   // Owner of the object the path was found for.
+    MoveType Threshhold;                       // Movement threshhold the path was found with.
+    CELL Dest;                                 // Destination that was asked for.
+    int Cost;                                  // Cost of the whole path.
+    int Length;                                // Number of moves, not counting the END.
+    bool IsComplete;                           // Does the path finish with an END?
+    FacingType Moves[MAX_MLIST_SIZE];          // The moves of the path.
+    CELL Cells[MAX_MLIST_SIZE + 1];            // Start cell followed by the cell after each move.
+    unsigned int Overlap[MAP_CELL_TOTAL / 32]; // Cells the path moves into.
+} PathCacheType;
+
+static PathCacheType PathCache[PATH_CACHE_SIZE];
+static int PathCacheNext = 0;
+
+/*
+**	Open heap ordering: lowest score first, then lowest estimate, then lowest cell.
+*/
+inline static bool AStar_Before(AStarOpenType const& a, AStarOpenType const& b)
+{
+    if (a.Score != b.Score) {
+        return (a.Score < b.Score);
+    }
+    if (a.Guess != b.Guess) {
+        return (a.Guess < b.Guess);
+    }
+    return (a.Cell < b.Cell);
+}
+
+/***********************************************************************************************
+ * Compare_Path -- Add a path to the path finder comparison totals.                            *
+ *                                                                                             *
+ * INPUT:   path     -- The path that was found.                                               *
+ *                                                                                             *
+ *          edge     -- Was the path found by the edge following path finder?                  *
+ *                                                                                             *
+ *          checks   -- Number of Passable_Cell() checks it took.                              *
+ *                                                                                             *
+ *          expanded -- Number of cells the A* search expanded (zero for edge following).      *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+static void Compare_Path(PathType const* path, bool edge, int checks, int expanded)
+{
+    int length = 0;
+    while (length < path->Length && path->Command[length] != END) {
+        length++;
+    }
+
+    if (edge) {
+        PathCompare.EdgeLength += length;
+        PathCompare.EdgeChecks += checks;
+        PathCompare.EdgeFailed += (path->Cost == 0) ? 1 : 0;
+    } else {
+        PathCompare.AStarLength += length;
+        PathCompare.AStarChecks += checks;
+        PathCompare.AStarExpanded += expanded;
+        PathCompare.AStarFailed += (path->Cost == 0) ? 1 : 0;
+    }
+}
+
 /***************************************************************************
  * Point_Relative_To_Line -- Relation between a point and a line           *
  *                                                                         *
@@ -414,6 +527,298 @@ bool FootClass::Register_Cell(PathType* path, CELL cell, FacingType dir, int cos
 /***********************************************************************************************
  * Find_Path -- Find a path from point a to point b.                                           *
  *                                                                                             *
+ *    This hands the request to the path finder selected by the rules. When the path cache is  *
+ *    enabled, a path found earlier in the frame may be taken over instead. When the rules     *
+ *    call for zone path planning, a long trip is first planned over the zone graph and only   *
+ *    the first leg of it is searched for here. During a benchmark run the other path finder   *
+ *    is run as well (outside the FINDPATH probe) so that the length and work of both can be   *
+ *    compared.                                                                                *
+ *                                                                                             *
+ * INPUT:      dest        -- The cell to find a path to.                                      *
+ *                                                                                             *
+ *             final_moves -- Array to store the moves into.                                   *
+ *                                                                                             *
+ *             maxlen      -- Size of the final_moves array.                                   *
+ *                                                                                             *
+ *             threshhold  -- The most difficult movement type to consider passable.           *
+ *                                                                                             *
+ * OUTPUT:     Returns with a pointer to the path found (NULL if no moves array was given).    *
+ *                                                                                             *
+ * WARNINGS:   The path returned is only valid until the next call to this routine.            *
+ *=============================================================================================*/
+PathType* FootClass::Find_Path(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold)
+{
+    /*
+    ** If we have been provided an illegal place to store our final moves
+    ** then forget it.
+    */
+    if (!final_moves)
+        return (NULL);
+
+    BStart(BENCH_FINDPATH);
+
+    PathCount++;
+
+    StartLocation = Coord_Cell(Coord);
+
+    /*
+    **	Teams that avoid danger weigh the threat along the way, so their paths are not shared.
+    */
+    bool cache = Rule.IsPathCache && (!Team || !Team->Class->IsRoundAbout);
+    CELL goal = dest;
+    if (cache) {
+        PathType* path = Find_Path_Cached(dest, final_moves, maxlen, threshhold);
+        if (path != NULL) {
+            BEnd(BENCH_FINDPATH);
+            return (path);
+        }
+    }
+
+    if (Rule.IsZonePath) {
+        int sectors = 0;
+        CELL waypoint = Map.Zone_Waypoint(StartLocation, dest, Techno_Type_Class()->MZone, sectors);
+        if (Benches != NULL) {
+            PathCompare.ZonePlans += (waypoint != dest) ? 1 : 0;
+            PathCompare.ZoneExpanded += sectors;
+        }
+        dest = waypoint;
+    }
+    DestLocation = dest;
+
+    int checks = PassableChecks;
+    int expanded = 0;
+    PathType* path;
+    if (Rule.IsAStarPath) {
+        path = Find_Path_AStar(dest, final_moves, maxlen, threshhold, expanded);
+    } else {
+        path = Find_Path_Edge(dest, final_moves, maxlen, threshhold);
+    }
+
+    if (cache && path->Cost != 0) {
+        Cache_Path(goal, path, threshhold);
+    }
+
+    BEnd(BENCH_FINDPATH);
+
+    if (Benches != NULL && BenchComparePaths) {
+        Compare_Path(path, !Rule.IsAStarPath, PassableChecks - checks, expanded);
+
+        /*
+        **	Run the path finder that is not in use into a scratch list.
+        */
+        static FacingType _moves[MAX_MLIST_SIZE + 2];
+        checks = PassableChecks;
+        expanded = 0;
+        PathType* other;
+        if (Rule.IsAStarPath) {
+            other = Find_Path_Edge(dest, _moves, min(maxlen, MAX_MLIST_SIZE), threshhold);
+        } else {
+            other = Find_Path_AStar(dest, _moves, min(maxlen, MAX_MLIST_SIZE), threshhold, expanded);
+        }
+        Compare_Path(other, Rule.IsAStarPath, PassableChecks - checks, expanded);
+        PathCompare.Requests++;
+    }
+
+    return (path);
+}
+
+/***********************************************************************************************
+ * Clear_Path_Cache -- Forgets every path held in the path cache.                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Call this whenever the map is replaced, such as when a scenario starts or a     *
+ *             saved game has been loaded.                                                     *
+ *=============================================================================================*/
+void Clear_Path_Cache(void)
+{
+    for (int index = 0; index < PATH_CACHE_SIZE; index++) {
+        PathCache[index].Frame = -1;
+    }
+    PathCacheNext = 0;
+}
+
+/***********************************************************************************************
+ * Invalidate_Path_Cache -- Drops the cached paths that move through the cell specified.       *
+ *                                                                                             *
+ *    This is called whenever something about a cell changes that could make a difference to   *
+ *    the path finder, such as an object moving into or out of it or its terrain changing.     *
+ *                                                                                             *
+ * INPUT:   cell  -- The cell that has changed.                                                *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void Invalidate_Path_Cache(CELL cell)
+{
+    for (int index = 0; index < PATH_CACHE_SIZE; index++) {
+        PathCacheType& entry = PathCache[index];
+        if (entry.Frame == Frame && (entry.Overlap[cell >> 5] & (1U << (cell & 0x1F)))) {
+            entry.Frame = -1;
+        }
+    }
+}
+
+/***********************************************************************************************
+ * FootClass::Cache_Path -- Records a freshly found path in the path cache.                    *
+ *                                                                                             *
+ * INPUT:   dest        -- The destination that was asked for.                                 *
+ *                                                                                             *
+ *          path        -- The path that was found.                                            *
+ *                                                                                             *
+ *          threshhold  -- The movement threshhold the path was found with.                    *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   An entry left over from an earlier frame is reused first. Otherwise the         *
+ *             entries are replaced in turn.                                                   *
+ *=============================================================================================*/
+void FootClass::Cache_Path(CELL dest, PathType const* path, MoveType threshhold)
+{
+    int slot = -1;
+    for (int index = 0; index < PATH_CACHE_SIZE; index++) {
+        if (PathCache[index].Frame != Frame) {
+            slot = index;
+            break;
+        }
+    }
+    if (slot == -1) {
+        slot = PathCacheNext;
+        PathCacheNext = (PathCacheNext + 1) % PATH_CACHE_SIZE;
+    }
+
+    PathCacheType& entry = PathCache[slot];
+    entry.Frame = Frame;
+    entry.Class = Techno_Type_Class();
+    entry.House = House;
+    entry.Threshhold = threshhold;
+    entry.Dest = dest;
+    entry.Cost = path->Cost;
+    entry.Length = 0;
+    entry.IsComplete = false;
+    memset(entry.Overlap, 0, sizeof(entry.Overlap));
+
+    /*
+    **	Record the moves and the cells they lead to. The start cell is left out of the
+    **	overlap list since the object asking for the path is standing in it.
+    */
+    CELL cell = path->Start;
+    entry.Cells[0] = cell;
+    for (int index = 0; index < path->Length && entry.Length < MAX_MLIST_SIZE; index++) {
+        FacingType facing = path->Command[index];
+        if (facing == END) {
+            entry.IsComplete = true;
+            break;
+        }
+        cell = Adjacent_Cell(cell, facing);
+        entry.Moves[entry.Length++] = facing;
+        entry.Cells[entry.Length] = cell;
+        entry.Overlap[cell >> 5] |= (1U << (cell & 0x1F));
+    }
+}
+
+/***********************************************************************************************
+ * FootClass::Find_Path_Cached -- Takes over the rest of a path found earlier this frame.      *
+ *                                                                                             *
+ *    This looks for a path found this frame to the same destination for the same type of      *
+ *    object, owner and movement threshhold. If this object stands on that path, or next to    *
+ *    it where it can step onto it, the rest of the path from the furthest such point is       *
+ *    copied into the moves array.                                                             *
+ *                                                                                             *
+ * INPUT:   dest        -- The cell to find a path to.                                         *
+ *                                                                                             *
+ *          final_moves -- Array to store the moves into.                                      *
+ *                                                                                             *
+ *          maxlen      -- Size of the final_moves array.                                      *
+ *                                                                                             *
+ *          threshhold  -- The most difficult movement type to consider passable.              *
+ *                                                                                             *
+ * OUTPUT:  Returns with a pointer to the path taken over. If there was no path that could be  *
+ *          used, then NULL is returned.                                                       *
+ *                                                                                             *
+ * WARNINGS:   The path returned is only valid until the next call to this routine.            *
+ *=============================================================================================*/
+PathType* FootClass::Find_Path_Cached(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold)
+{
+    static PathType path;
+
+    CELL source = Coord_Cell(Coord);
+    MZoneType mzone = Techno_Type_Class()->MZone;
+
+    for (int index = 0; index < PATH_CACHE_SIZE; index++) {
+        PathCacheType const& entry = PathCache[index];
+        if (entry.Frame != Frame || entry.Dest != dest || entry.Threshhold != threshhold
+            || entry.Class != Techno_Type_Class() || entry.House != House) {
+            continue;
+        }
+        if (Map[entry.Cells[0]].Zones[mzone] != Map[source].Zones[mzone]) {
+            continue;
+        }
+
+        /*
+        **	Find the point furthest along the path that this object stands on or can step
+        **	onto. There must be at least one move left to make from it.
+        */
+        for (int pos = entry.Length; pos >= 0; pos--) {
+            CELL cell = entry.Cells[pos];
+            FacingType facing = FACING_NONE;
+
+            if (cell != source) {
+                if (abs(Cell_X(cell) - Cell_X(source)) > 1 || abs(Cell_Y(cell) - Cell_Y(source)) > 1) {
+                    continue;
+                }
+                facing = CELL_FACING(source, cell);
+                if (!Passable_Cell(cell, facing, -1, threshhold)) {
+                    continue;
+                }
+            }
+
+            int full = entry.Length - pos + ((facing != FACING_NONE) ? 1 : 0);
+            if (full == 0) {
+                continue;
+            }
+
+            /*
+            **	Copy over the moves, leaving room for the END.
+            */
+            int count = min(full, maxlen - 1);
+            path.Start = source;
+            path.Length = 0;
+            path.Command = final_moves;
+            path.Overlap = MainOverlap;
+            path.LastOverlap = -1;
+            path.LastFixup = -1;
+
+            if (facing != FACING_NONE) {
+                path.Command[path.Length++] = facing;
+            }
+            for (int move = pos; path.Length < count; move++) {
+                path.Command[path.Length++] = entry.Moves[move];
+            }
+            if (entry.IsComplete && count == full) {
+                path.Command[path.Length++] = END;
+            }
+
+            /*
+            **	Only a share of the original cost applies to the rest of the path.
+            */
+            path.Cost = max(1, entry.Cost * count / max(entry.Length, 1));
+
+            PathCompare.CacheHits++;
+            return (&path);
+        }
+    }
+
+    PathCompare.CacheMisses++;
+    return (NULL);
+}
+
+/***********************************************************************************************
+ * FootClass::Find_Path_Edge -- Find a path by following the line and edges of obstacles.      *
+ *                                                                                             *
  * INPUT:      int source x,y, int destination x,y, char *final moves                          *
  *             array to store moves, int maximum moves we may attempt                          *
  *                                                                                             *
@@ -429,7 +834,7 @@ bool FootClass::Register_Cell(PathType* path, CELL cell, FacingType dir, int cos
  * HISTORY:                                                                                    *
  *   07/08/1991  CY : Created.                                                                 *
  *=============================================================================================*/
-PathType* FootClass::Find_Path(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold)
+PathType* FootClass::Find_Path_Edge(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold)
 {
     CELL source = Coord_Cell(Coord); // Source expressed as cell
     static PathType path;            // Main path control.
@@ -451,17 +856,6 @@ PathType* FootClass::Find_Path(CELL dest, FacingType* final_moves, int maxlen, M
     int threat = 0;                            //
     int threat_stage = 0;                      // These weren't initialized. ST - 1/8/2019 12:03PM
 
-    /*
-    ** If we have been provided an illegal place to store our final moves
-    ** then forget it.
-    */
-    if (!final_moves)
-        return (NULL);
-
-    BStart(BENCH_FINDPATH);
-
-    PathCount++;
-
     if (Team && Team->Class->IsRoundAbout) {
         unit_threat = (Team) ? Team->Risk : Risk();
         threat_stage = 0;
@@ -470,9 +864,6 @@ PathType* FootClass::Find_Path(CELL dest, FacingType* final_moves, int maxlen, M
         unit_threat = threat = -1;
     }
 
-    StartLocation = source;
-    DestLocation = dest;
-
     /*
     ** Initialize the path structure so that we can keep track of the
     ** path.
@@ -766,11 +1157,296 @@ end_of_list:
     Optimize_Moves(&path, threshhold);
 #endif
 
-    BEnd(BENCH_FINDPATH);
+    return (&path);
+}
+
+/***********************************************************************************************
+ * FootClass::Find_Path_AStar -- Find a path with a budgeted A* search over the cell grid.     *
+ *                                                                                             *
+ *    This is the alternative to the edge following path finder. It uses the same passability  *
+ *    rules and the same movement threshhold, so the paths can be used interchangeably. If     *
+ *    the destination cannot be reached within the node budget, the path leads to the closest  *
+ *    cell found so far.                                                                       *
+ *                                                                                             *
+ * INPUT:      dest        -- The cell to find a path to.                                      *
+ *                                                                                             *
+ *             final_moves -- Array to store the moves into.                                   *
+ *                                                                                             *
+ *             maxlen      -- Size of the final_moves array.                                   *
+ *                                                                                             *
+ *             threshhold  -- The most difficult movement type to consider passable.           *
+ *                                                                                             *
+ *             expanded    -- Reference to the counter of cells expanded by the search.        *
+ *                                                                                             *
+ * OUTPUT:     Returns with a pointer to the path found.                                       *
+ *                                                                                             *
+ * WARNINGS:   The path returned is only valid until the next call to this routine.            *
+ *=============================================================================================*/
+PathType* FootClass::Find_Path_AStar(CELL dest,
+                                     FacingType* final_moves,
+                                     int maxlen,
+                                     MoveType threshhold,
+                                     int& expanded)
+{
+    CELL source = Coord_Cell(Coord);
+    static PathType path;
+
+    path.Start = source;
+    path.Cost = 0;
+    path.Length = 0;
+    path.Command = final_moves;
+    path.Command[0] = END;
+    path.Overlap = MainOverlap;
+    path.LastOverlap = -1;
+    path.LastFixup = -1;
+
+    /*
+    **	Account for trailing end of list command.
+    */
+    maxlen--;
+
+    /*
+    **	Teams that avoid danger first search with no threat tolerance, then relax it in the
+    **	same stages as the edge following path finder.
+    */
+    int unit_threat = -1;
+    int threat = -1;
+    if (Team && Team->Class->IsRoundAbout) {
+        unit_threat = Team->Risk;
+        threat = 0;
+    }
+
+    bool reached = false;
+    CELL best = source;
+    for (int stage = 0;; stage++) {
+        best = Search_AStar(source, dest, threat, threshhold, expanded, reached);
+        if (reached || threat == -1) {
+            break;
+        }
+
+        switch (stage) {
+        case 0:
+            threat = unit_threat >> 1;
+            break;
+
+        case 1:
+            threat += unit_threat;
+            break;
+
+        default:
+            threat = -1;
+            break;
+        }
+    }
+
+    /*
+    **	Walk back from the end of the path to find its length. If it is too long to fit,
+    **	only the first part of it is recorded.
+    */
+    int length = 0;
+    for (CELL cell = best; cell != source; cell = Adjacent_Cell(cell, Opposite(AStarNodes[cell].Facing))) {
+        length++;
+    }
+
+    int count = min(length, maxlen);
+    int pos = length;
+    for (CELL cell = best; cell != source; cell = Adjacent_Cell(cell, Opposite(AStarNodes[cell].Facing))) {
+        pos--;
+        if (pos < count) {
+            path.Command[pos] = AStarNodes[cell].Facing;
+            path.Cost += AStarNodes[cell].Step;
+        }
+    }
+    path.Length = count;
+
+    /*
+    **	Poke in the stop command.
+    */
+    if (path.Length < maxlen) {
+        path.Command[path.Length++] = END;
+    }
+
+#ifdef DIAGONAL
+    Optimize_Moves(&path, threshhold);
+#endif
 
     return (&path);
 }
 
+/***********************************************************************************************
+ * FootClass::Search_AStar -- Runs one A* search from the source cell toward the destination.  *
+ *                                                                                             *
+ *    Costs are the Passable_Cell() cost of entering a cell, scaled by 10 for straight and 14  *
+ *    for diagonal moves. The estimate is the octile distance at the cheapest cell cost, so    *
+ *    the search never overestimates. Ties are broken by the estimate and then by the cell     *
+ *    number so that the result is identical on every machine.                                 *
+ *                                                                                             *
+ * INPUT:      source      -- The cell to start from.                                          *
+ *                                                                                             *
+ *             dest        -- The cell to find a path to.                                      *
+ *                                                                                             *
+ *             threat      -- The threat tolerance passed on to Passable_Cell().               *
+ *                                                                                             *
+ *             threshhold  -- The most difficult movement type to consider passable.           *
+ *                                                                                             *
+ *             expanded    -- Reference to the counter of cells expanded by the search.        *
+ *                                                                                             *
+ *             reached     -- Set to whether the destination (or a cell next to an             *
+ *                            impassable destination) was reached.                             *
+ *                                                                                             *
+ * OUTPUT:     Returns with the cell the path should lead to. The route to it is held in       *
+ *             the AStarNodes array.                                                           *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+CELL FootClass::Search_AStar(CELL source, CELL dest, int threat, MoveType threshhold, int& expanded, bool& reached)
+{
+    /*
+    **	Start a new search. When the search counter wraps, the stale stamps must go.
+    */
+    if (++AStarSearch == 0) {
+        memset(AStarNodes, 0, sizeof(AStarNodes));
+        AStarSearch = 1;
+    }
+
+    int dx = Cell_X(dest);
+    int dy = Cell_Y(dest);
+    int limit = Rule.AStarNodeLimit;
+    int open = 0;
+    int nodes = 0;
+
+    reached = false;
+
+    AStarNodeType* node = &AStarNodes[source];
+    node->Search = AStarSearch;
+    node->Cost = 0;
+    node->Facing = FACING_NONE;
+    node->Step = 0;
+
+    int xdiff = abs(Cell_X(source) - dx);
+    int ydiff = abs(Cell_Y(source) - dy);
+    int guess = 10 * max(xdiff, ydiff) + 4 * min(xdiff, ydiff);
+    AStarOpen[open].Score = guess;
+    AStarOpen[open].Guess = guess;
+    AStarOpen[open].Cell = source;
+    open++;
+
+    CELL best = source;
+    int bestguess = guess;
+
+    while (open > 0 && nodes < limit) {
+
+        /*
+        **	Pop the most promising cell off the open heap.
+        */
+        CELL cell = AStarOpen[0].Cell;
+        guess = AStarOpen[0].Guess;
+        AStarOpenType last = AStarOpen[--open];
+        int hole = 0;
+        for (;;) {
+            int child = hole * 2 + 1;
+            if (child >= open) {
+                break;
+            }
+            if (child + 1 < open && AStar_Before(AStarOpen[child + 1], AStarOpen[child])) {
+                child++;
+            }
+            if (!AStar_Before(AStarOpen[child], last)) {
+                break;
+            }
+            AStarOpen[hole] = AStarOpen[child];
+            hole = child;
+        }
+        AStarOpen[hole] = last;
+
+        node = &AStarNodes[cell];
+        if (node->Closed == AStarSearch) {
+            continue;
+        }
+        node->Closed = AStarSearch;
+        nodes++;
+
+        if (guess < bestguess || (guess == bestguess && node->Cost < AStarNodes[best].Cost)) {
+            best = cell;
+            bestguess = guess;
+        }
+
+        if (cell == dest) {
+            reached = true;
+            break;
+        }
+
+        int cx = Cell_X(cell);
+        for (FacingType facing = FACING_N; facing < FACING_COUNT; facing++) {
+            CELL next = Adjacent_Cell(cell, facing);
+            if ((unsigned)next >= MAP_CELL_TOTAL || abs(Cell_X(next) - cx) > 1) {
+                continue;
+            }
+
+            AStarNodeType* nnode = &AStarNodes[next];
+            if (nnode->Closed == AStarSearch) {
+                continue;
+            }
+
+            /*
+            **	The entry cost of a cell doesn't depend on the direction it is entered from,
+            **	so it only needs to be looked up once per search.
+            */
+            if (nnode->Checked != AStarSearch) {
+                nnode->Checked = AStarSearch;
+                nnode->Step = Passable_Cell(next, facing, threat, threshhold);
+            }
+
+            if (nnode->Step == 0) {
+
+                /*
+                **	If the impassable location is actually the destination,
+                **	then stop here and consider this "good enough".
+                */
+                if (next == dest) {
+                    best = cell;
+                    reached = true;
+                    expanded += nodes;
+                    return (best);
+                }
+                continue;
+            }
+
+            int cost = node->Cost + nnode->Step * ((facing & 1) ? 14 : 10);
+            if (nnode->Search == AStarSearch && cost >= nnode->Cost) {
+                continue;
+            }
+            nnode->Search = AStarSearch;
+            nnode->Cost = cost;
+            nnode->Facing = facing;
+
+            if (open < ARRAY_SIZE(AStarOpen)) {
+                xdiff = abs(Cell_X(next) - dx);
+                ydiff = abs(Cell_Y(next) - dy);
+
+                AStarOpenType entry;
+                entry.Guess = 10 * max(xdiff, ydiff) + 4 * min(xdiff, ydiff);
+                entry.Score = cost + entry.Guess;
+                entry.Cell = next;
+
+                hole = open++;
+                while (hole > 0) {
+                    int parent = (hole - 1) / 2;
+                    if (!AStar_Before(entry, AStarOpen[parent])) {
+                        break;
+                    }
+                    AStarOpen[hole] = AStarOpen[parent];
+                    hole = parent;
+                }
+                AStarOpen[hole] = entry;
+            }
+        }
+    }
+
+    expanded += nodes;
+    return (best);
+}
+
 /***********************************************************************************************
  * Follow_Edge -- Follow an edge to get around an impassable spot.                             *
  *                                                                                             *
@@ -1304,6 +1980,8 @@ CELL FootClass::Safety_Point(CELL src, CELL dst, int start, int max)
 
 int FootClass::Passable_Cell(CELL cell, FacingType face, int threat, MoveType threshhold)
 {
+    PassableChecks++;
+
     MoveType move = Can_Enter_Cell(cell, face);
 
     if (move < MOVE_MOVING_BLOCK && Distance(Cell_Coord(cell)) > 0x0100)
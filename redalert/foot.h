@@ -373,6 +373,11 @@ public:
 private:
     int Passable_Cell(CELL cell, FacingType face, int threat, MoveType threshhold);
     PathType* Find_Path(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold);
+    PathType* Find_Path_Edge(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold);
+    PathType* Find_Path_Cached(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold);
+    void Cache_Path(CELL dest, PathType const* path, MoveType threshhold);
+    PathType* Find_Path_AStar(CELL dest, FacingType* final_moves, int maxlen, MoveType threshhold, int& expanded);
+    CELL Search_AStar(CELL source, CELL dest, int threat, MoveType threshhold, int& expanded, bool& reached);
     void Debug_Draw_Map(char const* txt, CELL start, CELL dest, bool pause);
     void Debug_Draw_Path(PathType* path);
     bool Follow_Edge(CELL start,
@@ -125,6 +125,8 @@ CELL Coord_Cell(COORDINATE coord);
 #include "infantry.h" // Infantry objects.
 #include "score.h"    // Scoring system class.
 #include "factory.h"  // Production manager class.
+#include "replay.h"   // Recorded game container.
+#include "snapshot.h" // In memory copy of the game state.
 
 // Denzil 5/18/98 - Mpeg movie playback
 #ifdef MPEGMOVIE
@@ -189,6 +191,11 @@ void Stop_Speaking(void);
 void Sound_Effect(VocType voc, COORDINATE coord, int variation = 1, HousesType house = HOUSE_NONE);
 bool Is_Speaking(void);
 
+/*
+**	BENCH.CPP
+*/
+bool Write_Benchmarks(char const* filename);
+
 /*
 **	COMBAT.CPP
 */
@@ -353,6 +360,8 @@ bool Expansion_AM_Present(void);
 **	FINDPATH.CPP
 */
 int Optimize_Moves(PathType* path, int (*callback)(CELL, FacingType), int threshhold);
+void Clear_Path_Cache(void);
+void Invalidate_Path_Cache(CELL cell);
 
 /*
 **	INI.CPP
@@ -384,6 +393,8 @@ bool Init_Game(int argc, char* argv[]);
 bool Select_Game(bool fade = false);
 bool Parse_Command_Line(int argc, char* argv[]);
 void Parse_INI_File(void);
+bool Load_Recording_Values(CCFileClass& file);
+bool Save_Recording_Values(CCFileClass& file);
 
 /*
 ** JSHELL.CPP
@@ -422,6 +433,15 @@ int Do_Menu(char const** strings, bool blue);
 extern int UnknownKey;
 int Main_Menu(unsigned int timeout);
 
+/*
+**	MOTION.CPP
+*/
+void Interpolate_Tick(void);
+void Interpolate_Frame(void);
+COORDINATE Interpolated_Coord(ObjectClass const* object, COORDINATE coord);
+void Interpolate_Forget(ObjectClass const* object);
+void Interpolate_Clear(void);
+
 /*
 ** MPLAYER.CPP
 */
@@ -466,6 +486,12 @@ void Smart_Printf(char* format, ...);
 void Hex_Dump_Data(char* buffer, int length);
 void itoh(int i, char* s);
 
+/*
+**	PREFETCH.CPP
+*/
+void Prefetch_Scenario(char const* name);
+void Finish_Prefetch(void);
+
 /*
 ** QUEUE.CPP
 */
@@ -482,7 +508,12 @@ bool Queue_Mission(TargetClass whom,
 bool Queue_Options(void);
 bool Queue_Exit(void);
 void Queue_AI(void);
+bool Save_Queue_State(Pipe& pipe, int before);
+bool Load_Queue_State(Straw& straw);
+unsigned int Get_Game_CRC(void);
 void Add_CRC(unsigned int* crc, unsigned int val);
+void Sync_CRC_Reset(void);
+void Sync_CRC_Remove(ObjectClass const* object);
 
 /*
 **	REINF.CPP
@@ -521,6 +552,9 @@ bool Load_Game(const char* file_name);
 bool Read_Object(void* ptr, int class_size, FileClass& file, bool has_vtable);
 bool Save_Game(int id, char const* descr, bool bargraph = false);
 bool Save_Game(const char* file_name, const char* descr);
+bool Finish_Save_Game(void);
+bool Save_Game_State(Pipe& pipe);
+bool Load_Game_State(Straw& straw);
 bool Write_Object(void* ptr, int class_size, FileClass& file);
 void Code_All_Pointers(void);
 void Decode_All_Pointers(void);
@@ -564,6 +598,11 @@ void Bit_It_In(int x,
 void Call_Back_Delay(int time);
 int Alloc_Object(ScoreAnimClass* obj);
 
+/*
+**	SNAPSHOT.CPP
+*/
+void Check_Snapshot(void);
+
 /*
 **	SPECIAL.CPP
 */
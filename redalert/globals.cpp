@@ -49,6 +49,8 @@ bool Debug_Unshroud = false; // true = hide the shroud
 bool Debug_Threat = false;
 bool Debug_Find_Path = false;
 bool Debug_Check_Map = false; // true = validate the map each frame
+bool Debug_Check_CRC = false; // true = validate the incremental sync CRC each frame
+bool Debug_Check_Snapshot = false; // true = validate snapshot restores in benchmark runs
 bool Debug_Playtest = false;
 
 bool Debug_Heap_Dump = false;       // true = print the Heap Dump
@@ -234,9 +236,12 @@ CCINIClass AftermathINI;
 
 /***************************************************************************
 **	This points to the benchmark objects that are allocated only if the
-**	machine is running on a Pentium and this is a debug version.
+**	game was started with "-BENCHMARK <scenario> <ticks>".
 */
-// Benchmark * Benches;
+Benchmark* Benches;
+char BenchScenario[_MAX_FNAME + _MAX_EXT];
+int BenchTicks = 0;
+bool BenchComparePaths = false; // true = "-COMPAREPATHS", run both path finders
 
 /***************************************************************************
 **	General rules that control the game.
@@ -364,6 +369,7 @@ Buffer* TheaterBuffer;
 */
 int SpareTicks;
 int PathCount;      // Number of findpaths called.
+PathCompareType PathCompare; // Path finder comparison totals (benchmark only).
 int CellCount;      // Number of cells redrawn.
 int TargetScan;     // Number of target scans.
 int SidebarRedraws; // Number of sidebar redraws.
@@ -511,10 +517,11 @@ PaletteClass ScorePalette;
 /***************************************************************************
 **	These are the event queues. One is for holding events until they are ready to be
 **	sent to the remote computer for processing. The other list is for incoming events
-**	that need to be executed when the correct frame has been reached.
+**	that need to be executed when the correct frame has been reached. The DoList also indexes
+**	its events by frame (in a ring of 256 frames) and by the house ID that sent them.
 */
 QueueClass<EventClass, MAX_EVENTS> OutList;
-QueueClass<EventClass, (MAX_EVENTS * 64)> DoList;
+FrameQueueClass<EventClass, (MAX_EVENTS * 64), 256, 32> DoList;
 
 #ifdef MIRROR_QUEUE
 QueueClass<EventClass, (MAX_EVENTS * 64)> MirrorList;
@@ -527,7 +534,6 @@ DynamicVectorClass<TriggerClass*> HouseTriggers[HOUSE_COUNT];
 DynamicVectorClass<TriggerClass*> MapTriggers;
 int MapTriggerID;
 DynamicVectorClass<TriggerClass*> LogicTriggers;
-int LogicTriggerID;
 
 /***************************************************************************
 **	This is the list of BuildingTypes that define the AI's base.
@@ -551,6 +557,11 @@ unsigned int ScenarioCRC;
 ** This class manages data specific to multiplayer games.
 */
 SessionClass Session;
+
+/***************************************************************************
+** This is the file container for recording and playing back games.
+*/
+ReplayClass Replay;
 #if (TIMING_FIX)
 //
 // These values store the min & max frame #'s for when MaxAhead >>increases<<.
@@ -36,6 +36,10 @@
  *   FixedHeapClass::Free -- Frees a sub-block in the heap.                                    *
  *   FixedHeapClass::Free_All -- Frees all objects in the fixed heap.                          *
  *   FixedHeapClass::ID -- Converts a pointer to a sub-block index number.                     *
+ *   FixedHeapClass::Lowest_Free -- Finds the free sub-block with the lowest index.            *
+ *   FixedHeapClass::Mark_All_Free -- Flags every sub-block as free.                           *
+ *   FixedHeapClass::Mark_Free -- Flags a sub-block as free.                                   *
+ *   FixedHeapClass::Mark_Used -- Flags a sub-block as allocated.                              *
  *   FixedHeapClass::Set_Heap -- Assigns a memory block for this heap manager.                 *
  *   FixedHeapClass::~FixedHeapClass -- Destructor for the heap manager class.                 *
  *   FixedIHeapClass::Allocate -- Allocate an object from the heap.                            *
@@ -55,6 +59,23 @@
 #include <stdio.h>
 #include <stddef.h>
 #include <string.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/*
+**	Fetches the index of the lowest set bit. The value must not be zero.
+*/
+inline static int Lowest_Bit(unsigned value)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return ((int)index);
+#else
+    return (__builtin_ctz(value));
+#endif
+}
 
 template class TFixedIHeapClass<AircraftClass>;
 template class TFixedIHeapClass<AircraftTypeClass>;
@@ -112,6 +133,8 @@ FixedHeapClass::FixedHeapClass(int size)
     , TotalCount(0)
     , ActiveCount(0)
     , Buffer(0)
+    , FreeBits(0)
+    , FreeWords(0)
 {
 }
 
@@ -180,20 +203,17 @@ int FixedHeapClass::Set_Heap(int count, void* buffer)
     **	Initialize the free boolean vector and the buffer for the actual
     **	allocation objects.
     */
-    if (FreeFlag.Resize(count)) {
-        if (!buffer) {
-            buffer = new char[count * Size];
-            if (!buffer) {
-                FreeFlag.Clear();
-                return (false);
-            }
-            IsAllocated = true;
-        }
-        Buffer = buffer;
-        TotalCount = count;
-        return (true);
+    int words = (count + 31) / 32;
+    FreeBits = new unsigned[words];
+    FreeWords = new unsigned[(words + 31) / 32];
+    if (!buffer) {
+        buffer = new char[count * Size];
+        IsAllocated = true;
     }
-    return (false);
+    Buffer = buffer;
+    TotalCount = count;
+    Mark_All_Free();
+    return (true);
 }
 
 /***********************************************************************************************
@@ -215,11 +235,11 @@ int FixedHeapClass::Set_Heap(int count, void* buffer)
 void* FixedHeapClass::Allocate(void)
 {
     if (ActiveCount < TotalCount) {
-        int index = FreeFlag.First_False();
+        int index = Lowest_Free();
 
         if (index != -1) {
             ActiveCount++;
-            FreeFlag[index] = true;
+            Mark_Used(index);
             return ((*this)[index]);
         }
     }
@@ -247,10 +267,10 @@ int FixedHeapClass::Free(void* pointer)
     if (pointer && ActiveCount) {
         int index = ID(pointer);
 
-        if (index < TotalCount) {
-            if (FreeFlag[index]) {
+        if (index >= 0 && index < TotalCount) {
+            if (!Is_Free(index)) {
                 ActiveCount--;
-                FreeFlag[index] = false;
+                Mark_Free(index);
                 return (true);
             }
         }
@@ -311,7 +331,10 @@ void FixedHeapClass::Clear(void)
     IsAllocated = false;
     ActiveCount = 0;
     TotalCount = 0;
-    FreeFlag.Clear();
+    delete[] FreeBits;
+    delete[] FreeWords;
+    FreeBits = 0;
+    FreeWords = 0;
 }
 
 /***********************************************************************************************
@@ -332,10 +355,98 @@ void FixedHeapClass::Clear(void)
 int FixedHeapClass::Free_All(void)
 {
     ActiveCount = 0;
-    FreeFlag.Reset();
+    Mark_All_Free();
     return (true);
 }
 
+/***********************************************************************************************
+ * FixedHeapClass::Mark_Used -- Flags a sub-block as allocated.                                *
+ *                                                                                             *
+ * INPUT:   index -- The sub-block to flag.                                                    *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The active count is not changed.                                                *
+ *=============================================================================================*/
+void FixedHeapClass::Mark_Used(int index)
+{
+    int word = index >> 5;
+    FreeBits[word] &= ~(1U << (index & 31));
+    if (FreeBits[word] == 0) {
+        FreeWords[word >> 5] &= ~(1U << (word & 31));
+    }
+}
+
+/***********************************************************************************************
+ * FixedHeapClass::Mark_Free -- Flags a sub-block as free.                                     *
+ *                                                                                             *
+ * INPUT:   index -- The sub-block to flag.                                                    *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The active count is not changed.                                                *
+ *=============================================================================================*/
+void FixedHeapClass::Mark_Free(int index)
+{
+    int word = index >> 5;
+    FreeBits[word] |= 1U << (index & 31);
+    FreeWords[word >> 5] |= 1U << (word & 31);
+}
+
+/***********************************************************************************************
+ * FixedHeapClass::Mark_All_Free -- Flags every sub-block as free.                             *
+ *                                                                                             *
+ *    The bits past the end of the heap in the last word are left clear, so that they are      *
+ *    never handed out.                                                                        *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The active count is not changed.                                                *
+ *=============================================================================================*/
+void FixedHeapClass::Mark_All_Free(void)
+{
+    int words = (TotalCount + 31) / 32;
+    for (int word = 0; word < words; word++) {
+        FreeBits[word] = ~0U;
+    }
+    if (TotalCount & 31) {
+        FreeBits[words - 1] = (1U << (TotalCount & 31)) - 1;
+    }
+
+    for (int word = 0; word < (words + 31) / 32; word++) {
+        FreeWords[word] = 0;
+    }
+    for (int word = 0; word < words; word++) {
+        FreeWords[word >> 5] |= 1U << (word & 31);
+    }
+}
+
+/***********************************************************************************************
+ * FixedHeapClass::Lowest_Free -- Finds the free sub-block with the lowest index.              *
+ *                                                                                             *
+ *    Sub-blocks are always handed out lowest index first. Object IDs, and therefore targets,  *
+ *    depend on this, so every machine in a network game must agree on it.                     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  Returns with the index of the lowest free sub-block or -1 if the heap is full.     *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+int FixedHeapClass::Lowest_Free(void) const
+{
+    int words = (TotalCount + 31) / 32;
+    for (int summary = 0; summary < (words + 31) / 32; summary++) {
+        if (FreeWords[summary] != 0) {
+            int word = summary * 32 + Lowest_Bit(FreeWords[summary]);
+            return (word * 32 + Lowest_Bit(FreeBits[word]));
+        }
+    }
+    return (-1);
+}
+
 /////////////////////////////////////////////////////////////////////
 
 /***********************************************************************************************
@@ -453,7 +564,17 @@ void* FixedIHeapClass::Allocate(void)
 int FixedIHeapClass::Free(void* pointer)
 {
     if (FixedHeapClass::Free(pointer)) {
-        ActivePointers.Delete(pointer);
+
+        /*
+        **	The order of the active pointers is the order objects are processed in, so it
+        **	must be kept. Short lived objects are near the end, so look from there.
+        */
+        for (int index = ActivePointers.Count() - 1; index >= 0; index--) {
+            if (ActivePointers[index] == pointer) {
+                ActivePointers.Delete(index);
+                break;
+            }
+        }
     }
     return (false);
 }
@@ -576,8 +697,11 @@ template <class T> int TFixedIHeapClass<T>::Load(Straw& file)
         /*
         ** Get a pointer to the object, activate that object
         */
+        if (idx < 0 || idx >= TotalCount || !Is_Free(idx)) {
+            return (false);
+        }
         ptr = (T*)(*this)[idx];
-        FreeFlag[idx] = true;
+        Mark_Used(idx);
         ActiveCount++;
         ActivePointers.Add(ptr);
 
@@ -110,9 +110,22 @@ protected:
     void* Buffer;
 
     /*
-    **	This is a boolean vector array of allocation flag bits.
+    **	One bit for every sub-block, set while the sub-block is free. A second level holds one
+    **	bit for every word of the first, set while that word has a free sub-block in it. The
+    **	lowest free sub-block is then found by looking at a couple of words rather than by
+    **	scanning all of the flags.
     */
-    BooleanVectorClass FreeFlag;
+    unsigned* FreeBits;
+    unsigned* FreeWords;
+
+    bool Is_Free(int index) const
+    {
+        return ((FreeBits[index >> 5] >> (index & 31)) & 1) != 0;
+    };
+    void Mark_Used(int index);
+    void Mark_Free(int index);
+    void Mark_All_Free(void);
+    int Lowest_Free(void) const;
 
 private:
     // The assignment operator is not supported.
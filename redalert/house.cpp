@@ -4518,9 +4518,9 @@ void HouseClass::Sell_Wall(CELL cell)
                     Detach_This_From_All(::As_Target(cell), true);
 
                     if (optr.IsCrushable) {
-                        Map.Zone_Reset(MZONEF_NORMAL);
+                        Map.Zone_Change(cell, MZONEF_NORMAL);
                     } else {
-                        Map.Zone_Reset(MZONEF_CRUSHER | MZONEF_NORMAL);
+                        Map.Zone_Change(cell, MZONEF_CRUSHER | MZONEF_NORMAL);
                     }
                 }
             }
@@ -799,7 +799,7 @@ void InfantryClass::Per_Cell_Process(PCPType why)
                         cell -= MAP_CELL_W * (icon / w);
                         if (tt == TEMPLATE_BRIDGE1D || tt == TEMPLATE_BRIDGE2D) {
                             new TemplateClass(TemplateType(cellptr->TType - 1), cell);
-                            Map.Zone_Reset(MZONEF_ALL);
+                            Map.Zone_Change(cell, MZONEF_ALL, w, h);
                             delete this;
                             return;
                         } else {
@@ -841,6 +841,10 @@ void InfantryClass::Per_Cell_Process(PCPType why)
                                 bool doing = true;
                                 while (doing) {
                                     new TemplateClass(TemplateType(newtt), cell);
+                                    Map.Zone_Change(cell,
+                                                    MZONEF_ALL,
+                                                    TemplateTypeClass::As_Reference(TemplateType(newtt)).Width,
+                                                    TemplateTypeClass::As_Reference(TemplateType(newtt)).Height);
                                     cell += (MAP_CELL_W * ymov) + xmov;
                                     if (xmov < 0) {
                                         xmov = -1;
@@ -874,7 +878,6 @@ void InfantryClass::Per_Cell_Process(PCPType why)
                                         doing = false;
                                     }
                                 }
-                                Map.Zone_Reset(MZONEF_ALL);
                                 delete this;
                                 return;
                             }
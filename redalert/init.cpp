@@ -111,9 +111,6 @@ void Init_Random(void);
 
 #define ATTRACT_MODE_TIMEOUT 3600 // timeout for attract mode
 
-bool Load_Recording_Values(CCFileClass& file);
-bool Save_Recording_Values(CCFileClass& file);
-
 #ifdef FIXIT_VERSION_3
 bool Expansion_Dialog(bool bCounterstrike);
 #endif
@@ -169,14 +166,12 @@ bool Init_Game(int, char*[])
 {
     bool dosmode = (RESFACTOR == 1);
 /*
-**	Allocate the benchmark tracking objects only if the machine and
-**	compile flags indicate.
+**	Allocate the benchmark tracking objects only if a benchmark run was
+**	requested on the command line.
 */
-#if 0
-    if (Processor() >= 2) {
+    if (BenchTicks > 0) {
         Benches = new Benchmark[BENCH_COUNT];
     }
-#endif
 
     /*
     **	Initialize the encryption keys.
@@ -571,14 +566,26 @@ bool Select_Game(bool fade)
         ** the menu loop.  Hide the now-useless mouse pointer.
         */
         if (Session.Play && Session.RecordFile.Is_Available()) {
-            if (Session.RecordFile.Open(READ)) {
-                Load_Recording_Values(Session.RecordFile);
+            if (Replay.Open_Play(Session.RecordFile)) {
                 process = false;
                 Theme.Fade_Out();
             } else
                 Session.Play = false;
         }
 
+        /*
+        ** A benchmark run goes straight into its scenario. Use a fixed seed unless
+        ** one was given so that every run simulates exactly the same game.
+        */
+        if (Benches != NULL) {
+            Session.Type = GAME_NORMAL;
+            Scen.Set_Scenario_Name(BenchScenario);
+            if (CustomSeed == 0) {
+                CustomSeed = 1;
+            }
+            process = false;
+        }
+
         while (process) {
 
             /*
@@ -1042,8 +1049,7 @@ bool Select_Game(bool fade)
             case SEL_TIMEOUT:
                 if (Session.Attract && Session.RecordFile.Is_Available()) {
                     Session.Play = true;
-                    if (Session.RecordFile.Open(READ)) {
-                        Load_Recording_Values(Session.RecordFile);
+                    if (Replay.Open_Play(Session.RecordFile)) {
                         process = false;
                         Theme.Fade_Out();
                     } else {
@@ -1081,9 +1087,7 @@ bool Select_Game(bool fade)
     ** Save initialization values if we're recording this game.
     */
     if (Session.Record) {
-        if (Session.RecordFile.Open(WRITE)) {
-            Save_Recording_Values(Session.RecordFile);
-        } else {
+        if (!Replay.Open_Record(Session.RecordFile)) {
             Session.Record = false;
         }
     }
@@ -1304,6 +1308,7 @@ void Anim_Init(void)
 #endif
     AnimControl.Vmode = 0;
     AnimControl.OptionFlags |= VQAOPTF_CAPTIONS | VQAOPTF_EVA;
+    AnimControl.OptionFlags |= VQAOPTF_DECODETHREAD;
     if (SlowPalette) {
         AnimControl.OptionFlags |= VQAOPTF_SLOWPAL;
     }
@@ -1456,6 +1461,16 @@ bool Parse_Command_Line(int argc, char* argv[])
             continue;
         }
 
+        if (stricmp(string, "-CHECKCRC") == 0) {
+            Debug_Check_CRC = true;
+            continue;
+        }
+
+        if (stricmp(string, "-CHECKSNAPSHOT") == 0) {
+            Debug_Check_Snapshot = true;
+            continue;
+        }
+
 #endif
 
         /*
@@ -1501,6 +1516,45 @@ bool Parse_Command_Line(int argc, char* argv[])
             continue;
         }
 
+        /*
+        **	Run the given scenario for a number of ticks without rendering or frame
+        **	limiting, then write the benchmark statistics and exit.
+        */
+        if (stricmp(string, "-BENCHMARK") == 0) {
+            if (index + 2 >= argc || atoi(argv[index + 2]) <= 0) {
+                puts(TEXT_INVALID);
+                return (false);
+            }
+            strncpy(BenchScenario, argv[index + 1], sizeof(BenchScenario));
+            BenchScenario[sizeof(BenchScenario) - 1] = '\0';
+            strupr(BenchScenario);
+            BenchTicks = atoi(argv[index + 2]);
+            index += 2;
+            continue;
+        }
+
+        /*
+        **	During a benchmark run, also give every path request to the path finder that is
+        **	not in use and total up both of them. This slows the path finding probe down.
+        */
+        if (stricmp(string, "-COMPAREPATHS") == 0) {
+            BenchComparePaths = true;
+            continue;
+        }
+
+        /*
+        **	Start playing back a recording the given number of minutes into the game.
+        */
+        if (stricmp(string, "-SEEK") == 0) {
+            if (index + 1 >= argc || atoi(argv[index + 1]) < 0) {
+                puts(TEXT_INVALID);
+                return (false);
+            }
+            Replay.Seek(atoi(argv[index + 1]) * TICKS_PER_MINUTE);
+            index++;
+            continue;
+        }
+
 #ifdef CHEAT_KEYS
         /*
         **	Specify the random number seed (for debugging)
@@ -30,13 +30,14 @@
  *                                                                                             *
  *---------------------------------------------------------------------------------------------*
  * Functions:                                                                                  *
- *   LayerClass::Sort -- Perform an incremental sort pass on the layer's objects.              *
+ *   LayerClass::Sort -- Sorts the layer's objects by their sort Y coordinate.                 *
  *   LayerClass::Sorted_Add -- Adds object in sorted order to layer.                           *
  *   LayerClass::Submit -- Adds an object to a layer list.                                     *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 #include "function.h"
 #include "layer.h"
+#include "common/radixsort.h"
 
 /***********************************************************************************************
  * LayerClass::Submit -- Adds an object to a layer list.                                       *
@@ -71,6 +72,11 @@ bool LayerClass::Submit(ObjectClass const* object, bool sort)
  * LayerClass::Sort -- Handles sorting the objects in the layer.                               *
  *                                                                                             *
  *    This routine is used if the layer objects must be sorted and sorting is to occur now.    *
+ *    Normally one bubble pass is made, which moves objects that have gone out of order at     *
+ *    most one place back. When Rule.IsFullLayerSort is set, the objects are fully sorted by   *
+ *    Sort_Y() with a stable radix sort instead, so objects with the same value stay in the    *
+ *    order they were in. The two leave the layer in different orders, which shows up in the   *
+ *    sync CRC, so players using different settings will go out of sync.                       *
  *                                                                                             *
  * INPUT:   none                                                                               *
  *                                                                                             *
@@ -86,8 +92,55 @@ bool LayerClass::Submit(ObjectClass const* object, bool sort)
  *=============================================================================================*/
 void LayerClass::Sort(void)
 {
-    for (int index = 0; index < Count() - 1; index++) {
-        if (*(*this)[index + 1] < *(*this)[index]) {
+    static unsigned* _keys = NULL;
+    static unsigned* _keytemp = NULL;
+    static void** _itemtemp = NULL;
+    static int _size = 0;
+
+    int count = Count();
+    if (count < 2) {
+        return;
+    }
+
+    if (count > _size) {
+        delete[] _keys;
+        delete[] _keytemp;
+        delete[] _itemtemp;
+        _size = Length();
+        _keys = new unsigned[_size];
+        _keytemp = new unsigned[_size];
+        _itemtemp = new void*[_size];
+    }
+
+    /*
+    **	Objects move only a little each frame, so the layer is often still in order.
+    */
+    bool sorted = true;
+    for (int index = 0; index < count; index++) {
+        _keys[index] = (*this)[index]->Sort_Y();
+        if (index > 0 && _keys[index] < _keys[index - 1]) {
+            sorted = false;
+        }
+    }
+    if (sorted) {
+        return;
+    }
+
+    if (Rule.IsFullLayerSort) {
+        Radix_Sort(_keys, (void**)Vector, count, _keytemp, _itemtemp);
+        return;
+    }
+
+    /*
+    **	The single pass, comparing the sort values fetched above rather than calling the
+    **	comparison operator for every pair.
+    */
+    for (int index = 0; index < count - 1; index++) {
+        if (_keys[index + 1] < _keys[index]) {
+            unsigned key = _keys[index + 1];
+            _keys[index + 1] = _keys[index];
+            _keys[index] = key;
+
             ObjectClass* temp;
 
             temp = (*this)[index + 1];
@@ -471,23 +471,30 @@ int LoadOptionsClass::Process(void)
             if (!Save_Game(game_num, game_descr)) {
                 WWMessageBox().Process(TXT_ERROR_SAVING_GAME);
             } else {
+                /*
+                **	The file is written in the background while the speech plays.
+                */
                 Speak(VOX_SAVE1);
                 while (Is_Speaking()) {
                     Call_Back();
                 }
-                CDTimerClass<SystemTimerClass> timer;
-                //					timer.Start();
-                timer = TICKS_PER_SECOND * 4;
+                if (!Finish_Save_Game()) {
+                    WWMessageBox().Process(TXT_ERROR_SAVING_GAME);
+                } else {
+                    CDTimerClass<SystemTimerClass> timer;
+                    //					timer.Start();
+                    timer = TICKS_PER_SECOND * 4;
 
-                WWMessageBox().Process(TXT_GAME_WAS_SAVED, TXT_NONE, TXT_NONE);
+                    WWMessageBox().Process(TXT_GAME_WAS_SAVED, TXT_NONE, TXT_NONE);
 
-                /*
-                **	Delay to let the user read the message
-                */
-                while (timer > 0) {
-                    Call_Back();
+                    /*
+                    **	Delay to let the user read the message
+                    */
+                    while (timer > 0) {
+                        Call_Back();
+                    }
+                    Keyboard->Clear();
                 }
-                Keyboard->Clear();
             }
             process = false;
             break;
@@ -33,6 +33,10 @@
  *   LogicClass::AI -- Handles AI logic processing for game objects.                           *
  *   LogicClass::Debug_Dump -- Displays logic class status to the mono screen.                 *
  *   LogicClass::Detach -- Detatch the specified target from the logic system.                 *
+ *   LogicClass::Init_Triggers -- Builds the wake lists for the logic triggers.                *
+ *   LogicClass::Trigger_Deleted -- Notes that a general trigger has been deleted.             *
+ *   LogicClass::Wake_Trigger -- Flags a logic trigger to be examined.                         *
+ *   LogicClass::Wake_Triggers -- Flags the logic triggers that depend on an event.            *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 #include "function.h"
@@ -42,6 +46,307 @@
 
 static unsigned FramesPerSecond = 0;
 
+/*
+**	Logic triggers are only examined on the frames where one of their events could possibly
+**	be satisfied. Each trigger keeps the slot it had in LogicTriggers when the list was built,
+**	so walking the woken slots in ascending order visits triggers in the original list order.
+**	Elapsed time events are parked in a timer wheel until the frame that they expire on.
+*/
+#define TRIGGER_WHEEL_SIZE 256
+
+typedef enum TriggerWakeType
+{
+    TWAKE_POLL,    // Has an event that can only be checked by examining it every frame.
+    TWAKE_GLOBAL,  // Has a global flag set or clear event.
+    TWAKE_BRIDGE,  // Has the all bridges destroyed event.
+    TWAKE_MISSION, // Has the mission timer expired event.
+
+    TWAKE_COUNT,
+    TWAKE_FIRST = 0
+} TriggerWakeType;
+
+typedef struct
+{
+    TriggerClass* Trigger; // Trigger in this slot (NULL once it has been deleted).
+    int Due;               // Frame that the elapsed time event expires on.
+    short Next;            // Next slot in the same timer wheel bucket.
+    short Prev;            // Previous slot in the same timer wheel bucket.
+    bool IsScheduled;      // Is this slot currently in the timer wheel?
+} TriggerSlotType;
+
+static TriggerSlotType* TriggerSlots = NULL;
+static int TriggerSlotCount = 0;
+static short* TriggerSlotOf = NULL; // Slot of each trigger by heap ID (-1 if not a logic trigger).
+static int TriggerIDCount = 0;
+static unsigned* TriggerWake = NULL;
+static unsigned* TriggerMask[TWAKE_COUNT];
+static int TriggerWords = 0;
+static short TriggerWheel[TRIGGER_WHEEL_SIZE];
+static int TriggerWheelFrame = 0;
+static int TriggerCursor = -1; // Slot being examined by LogicClass::AI (-1 when not examining).
+static int TriggerStep = 0;    // Slots the cursor must step back over due to deleted triggers.
+
+static void Trigger_Set(unsigned* bits, int slot)
+{
+    bits[slot / 32] |= 1U << (slot % 32);
+}
+
+static void Trigger_Clear(unsigned* bits, int slot)
+{
+    bits[slot / 32] &= ~(1U << (slot % 32));
+}
+
+static bool Trigger_Test(unsigned const* bits, int slot)
+{
+    return ((bits[slot / 32] & (1U << (slot % 32))) != 0);
+}
+
+static void Trigger_Wake_Mask(TriggerWakeType wake)
+{
+    for (int index = 0; index < TriggerWords; index++) {
+        TriggerWake[index] |= TriggerMask[wake][index];
+    }
+}
+
+/*
+**	Fetches the first woken slot at or after the one specified (-1 if none).
+*/
+static int Next_Woken_Trigger(int slot)
+{
+    for (int word = slot / 32; word < TriggerWords; word++) {
+        unsigned bits = TriggerWake[word];
+        if (word == slot / 32) {
+            bits &= ~0U << (slot % 32);
+        }
+        if (bits != 0) {
+            int bit = 0;
+            while ((bits & 1) == 0) {
+                bits >>= 1;
+                bit++;
+            }
+            return (word * 32 + bit);
+        }
+    }
+    return (-1);
+}
+
+static void Trigger_Unschedule(int slot)
+{
+    TriggerSlotType& ts = TriggerSlots[slot];
+    if (ts.IsScheduled) {
+        if (ts.Prev != -1) {
+            TriggerSlots[ts.Prev].Next = ts.Next;
+        } else {
+            TriggerWheel[ts.Due & (TRIGGER_WHEEL_SIZE - 1)] = ts.Next;
+        }
+        if (ts.Next != -1) {
+            TriggerSlots[ts.Next].Prev = ts.Prev;
+        }
+        ts.IsScheduled = false;
+    }
+}
+
+static void Trigger_Schedule(int slot, int due)
+{
+    TriggerSlotType& ts = TriggerSlots[slot];
+    short& head = TriggerWheel[due & (TRIGGER_WHEEL_SIZE - 1)];
+
+    ts.Due = due;
+    ts.Prev = -1;
+    ts.Next = head;
+    if (head != -1) {
+        TriggerSlots[head].Prev = slot;
+    }
+    head = slot;
+    ts.IsScheduled = true;
+}
+
+/*
+**	Determines which wake lists a trigger type belongs to. Events that are only ever tripped
+**	by an explicit Spring() call elsewhere can never succeed from the logic loop on their own.
+*/
+static unsigned Trigger_Wake_Kinds(TEventType event)
+{
+    switch (event) {
+    case TEVENT_NONE:
+    case TEVENT_PLAYER_ENTERED:
+    case TEVENT_SPIED:
+    case TEVENT_DISCOVERED:
+    case TEVENT_ATTACKED:
+    case TEVENT_DESTROYED:
+    case TEVENT_CROSS_HORIZONTAL:
+    case TEVENT_CROSS_VERTICAL:
+    case TEVENT_ENTERS_ZONE:
+    case TEVENT_TIME:
+        return (0);
+
+    case TEVENT_GLOBAL_SET:
+    case TEVENT_GLOBAL_CLEAR:
+        return (1 << TWAKE_GLOBAL);
+
+    case TEVENT_ALL_BRIDGES_DESTROYED:
+        return (1 << TWAKE_BRIDGE);
+
+    case TEVENT_MISSION_TIMER_EXPIRED:
+        return (1 << TWAKE_MISSION);
+
+    default:
+        return (1 << TWAKE_POLL);
+    }
+}
+
+/*
+**	Checks if the event could be satisfied when examined by the logic loop. Elapsed time
+**	events that have yet to expire lower the due frame to when they will.
+*/
+static bool Trigger_Event_Ready(TEventClass const& event, TDEventClass const& td, int& due)
+{
+    if (td.IsTripped) {
+        return (true);
+    }
+
+    switch (event.Event) {
+    case TEVENT_GLOBAL_SET:
+        return (Scen.GlobalFlags[event.Data.Value]);
+
+    case TEVENT_GLOBAL_CLEAR:
+        return (!Scen.GlobalFlags[event.Data.Value]);
+
+    case TEVENT_MISSION_TIMER_EXPIRED:
+        return (Scen.MissionTimer.Is_Active() && Scen.MissionTimer == 0);
+
+    case TEVENT_ALL_BRIDGES_DESTROYED:
+        return (Scen.BridgeCount == 0);
+
+    case TEVENT_TIME:
+        if (td.Timer == 0) {
+            return (true);
+        }
+        due = min(due, Frame + (int)td.Timer);
+        return (false);
+
+    default:
+        return (false);
+    }
+}
+
+/*
+**	Decides whether an examined trigger needs examining again on the next pass, or else
+**	parks it in the timer wheel until its elapsed time event expires.
+*/
+static void Trigger_Update(int slot)
+{
+    TriggerClass* trig = TriggerSlots[slot].Trigger;
+
+    Trigger_Unschedule(slot);
+    if (trig == NULL) {
+        return;
+    }
+
+    TriggerTypeClass const* tp = trig->Class;
+    int due = 0x7FFFFFFF;
+    bool ready = Trigger_Test(TriggerMask[TWAKE_POLL], slot);
+    if (Trigger_Event_Ready(tp->Event1, trig->Event1, due)) {
+        ready = true;
+    }
+    if (tp->EventControl != MULTI_ONLY && Trigger_Event_Ready(tp->Event2, trig->Event2, due)) {
+        ready = true;
+    }
+
+    if (ready) {
+        Trigger_Set(TriggerWake, slot);
+    } else {
+        Trigger_Clear(TriggerWake, slot);
+        if (due != 0x7FFFFFFF) {
+            Trigger_Schedule(slot, due);
+        }
+    }
+}
+
+/*
+**	Wakes every trigger whose elapsed time event has expired since the last pass.
+*/
+static void Trigger_Wheel_AI(void)
+{
+    int frames = Frame - TriggerWheelFrame;
+    if (frames < 0 || frames > TRIGGER_WHEEL_SIZE) {
+        frames = TRIGGER_WHEEL_SIZE;
+    }
+
+    for (int index = 1; index <= frames; index++) {
+        int slot = TriggerWheel[(TriggerWheelFrame + index) & (TRIGGER_WHEEL_SIZE - 1)];
+        while (slot != -1) {
+            int next = TriggerSlots[slot].Next;
+            if (TriggerSlots[slot].Due <= Frame) {
+                Trigger_Unschedule(slot);
+                Trigger_Set(TriggerWake, slot);
+            }
+            slot = next;
+        }
+    }
+    TriggerWheelFrame = Frame;
+}
+
+/*
+**	Fetches the slot to continue examining from after the one specified. Walking the full
+**	list used to step its index back once for every general trigger deleted that did not
+**	shift the list, and this preserves that exactly.
+*/
+static int Trigger_Resume(int slot)
+{
+    int resume = slot + 1;
+    for (; TriggerStep > 0; TriggerStep--) {
+        int prev = resume - 1;
+        while (prev >= 0 && TriggerSlots[prev].Trigger == NULL) {
+            prev--;
+        }
+        if (prev < 0) {
+            break;
+        }
+        resume = prev;
+    }
+    TriggerStep = 0;
+    return (resume);
+}
+
+/*
+**	Springs the general events for a logic trigger, in the order the events are checked for.
+*/
+static void Trigger_AI(TriggerClass* trig)
+{
+    /*
+    **	Global changed trigger event might be triggered.
+    */
+    if (Scen.IsGlobalChanged) {
+        if (trig->Spring(TEVENT_GLOBAL_SET))
+            return;
+        if (trig->Spring(TEVENT_GLOBAL_CLEAR))
+            return;
+    }
+
+    /*
+    **	Bridge change event.
+    */
+    if (Scen.IsBridgeChanged) {
+        if (trig->Spring(TEVENT_ALL_BRIDGES_DESTROYED))
+            return;
+    }
+
+    /*
+    **	General time expire trigger events can be sprung without warning.
+    */
+    if (trig->Spring(TEVENT_TIME))
+        return;
+
+    /*
+    **	The mission timer expiration trigger event might spring if the timer is active
+    **	but at a value of zero.
+    */
+    if (Scen.MissionTimer.Is_Active() && Scen.MissionTimer == 0) {
+        trig->Spring(TEVENT_MISSION_TIMER_EXPIRED);
+    }
+}
+
 #ifdef CHEAT_KEYS
 /***********************************************************************************************
  * LogicClass::Debug_Dump -- Displays logic class status to the mono screen.                   *
@@ -219,44 +524,27 @@ void LogicClass::AI(void)
     Scen.Do_Fade_AI();
 
     /*
-    **	Handle any general timer trigger events.
+    **	Handle any general timer trigger events. Only the triggers that were woken need to be
+    **	examined since none of the others could spring from the events checked for here.
     */
-    for (LogicTriggerID = 0; LogicTriggerID < LogicTriggers.Count(); LogicTriggerID++) {
-        TriggerClass* trig = LogicTriggers[LogicTriggerID];
-
-        /*
-        **	Global changed trigger event might be triggered.
-        */
-        if (Scen.IsGlobalChanged) {
-            if (trig->Spring(TEVENT_GLOBAL_SET))
-                continue;
-            if (trig->Spring(TEVENT_GLOBAL_CLEAR))
-                continue;
-        }
-
-        /*
-        **	Bridge change event.
-        */
-        if (Scen.IsBridgeChanged) {
-            if (trig->Spring(TEVENT_ALL_BRIDGES_DESTROYED))
-                continue;
-        }
+    Trigger_Wheel_AI();
+    Trigger_Wake_Mask(TWAKE_POLL);
+    if (Scen.MissionTimer.Is_Active() && Scen.MissionTimer == 0) {
+        Trigger_Wake_Mask(TWAKE_MISSION);
+    }
+    for (TriggerCursor = Next_Woken_Trigger(0); TriggerCursor != -1;
+         TriggerCursor = Next_Woken_Trigger(Trigger_Resume(TriggerCursor))) {
+        Trigger_Clear(TriggerWake, TriggerCursor);
+        TriggerStep = 0;
 
-        /*
-        **	General time expire trigger events can be sprung without warning.
-        */
-        if (trig->Spring(TEVENT_TIME))
-            continue;
+        Trigger_AI(TriggerSlots[TriggerCursor].Trigger);
 
-        /*
-        **	The mission timer expiration trigger event might spring if the timer is active
-        **	but at a value of zero.
-        */
         if (Scen.MissionTimer.Is_Active() && Scen.MissionTimer == 0) {
-            if (trig->Spring(TEVENT_MISSION_TIMER_EXPIRED))
-                continue;
+            Trigger_Wake_Mask(TWAKE_MISSION);
         }
+        Trigger_Update(TriggerCursor);
     }
+    TriggerCursor = -1;
 
     if (Scen.MissionTimer.Is_Active()) {
         int secs = Scen.MissionTimer / TICKS_PER_SECOND;
@@ -474,6 +762,177 @@ void LogicClass::Detach(TARGET target, bool)
                 index--;
             }
         }
+
+        TriggerClass* trig = As_Trigger(target);
+        if (trig != NULL && trig->ID >= 0 && trig->ID < TriggerIDCount && TriggerSlotOf[trig->ID] != -1) {
+            int slot = TriggerSlotOf[trig->ID];
+            if (TriggerSlots[slot].Trigger == trig) {
+                Trigger_Unschedule(slot);
+                TriggerSlots[slot].Trigger = NULL;
+                for (int wake = TWAKE_FIRST; wake < TWAKE_COUNT; wake++) {
+                    Trigger_Clear(TriggerMask[wake], slot);
+                }
+                Trigger_Clear(TriggerWake, slot);
+
+                /*
+                **	Removing a slot at or before the cursor shifts the list under it, which
+                **	cancels the step back that the trigger's deletion will ask for.
+                */
+                if (TriggerCursor != -1 && slot <= TriggerCursor) {
+                    TriggerStep--;
+                }
+            }
+            TriggerSlotOf[trig->ID] = -1;
+        }
+    }
+}
+
+/***********************************************************************************************
+ * LogicClass::Init_Triggers -- Builds the wake lists for the logic triggers.                  *
+ *                                                                                             *
+ *    This routine must be called whenever the LogicTriggers list has been rebuilt. Each       *
+ *    trigger is given a slot in list order and registered for the events that could spring    *
+ *    it from the logic loop. Every trigger is examined on the next pass, which then decides   *
+ *    when each needs examining again.                                                         *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void LogicClass::Init_Triggers(void)
+{
+    delete[] TriggerSlots;
+    delete[] TriggerSlotOf;
+    delete[] TriggerWake;
+    for (int wake = TWAKE_FIRST; wake < TWAKE_COUNT; wake++) {
+        delete[] TriggerMask[wake];
+    }
+
+    TriggerSlotCount = LogicTriggers.Count();
+    TriggerIDCount = Triggers.Length();
+    TriggerWords = (TriggerSlotCount + 31) / 32;
+
+    TriggerSlots = new TriggerSlotType[TriggerSlotCount + 1];
+    TriggerSlotOf = new short[TriggerIDCount + 1];
+    TriggerWake = new unsigned[TriggerWords + 1];
+    for (int wake = TWAKE_FIRST; wake < TWAKE_COUNT; wake++) {
+        TriggerMask[wake] = new unsigned[TriggerWords + 1];
+        memset(TriggerMask[wake], 0, (TriggerWords + 1) * sizeof(unsigned));
+    }
+    memset(TriggerWake, 0, (TriggerWords + 1) * sizeof(unsigned));
+
+    for (int index = 0; index < TriggerIDCount; index++) {
+        TriggerSlotOf[index] = -1;
+    }
+    for (int index = 0; index < TRIGGER_WHEEL_SIZE; index++) {
+        TriggerWheel[index] = -1;
+    }
+    TriggerWheelFrame = Frame;
+    TriggerCursor = -1;
+    TriggerStep = 0;
+
+    for (int slot = 0; slot < TriggerSlotCount; slot++) {
+        TriggerClass* trig = LogicTriggers[slot];
+        TriggerTypeClass const* tp = trig->Class;
+
+        TriggerSlots[slot].Trigger = trig;
+        TriggerSlots[slot].Due = 0;
+        TriggerSlots[slot].Next = -1;
+        TriggerSlots[slot].Prev = -1;
+        TriggerSlots[slot].IsScheduled = false;
+        if (trig->ID >= 0 && trig->ID < TriggerIDCount) {
+            TriggerSlotOf[trig->ID] = slot;
+        }
+
+        unsigned kinds = Trigger_Wake_Kinds(tp->Event1.Event);
+        if (tp->EventControl != MULTI_ONLY) {
+            kinds |= Trigger_Wake_Kinds(tp->Event2.Event);
+        }
+        for (int wake = TWAKE_FIRST; wake < TWAKE_COUNT; wake++) {
+            if (kinds & (1 << wake)) {
+                Trigger_Set(TriggerMask[wake], slot);
+            }
+        }
+        Trigger_Set(TriggerWake, slot);
+    }
+}
+
+/***********************************************************************************************
+ * LogicClass::Wake_Trigger -- Flags a logic trigger to be examined.                           *
+ *                                                                                             *
+ *    This is called whenever the event state of a trigger might have changed. If it is one    *
+ *    of the logic triggers, it will be examined on the next pass (or later in the current     *
+ *    pass if it has not been reached yet).                                                    *
+ *                                                                                             *
+ * INPUT:   trigger  -- Pointer to the trigger to wake.                                        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void LogicClass::Wake_Trigger(TriggerClass const* trigger)
+{
+    if (trigger->ID >= 0 && trigger->ID < TriggerIDCount) {
+        int slot = TriggerSlotOf[trigger->ID];
+        if (slot != -1 && TriggerSlots[slot].Trigger == trigger) {
+            Trigger_Set(TriggerWake, slot);
+        }
+    }
+}
+
+/***********************************************************************************************
+ * LogicClass::Wake_Triggers -- Flags the logic triggers that depend on an event.              *
+ *                                                                                             *
+ *    Call this when the game state behind one of the general trigger events changes, so       *
+ *    that every logic trigger that checks for that event gets examined.                       *
+ *                                                                                             *
+ * INPUT:   event    -- The event whose state has changed. Either global flag event wakes the  *
+ *                      triggers for both.                                                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void LogicClass::Wake_Triggers(TEventType event)
+{
+    switch (event) {
+    case TEVENT_GLOBAL_SET:
+    case TEVENT_GLOBAL_CLEAR:
+        Trigger_Wake_Mask(TWAKE_GLOBAL);
+        break;
+
+    case TEVENT_ALL_BRIDGES_DESTROYED:
+        Trigger_Wake_Mask(TWAKE_BRIDGE);
+        break;
+
+    case TEVENT_MISSION_TIMER_EXPIRED:
+        Trigger_Wake_Mask(TWAKE_MISSION);
+        break;
+
+    default:
+        break;
+    }
+}
+
+/***********************************************************************************************
+ * LogicClass::Trigger_Deleted -- Notes that a general trigger has been deleted.               *
+ *                                                                                             *
+ *    Deleting any general trigger while the logic triggers are being examined steps the       *
+ *    examination back by one trigger, unless the list shifted under the cursor to make up     *
+ *    for it.                                                                                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void LogicClass::Trigger_Deleted(void)
+{
+    if (TriggerCursor != -1) {
+        TriggerStep++;
     }
 }
 
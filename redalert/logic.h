@@ -37,6 +37,8 @@
 
 #include "layer.h"
 
+class TriggerClass;
+
 /***********************************************************************************************
 **	Game logic processing is controlled by this class. The graphic and AI logic is handled
 **	separately so that on slower machines, the graphic display is least affected.
@@ -46,6 +48,10 @@ class LogicClass : public LayerClass
 public:
     void AI(void);
     void Detach(TARGET target, bool all = true);
+    void Init_Triggers(void);
+    void Wake_Trigger(TriggerClass const* trigger);
+    void Wake_Triggers(TEventType event);
+    void Trigger_Deleted(void);
 #ifdef CHEAT_KEYS
     void Debug_Dump(MonoClass* mono) const;
 #endif
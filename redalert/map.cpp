@@ -50,12 +50,22 @@
  *   MapClass::Place_Random_Crate -- Places a crate at random location on map.                 *
  *   MapClass::Read_Binary -- Reads the binary data from the straw specified.                  *
  *   MapClass::Remove_Crate -- Remove a crate from the specified cell.                         *
+ *   MapClass::Sector_Build -- Records the zone crossings between all adjacent sectors.        *
  *   MapClass::Set_Map_Dimensions -- Initialize the map.                                       *
  *   MapClass::Sight_From -- Mark as visible the cells within a specified radius.              *
+ *   MapClass::Threat_Down -- Counts an object that has been placed into a cell.               *
+ *   MapClass::Threat_Houses -- Fetches the owners that have objects in the bucket of a cell.  *
+ *   MapClass::Threat_Owner -- Moves the counts of an object over to its new owner.            *
+ *   MapClass::Threat_Recount -- Rebuilds the bucket counts from the occupiers of every cell.  *
+ *   MapClass::Threat_Up -- Stops counting an object that has been removed from a cell.        *
  *   MapClass::Validate -- validates every cell on the map                                     *
  *   MapClass::Write_Binary -- Pipes the map template data to the destination specified.       *
+ *   MapClass::Zone_Change -- Updates the zones for cells that changed passability.            *
+ *   MapClass::Zone_Mark -- Notes a cell that may have changed passability.                    *
  *   MapClass::Zone_Reset -- Resets all zone numbers to match the map.                         *
  *   MapClass::Zone_Span -- Flood fills the specified zone from the cell origin.               *
+ *   MapClass::Zone_Verify -- Checks the zones against a full recalculation.                   *
+ *   MapClass::Zone_Waypoint -- Plans across the sectors and picks the next cell to head for.  *
  *   MapClass::Pick_Random_Location -- Picks a random location on the map.                     *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
@@ -63,6 +73,135 @@
 #include "lcwpipe.h"
 #include "lcwstraw.h"
 #include "common/endianness.h"
+#include "common/zoneupdate.h"
+
+/*
+**	The zone graph. Wherever a movement zone continues from one sector into the next, the
+**	run of border cells is recorded as a portal in both sectors. It is rebuilt on demand
+**	after the zones it was built from have been reset.
+*/
+typedef struct
+{
+    CELL Cell;          // Middle of the run, inside this sector.
+    CELL Next;          // Matching cell inside the adjacent sector.
+    unsigned char Zone; // Zone number that both cells belong to.
+} SectorPortalType;
+
+static SectorPortalType SectorPortals[MZONE_COUNT][MAP_TOTAL_SECTORS][SECTOR_PORTALS];
+static unsigned char SectorPortalCount[MZONE_COUNT][MAP_TOTAL_SECTORS];
+static bool SectorValid[MZONE_COUNT];
+
+/*
+**	Per sector state of the zone graph planner.
+*/
+typedef struct
+{
+    unsigned short Search; // Search in which this sector was reached.
+    unsigned short Closed; // Search in which this sector was expanded.
+    short From;            // Sector the best known route came from.
+    CELL Entry;            // Cell the best known route enters this sector at.
+    int Cost;              // Scaled cost of the best known route to the entry cell.
+} SectorNodeType;
+
+static SectorNodeType SectorNodes[MAP_TOTAL_SECTORS];
+static short SectorOpen[MAP_TOTAL_SECTORS];
+static unsigned short SectorSearch = 0;
+
+/*
+**	Presents one zone type of the map to ZoneUpdateClass, which keeps the zones up to date in
+**	place when cells change passability.
+*/
+class MapZoneClass
+{
+public:
+    MapZoneClass(MapClass& map, MZoneType check)
+        : Map(map)
+        , Check(check)
+    {
+    }
+
+    int Cells(void) const
+    {
+        return (MAP_CELL_TOTAL);
+    }
+
+    int X(int cell) const
+    {
+        return (Cell_X(cell));
+    }
+
+    int Y(int cell) const
+    {
+        return (Cell_Y(cell));
+    }
+
+    int XY(int x, int y) const
+    {
+        return (XY_Cell(x, y));
+    }
+
+    bool Inside(int x, int y) const
+    {
+        return (y >= Map.MapCellY && y < Map.MapCellY + Map.MapCellHeight && x >= Map.MapCellX
+                && x < Map.MapCellX + Map.MapCellWidth);
+    }
+
+    bool Clear(int cell) const
+    {
+        return (Inside(Cell_X(cell), Cell_Y(cell))
+                && Map[(CELL)cell].Is_Clear_To_Move(
+                    Check == MZONE_WATER ? SPEED_FLOAT : SPEED_TRACK, true, true, -1, Check));
+    }
+
+    unsigned char& Zone(int cell)
+    {
+        return (Map[(CELL)cell].Zones[Check]);
+    }
+
+private:
+    MapClass& Map;
+    MZoneType Check;
+};
+
+static ZoneUpdateClass<MapZoneClass> ZoneUpdate[MZONE_COUNT];
+
+/*
+**	Count of the techno objects in the cells of each bucket, by owner. A bit is set in the
+**	house mask of a bucket for every owner with a non-zero count.
+*/
+static unsigned short BucketCount[MAP_TOTAL_BUCKETS][HOUSE_COUNT];
+static unsigned BucketHouses[MAP_TOTAL_BUCKETS];
+
+inline static int Bucket_Of(CELL cell)
+{
+    return ((Cell_Y(cell) / BUCKET_SIZE) * MAP_BUCKET_WIDTH + (Cell_X(cell) / BUCKET_SIZE));
+}
+
+inline static void Bucket_Add(int bucket, HousesType house)
+{
+    if (BucketCount[bucket][house]++ == 0) {
+        BucketHouses[bucket] |= (1U << house);
+    }
+}
+
+inline static void Bucket_Remove(int bucket, HousesType house)
+{
+    if (BucketCount[bucket][house] > 0 && --BucketCount[bucket][house] == 0) {
+        BucketHouses[bucket] &= ~(1U << house);
+    }
+}
+
+inline static int Sector_Of(CELL cell)
+{
+    return ((Cell_Y(cell) / SECTOR_SIZE) * MAP_SECTOR_WIDTH + (Cell_X(cell) / SECTOR_SIZE));
+}
+
+inline static int Sector_Distance(CELL cell1, CELL cell2)
+{
+    int xdiff = abs(Cell_X(cell1) - Cell_X(cell2));
+    int ydiff = abs(Cell_Y(cell1) - Cell_Y(cell2));
+    return (10 * max(xdiff, ydiff) + 4 * min(xdiff, ydiff));
+}
 
 #define MCW MAP_CELL_W
 int const MapClass::RadiusOffset[] = {
@@ -518,6 +657,8 @@ void MapClass::Init_Cells(void)
     for (int index = 0; index < MAP_CELL_TOTAL; index++) {
         new (&Array[index]) CellClass;
     }
+    memset(BucketCount, 0, sizeof(BucketCount));
+    memset(BucketHouses, 0, sizeof(BucketHouses));
 }
 
 /***********************************************************************************************
@@ -1791,15 +1932,26 @@ ObjectClass* MapClass::Close_Object(COORDINATE coord) const
  *                                                                                             *
  * OUTPUT:  none                                                                               *
  *                                                                                             *
- * WARNINGS:   This is a time consuming routine. Call it as infrequently as possible. It must  *
- *             be called whenever something that would affect contiguousness occurs. Example:  *
- *             when a bridge is built or destroyed.                                            *
+ * WARNINGS:   This is a time consuming routine. Call it as infrequently as possible. When     *
+ *             only a few cells change passability, such as when a wall is built or a bridge   *
+ *             is destroyed, use Zone_Change() instead.                                        *
  *                                                                                             *
  * HISTORY:                                                                                    *
  *   09/22/1995 JLB : Created.                                                                 *
  *=============================================================================================*/
 bool MapClass::Zone_Reset(int method)
 {
+    bool overflow[MZONE_COUNT];
+
+    /*
+    **	The zone graph of any zone type being recalculated is now out of date.
+    */
+    for (int mzone = MZONE_FIRST; mzone < MZONE_COUNT; mzone++) {
+        if (method & (1 << mzone)) {
+            SectorValid[mzone] = false;
+        }
+    }
+
     /*
     **	Zero out all zones to a null state.
     */
@@ -1828,6 +1980,7 @@ bool MapClass::Zone_Reset(int method)
                 zone++;
             }
         }
+        overflow[MZONE_NORMAL] = (zone > 256);
     }
 
     /*
@@ -1840,6 +1993,7 @@ bool MapClass::Zone_Reset(int method)
                 zone++;
             }
         }
+        overflow[MZONE_CRUSHER] = (zone > 256);
     }
 
     /*
@@ -1852,6 +2006,7 @@ bool MapClass::Zone_Reset(int method)
                 zone++;
             }
         }
+        overflow[MZONE_DESTROYER] = (zone > 256);
     }
 
     /*
@@ -1864,6 +2019,17 @@ bool MapClass::Zone_Reset(int method)
                 zone++;
             }
         }
+        overflow[MZONE_WATER] = (zone > 256);
+    }
+
+    /*
+    **	Count the cells in each zone so that the zones can be updated in place afterwards.
+    */
+    for (int mzone = MZONE_FIRST; mzone < MZONE_COUNT; mzone++) {
+        if (method & (1 << mzone)) {
+            MapZoneClass zones(*this, MZoneType(mzone));
+            ZoneUpdate[mzone].Recount(zones, overflow[mzone]);
+        }
     }
 
     return (false);
@@ -1971,6 +2137,493 @@ int MapClass::Zone_Span(CELL cell, int zone, MZoneType check)
     return (filled);
 }
 
+/***********************************************************************************************
+ * MapClass::Zone_Mark -- Notes a cell that may have changed passability.                      *
+ *                                                                                             *
+ *    The cell is remembered for every zone type, and is checked the next time the zones of    *
+ *    that type are brought up to date by Zone_Change(). This is called whenever the land      *
+ *    type of a cell is worked out again, or a terrain object is placed on or lifted off it.   *
+ *                                                                                             *
+ * INPUT:   cell  -- The cell that may have changed.                                           *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void MapClass::Zone_Mark(CELL cell)
+{
+    for (int mzone = MZONE_FIRST; mzone < MZONE_COUNT; mzone++) {
+        MapZoneClass zones(*this, MZoneType(mzone));
+        ZoneUpdate[mzone].Changed(zones, cell);
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Zone_Change -- Updates the zones for cells that changed passability.              *
+ *                                                                                             *
+ *    This brings the zone numbers up to date after the cells in the area specified have been  *
+ *    made passable or impassable, such as when a wall is built or removed or a bridge is      *
+ *    destroyed or repaired. Any other cells noted by Zone_Mark() since the zones were last    *
+ *    brought up to date are included as well. Only the zones from the first one affected by   *
+ *    the change on are filled again. The zones end up exactly as Zone_Reset() would leave     *
+ *    them, zone numbers included.                                                             *
+ *                                                                                             *
+ * INPUT:   cell     -- The upper left cell of the changed area.                               *
+ *                                                                                             *
+ *          method   -- The zone types to update (MZONEF_ flags).                              *
+ *                                                                                             *
+ *          width    -- The width of the changed area in cells.                                *
+ *                                                                                             *
+ *          height   -- The height of the changed area in cells.                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Zone types not specified are left as they are, but will still take the area     *
+ *             into account the next time they are updated. Should the zone numbers run out,   *
+ *             the zone type is fully recalculated by Zone_Reset().                            *
+ *=============================================================================================*/
+void MapClass::Zone_Change(CELL cell, int method, int width, int height)
+{
+    BStart(BENCH_ZONE);
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            CELL here = cell + y * MAP_CELL_W + x;
+            if ((unsigned)here < MAP_CELL_TOTAL) {
+                Zone_Mark(here);
+            }
+        }
+    }
+
+    for (int mzone = MZONE_FIRST; mzone < MZONE_COUNT; mzone++) {
+        if (!(method & (1 << mzone)))
+            continue;
+
+        MZoneType check = MZoneType(mzone);
+        SectorValid[check] = false;
+
+        MapZoneClass zones(*this, check);
+        if (!ZoneUpdate[check].Update(zones)) {
+            Zone_Reset(1 << check);
+        }
+    }
+
+    BEnd(BENCH_ZONE);
+
+    if (Debug_Check_Map) {
+        Zone_Verify(method);
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Zone_Verify -- Checks the zones against a full recalculation.                     *
+ *                                                                                             *
+ *    This is a debugging aid for Zone_Change(). Each zone type specified is recalculated      *
+ *    from scratch and compared to the zones as they were, which must match cell for cell.     *
+ *    The zones are left as they were.                                                         *
+ *                                                                                             *
+ * INPUT:   method   -- The zone types to check (MZONEF_ flags).                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Did the zones match the recalculation?                                       *
+ *                                                                                             *
+ * WARNINGS:   This is as slow as Zone_Reset(). Zone_Change() calls it when -CHECKMAP is on.   *
+ *=============================================================================================*/
+bool MapClass::Zone_Verify(int method)
+{
+    static unsigned char _zones[MAP_CELL_TOTAL];
+    bool valid = true;
+
+    for (int mzone = MZONE_FIRST; mzone < MZONE_COUNT; mzone++) {
+        if (!(method & (1 << mzone)))
+            continue;
+
+        for (int index = 0; index < MAP_CELL_TOTAL; index++) {
+            _zones[index] = Array[index].Zones[mzone];
+        }
+        ZoneUpdateClass<MapZoneClass> counts = ZoneUpdate[mzone];
+
+        Zone_Reset(1 << mzone);
+
+        for (int index = 0; index < MAP_CELL_TOTAL; index++) {
+            if (_zones[index] != Array[index].Zones[mzone]) {
+                DBG_ERROR("Zone_Verify: zone type %d differs from a full recalculation at cell %d.", mzone, index);
+                valid = false;
+                break;
+            }
+        }
+
+        for (int index = 0; index < MAP_CELL_TOTAL; index++) {
+            Array[index].Zones[mzone] = _zones[index];
+        }
+        ZoneUpdate[mzone] = counts;
+    }
+    return (valid);
+}
+
+/***********************************************************************************************
+ * Sector_Link -- Records a zone crossing in the sectors on both sides of it.                  *
+ *                                                                                             *
+ * INPUT:   check -- The zone type the crossing is for.                                        *
+ *                                                                                             *
+ *          cell  -- The cell on one side of the sector border.                                *
+ *                                                                                             *
+ *          next  -- The adjacent cell on the other side of the border.                        *
+ *                                                                                             *
+ *          zone  -- The zone number both cells belong to.                                     *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   A sector that has run out of room for portals silently drops the crossing.      *
+ *             The path finder still gets there, it just will not plan through it.             *
+ *=============================================================================================*/
+static void Sector_Link(MZoneType check, CELL cell, CELL next, int zone)
+{
+    int sector = Sector_Of(cell);
+    if (SectorPortalCount[check][sector] < SECTOR_PORTALS) {
+        SectorPortalType& portal = SectorPortals[check][sector][SectorPortalCount[check][sector]++];
+        portal.Cell = cell;
+        portal.Next = next;
+        portal.Zone = zone;
+    }
+
+    sector = Sector_Of(next);
+    if (SectorPortalCount[check][sector] < SECTOR_PORTALS) {
+        SectorPortalType& portal = SectorPortals[check][sector][SectorPortalCount[check][sector]++];
+        portal.Cell = next;
+        portal.Next = cell;
+        portal.Zone = zone;
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Sector_Build -- Records the zone crossings between all adjacent sectors.          *
+ *                                                                                             *
+ *    This scans the borders between the sectors for the specified zone type. Every run of     *
+ *    border cells where the same zone continues straight across the border becomes one        *
+ *    portal placed at the middle of the run. Sectors that only touch at a corner are linked   *
+ *    when the zone continues diagonally across that corner.                                   *
+ *                                                                                             *
+ * INPUT:   check -- The zone type to build the zone graph for.                                *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The zones must be up to date. Zone_Waypoint() calls this as needed.             *
+ *=============================================================================================*/
+void MapClass::Sector_Build(MZoneType check)
+{
+    memset(SectorPortalCount[check], 0, sizeof(SectorPortalCount[check]));
+
+    for (int sy = 0; sy < MAP_SECTOR_HEIGHT; sy++) {
+        for (int sx = 0; sx < MAP_SECTOR_WIDTH; sx++) {
+            int left = sx * SECTOR_SIZE;
+            int top = sy * SECTOR_SIZE;
+            int right = left + SECTOR_SIZE - 1;
+            int bottom = top + SECTOR_SIZE - 1;
+
+            /*
+            **	Scan the east border (downward) and then the south border (rightward) for
+            **	runs of cells that share a zone with the cell across the border.
+            */
+            for (int side = 0; side < 2; side++) {
+                if (side == 0 && sx + 1 >= MAP_SECTOR_WIDTH)
+                    continue;
+                if (side == 1 && sy + 1 >= MAP_SECTOR_HEIGHT)
+                    continue;
+
+                CELL cell = (side == 0) ? XY_Cell(right, top) : XY_Cell(left, bottom);
+                int step = (side == 0) ? MAP_CELL_W : 1;
+                int across = (side == 0) ? 1 : MAP_CELL_W;
+                int start = 0;
+                int zone = 0;
+
+                for (int index = 0; index <= SECTOR_SIZE; index++) {
+                    int here = 0;
+                    if (index < SECTOR_SIZE) {
+                        CELL edge = cell + index * step;
+                        here = Array[edge].Zones[check];
+                        if (here != Array[edge + across].Zones[check]) {
+                            here = 0;
+                        }
+                    }
+
+                    if (here != zone) {
+                        if (zone != 0) {
+                            CELL middle = cell + ((start + index - 1) / 2) * step;
+                            Sector_Link(check, middle, middle + across, zone);
+                        }
+                        zone = here;
+                        start = index;
+                    }
+                }
+            }
+
+            /*
+            **	Link across the south east and south west corners.
+            */
+            if (sx + 1 < MAP_SECTOR_WIDTH && sy + 1 < MAP_SECTOR_HEIGHT) {
+                CELL cell = XY_Cell(right, bottom);
+                int zone = Array[cell].Zones[check];
+                if (zone != 0 && zone == Array[cell + MAP_CELL_W + 1].Zones[check]) {
+                    Sector_Link(check, cell, cell + MAP_CELL_W + 1, zone);
+                }
+            }
+            if (sx > 0 && sy + 1 < MAP_SECTOR_HEIGHT) {
+                CELL cell = XY_Cell(left, bottom);
+                int zone = Array[cell].Zones[check];
+                if (zone != 0 && zone == Array[cell + MAP_CELL_W - 1].Zones[check]) {
+                    Sector_Link(check, cell, cell + MAP_CELL_W - 1, zone);
+                }
+            }
+        }
+    }
+
+    SectorValid[check] = true;
+}
+
+/***********************************************************************************************
+ * MapClass::Zone_Waypoint -- Plans across the sectors and picks the next cell to head for.    *
+ *                                                                                             *
+ *    For a long trip, a route is first planned over the zone graph, moving from sector to     *
+ *    sector through the portals of the zone the trip starts in. The cell path finder then     *
+ *    only needs to search as far as where this route enters the sector SECTOR_LOOKAHEAD       *
+ *    sectors along it. The rest of the trip is planned again when that leg has been walked.   *
+ *                                                                                             *
+ * INPUT:   source   -- The cell the trip starts from.                                         *
+ *                                                                                             *
+ *          dest     -- The cell the trip should end at.                                       *
+ *                                                                                             *
+ *          check    -- The zone type of the object making the trip.                           *
+ *                                                                                             *
+ *          expanded -- Reference to the count of sectors expanded, which is added to.         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the cell the cell path finder should search a path to. This is the    *
+ *          destination itself when the trip is short or no route could be planned.            *
+ *                                                                                             *
+ * WARNINGS:   Only the static terrain is planned around. Objects are left to the cell path    *
+ *             finder.                                                                         *
+ *=============================================================================================*/
+CELL MapClass::Zone_Waypoint(CELL source, CELL dest, MZoneType check, int& expanded)
+{
+    int zone = Array[source].Zones[check];
+    int from = Sector_Of(source);
+    int to = Sector_Of(dest);
+
+    /*
+    **	Short trips are left entirely to the cell path finder.
+    */
+    int xdiff = abs((from % MAP_SECTOR_WIDTH) - (to % MAP_SECTOR_WIDTH));
+    int ydiff = abs((from / MAP_SECTOR_WIDTH) - (to / MAP_SECTOR_WIDTH));
+    if (zone == 0 || max(xdiff, ydiff) <= SECTOR_LOOKAHEAD) {
+        return (dest);
+    }
+
+    if (!SectorValid[check]) {
+        Sector_Build(check);
+    }
+
+    /*
+    **	Start a new search. When the search counter wraps, the stale stamps must go.
+    */
+    if (++SectorSearch == 0) {
+        memset(SectorNodes, 0, sizeof(SectorNodes));
+        SectorSearch = 1;
+    }
+
+    SectorNodeType* node = &SectorNodes[from];
+    node->Search = SectorSearch;
+    node->From = -1;
+    node->Entry = source;
+    node->Cost = 0;
+    SectorOpen[0] = from;
+    int open = 1;
+    bool found = false;
+
+    while (open > 0) {
+
+        /*
+        **	Take the open sector with the lowest cost plus estimate. Ties go to the lowest
+        **	sector number so that every machine plans the same route.
+        */
+        int pick = 0;
+        int best = 0;
+        for (int index = 0; index < open; index++) {
+            SectorNodeType const& other = SectorNodes[SectorOpen[index]];
+            int score = other.Cost + Sector_Distance(other.Entry, dest);
+            if (index == 0 || score < best || (score == best && SectorOpen[index] < SectorOpen[pick])) {
+                pick = index;
+                best = score;
+            }
+        }
+        int sector = SectorOpen[pick];
+        SectorOpen[pick] = SectorOpen[--open];
+
+        node = &SectorNodes[sector];
+        node->Closed = SectorSearch;
+        expanded++;
+
+        if (sector == to) {
+            found = true;
+            break;
+        }
+
+        /*
+        **	Try every crossing of this zone out of the sector.
+        */
+        for (int index = 0; index < SectorPortalCount[check][sector]; index++) {
+            SectorPortalType const& portal = SectorPortals[check][sector][index];
+            if (portal.Zone != zone)
+                continue;
+
+            int next = Sector_Of(portal.Next);
+            SectorNodeType* other = &SectorNodes[next];
+            if (other->Closed == SectorSearch)
+                continue;
+
+            int cost =
+                node->Cost + Sector_Distance(node->Entry, portal.Cell) + Sector_Distance(portal.Cell, portal.Next);
+            if (other->Search != SectorSearch) {
+                other->Search = SectorSearch;
+                SectorOpen[open++] = next;
+            } else if (cost >= other->Cost) {
+                continue;
+            }
+            other->Cost = cost;
+            other->From = sector;
+            other->Entry = portal.Next;
+        }
+    }
+
+    if (!found) {
+        return (dest);
+    }
+
+    /*
+    **	Walk back from the destination sector to the one that is SECTOR_LOOKAHEAD sectors
+    **	along the route, and head for where the route enters it.
+    */
+    int steps = 0;
+    for (int sector = to; sector != from; sector = SectorNodes[sector].From) {
+        steps++;
+    }
+    if (steps <= SECTOR_LOOKAHEAD) {
+        return (dest);
+    }
+
+    int sector = to;
+    for (int index = steps; index > SECTOR_LOOKAHEAD; index--) {
+        sector = SectorNodes[sector].From;
+    }
+    return (SectorNodes[sector].Entry);
+}
+
+/***********************************************************************************************
+ * MapClass::Threat_Down -- Counts an object that has been placed into a cell.                 *
+ *                                                                                             *
+ *    This keeps the bucket counts used by the target scan up to date. It is called whenever   *
+ *    an object is added to the occupier list of a cell.                                       *
+ *                                                                                             *
+ * INPUT:   cell     -- The cell the object now occupies.                                      *
+ *                                                                                             *
+ *          object   -- The object that was placed.                                            *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Only techno objects are counted. Call Threat_Up() when it is removed again.     *
+ *=============================================================================================*/
+void MapClass::Threat_Down(CELL cell, ObjectClass const* object)
+{
+    if (object->Is_Techno()) {
+        Bucket_Add(Bucket_Of(cell), object->Owner());
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Threat_Up -- Stops counting an object that has been removed from a cell.          *
+ *                                                                                             *
+ * INPUT:   cell     -- The cell the object no longer occupies.                                *
+ *                                                                                             *
+ *          object   -- The object that was removed.                                           *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void MapClass::Threat_Up(CELL cell, ObjectClass const* object)
+{
+    if (object->Is_Techno()) {
+        Bucket_Remove(Bucket_Of(cell), object->Owner());
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Threat_Owner -- Moves the counts of an object over to its new owner.              *
+ *                                                                                             *
+ *    When an object changes owner while it is on the map, every cell that lists it must have  *
+ *    its count moved over to the new owner. This scans the whole map, but ownership changes   *
+ *    are rare.                                                                                *
+ *                                                                                             *
+ * INPUT:   object   -- The object that is about to change owner.                              *
+ *                                                                                             *
+ *          newowner -- The house that will own the object.                                    *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Call this before the owner of the object is changed.                            *
+ *=============================================================================================*/
+void MapClass::Threat_Owner(TechnoClass const* object, HousesType newowner)
+{
+    HousesType owner = object->Owner();
+    if (owner == newowner || object->IsInLimbo) {
+        return;
+    }
+
+    for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+        for (ObjectClass const* optr = Array[cell].Cell_Occupier(); optr != NULL; optr = optr->Next) {
+            if (optr == object) {
+                Bucket_Remove(Bucket_Of(cell), owner);
+                Bucket_Add(Bucket_Of(cell), newowner);
+            }
+        }
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Threat_Recount -- Rebuilds the bucket counts from the occupiers of every cell.    *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The bucket counts are not saved with the game. Call this once a saved game has  *
+ *             been loaded and its pointers decoded.                                           *
+ *=============================================================================================*/
+void MapClass::Threat_Recount(void)
+{
+    memset(BucketCount, 0, sizeof(BucketCount));
+    memset(BucketHouses, 0, sizeof(BucketHouses));
+
+    for (CELL cell = 0; cell < MAP_CELL_TOTAL; cell++) {
+        for (ObjectClass const* optr = Array[cell].Cell_Occupier(); optr != NULL; optr = optr->Next) {
+            Threat_Down(cell, optr);
+        }
+    }
+}
+
+/***********************************************************************************************
+ * MapClass::Threat_Houses -- Fetches the owners that have objects in the bucket of a cell.    *
+ *                                                                                             *
+ * INPUT:   cell  -- Any cell in the bucket to examine.                                        *
+ *                                                                                             *
+ * OUTPUT:  Returns with a mask holding a bit (1 << HousesType) for every owner of a techno    *
+ *          object in any cell of the bucket.                                                  *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+unsigned MapClass::Threat_Houses(CELL cell) const
+{
+    return (BucketHouses[Bucket_Of(cell)]);
+}
+
 /***********************************************************************************************
  * MapClass::Nearby_Location -- Finds a generally clear location near a specified cell.        *
  *                                                                                             *
@@ -2168,6 +2821,17 @@ struct CellUpdateStruct
 
 static const int MAX_UPDATES = 8;
 
+/*
+**	Brings the zones up to date for the templates that have been changed so far. Templates
+**	already accounted for are skipped over quickly since their cells match their zones.
+*/
+static void Zone_Cell_Updates(CellUpdateStruct const* updates, int count)
+{
+    for (int index = 0; index < count; index++) {
+        Map.Zone_Change(updates[index].Cell, MZONEF_ALL, updates[index].Type->Width, updates[index].Type->Height);
+    }
+}
+
 static void Add_Cell_Update(CellUpdateStruct* updates, int& count, TemplateType type, CELL cell)
 {
     new TemplateClass(type, cell);
@@ -2223,8 +2887,9 @@ bool MapClass::Destroy_Bridge_At(CELL cell)
 
             Scen.BridgeCount--;
             Scen.IsBridgeChanged = true;
+            ::Logic.Wake_Triggers(TEVENT_ALL_BRIDGES_DESTROYED);
             new AnimClass(ANIM_NAPALM3, Cell_Coord(cell + bridge_w / 2 + (bridge_h / 2) * MAP_CELL_W));
-            Map.Zone_Reset(MZONEF_ALL);
+            Zone_Cell_Updates(cell_updates, update_count);
 
             /*
             ** Now, loop through all the bridge cells and find anyone standing
@@ -2308,7 +2973,7 @@ bool MapClass::Destroy_Bridge_At(CELL cell)
                         }
                         Add_Cell_Update(cell_updates, update_count, TEMPLATE_BRIDGE_3D, cell2);
                     }
-                    Map.Zone_Reset(MZONEF_ALL);
+                    Zone_Cell_Updates(cell_updates, update_count);
                 }
 
                 /*
@@ -2318,6 +2983,7 @@ bool MapClass::Destroy_Bridge_At(CELL cell)
                 if (cellptr->TType == TEMPLATE_BRIDGE_1C) {
                     Scen.BridgeCount--;
                     Scen.IsBridgeChanged = true;
+                    ::Logic.Wake_Triggers(TEVENT_ALL_BRIDGES_DESTROYED);
 
                     // Point to the template below us, x-1, y+2
                     CELL cell2 = cell + (MAP_CELL_W * 2) - 1;
@@ -2371,7 +3037,7 @@ bool MapClass::Destroy_Bridge_At(CELL cell)
                         }
                         cell += MAP_CELL_W;
                     }
-                    Map.Zone_Reset(MZONEF_ALL);
+                    Zone_Cell_Updates(cell_updates, update_count);
                     destroyed = true;
                 }
                 Shake_The_Screen(3);
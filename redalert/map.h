@@ -91,6 +91,16 @@ public:
     bool Zone_Reset(int method);
     bool Zone_Cell(CELL cell, int zone);
     int Zone_Span(CELL cell, int zone, MZoneType check);
+    void Zone_Change(CELL cell, int method, int width = 1, int height = 1);
+    void Zone_Mark(CELL cell);
+    bool Zone_Verify(int method);
+    CELL Zone_Waypoint(CELL source, CELL dest, MZoneType check, int& expanded);
+    void Sector_Build(MZoneType check);
+    void Threat_Down(CELL cell, ObjectClass const* object);
+    void Threat_Up(CELL cell, ObjectClass const* object);
+    void Threat_Owner(TechnoClass const* object, HousesType newowner);
+    void Threat_Recount(void);
+    unsigned Threat_Houses(CELL cell) const;
     bool Destroy_Bridge_At(CELL cell);
     void Detach(TARGET target, bool all = true);
     void Shroud_The_Map(HouseClass* house);
@@ -576,6 +576,7 @@ bool MapEditClass::Change_House(HousesType newhouse)
     **	Change the house
     */
     tp = (TechnoClass*)CurrentObject[0];
+    Map.Threat_Owner(tp, newhouse);
     tp->House = HouseClass::As_Pointer(newhouse);
 
     tp->IsOwnedByPlayer = false;
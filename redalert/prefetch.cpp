@@ -0,0 +1,195 @@
+//
+// Copyright 2020 Electronic Arts Inc.
+//
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is free
+// software: you can redistribute it and/or modify it under the terms of
+// the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is distributed
+// in the hope that it will be useful, but with permitted additional restrictions
+// under Section 7 of the GPL. See the GNU General Public License in LICENSE.TXT
+// distributed with this program. You should have received a copy of the
+// GNU General Public License along with permitted additional restrictions
+// with this program. If not, see https://github.com/electronicarts/CnC_Remastered_Collection
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : PREFETCH.CPP                                                 *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   Finish_Prefetch -- Waits for the scenario prefetch to finish.                             *
+ *   Prefetch_File -- Reads a file through to warm the file cache.                             *
+ *   Prefetch_Scenario -- Starts reading the data of the next scenario in the background.      *
+ *   Read_Prefetch -- Reads the files a scenario needs.                                        *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include "function.h"
+#include "worker.h"
+#include <chrono>
+
+/*
+**	The scenario being prefetched. Only one prefetch is ever in flight; a new one waits for
+**	the last. Everything the worker needs is copied in here, since the game keeps running
+**	(playing movies and the map selection) while it reads.
+*/
+struct PrefetchJobType
+{
+    char Name[_MAX_FNAME + _MAX_EXT];
+    TheaterType Theater; // The theater that is already loaded.
+    int Bytes;           // Bytes read by the job.
+    char Buffer[0x10000];
+};
+
+static PrefetchJobType PrefetchJob;
+static WorkerClass PrefetchWorker;
+
+/*
+**	The worker reads through this rather than CCFileClass, whose errors ask for the CD and
+**	may end the program. Neither may happen off the game thread, so an error here is only
+**	logged; the prefetch is just a hint, and the real load reports the error.
+*/
+class PrefetchFileClass : public CCFileClass
+{
+public:
+    PrefetchFileClass(char const* filename)
+        : CCFileClass(filename)
+    {
+    }
+
+    virtual void Error(int error, int canretry = false, char const* filename = NULL)
+    {
+        RawFileClass::Error(error, canretry, filename);
+    }
+};
+
+/***********************************************************************************************
+ * Prefetch_File -- Reads a file through to warm the file cache.                               *
+ *                                                                                             *
+ *    The data is thrown away; the point is to have the operating system hold it, so that      *
+ *    the real load later comes from memory instead of the disc.                               *
+ *                                                                                             *
+ * INPUT:   job   -- The prefetch job, which supplies the scratch buffer.                      *
+ *                                                                                             *
+ *          name  -- The name of the file to read.                                             *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Runs on the prefetch worker.                                                    *
+ *=============================================================================================*/
+static void Prefetch_File(PrefetchJobType& job, char const* name)
+{
+    PrefetchFileClass file(name);
+
+    if (!file.Is_Available() || !file.Open(READ)) {
+        return;
+    }
+
+    int length;
+    while ((length = file.Read(job.Buffer, sizeof(job.Buffer))) > 0) {
+        job.Bytes += length;
+    }
+    file.Close();
+}
+
+/***********************************************************************************************
+ * Read_Prefetch -- Reads the files a scenario needs.                                          *
+ *                                                                                             *
+ *    This reads the scenario INI, finds its theater from it and reads the theater mixfile     *
+ *    if it isn't the one already loaded. The theater mixfile holds the templates and the      *
+ *    theater specific shapes; the rest of the shapes are in mixfiles that stay cached.        *
+ *                                                                                             *
+ * INPUT:   data  -- Pointer to the PrefetchJobType.                                           *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Runs on the prefetch worker.                                                    *
+ *=============================================================================================*/
+static void Read_Prefetch(void* data)
+{
+    PrefetchJobType& job = *(PrefetchJobType*)data;
+
+    Prefetch_File(job, job.Name);
+
+    INIClass ini;
+    PrefetchFileClass file(job.Name);
+    if (!file.Is_Available() || !ini.Load(file)) {
+        return;
+    }
+
+    char buffer[16];
+    ini.Get_String("Map", "Theater", "", buffer, sizeof(buffer));
+    TheaterType theater = Theater_From_Name(buffer);
+    if (theater != THEATER_NONE && theater != job.Theater) {
+        char fullname[_MAX_FNAME + _MAX_EXT];
+        sprintf(fullname, "%s.MIX", Theaters[theater].Root);
+        Prefetch_File(job, fullname);
+    }
+}
+
+/***********************************************************************************************
+ * Prefetch_Scenario -- Starts reading the data of the next scenario in the background.        *
+ *                                                                                             *
+ *    Call this as soon as the next scenario is known (or can be guessed), so that its data    *
+ *    is read while the player watches movies or the map selection. Start_Scenario then        *
+ *    finds it in memory.                                                                      *
+ *                                                                                             *
+ * INPUT:   name  -- The file name of the scenario INI.                                        *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Nothing may cache or free a mixfile, or change the search paths or CD, until    *
+ *             Finish_Prefetch is called.                                                      *
+ *=============================================================================================*/
+void Prefetch_Scenario(char const* name)
+{
+    if (name == NULL || !CCFileClass(name).Is_Available()) {
+        return;
+    }
+
+    /*
+    **	The guess was right; it is already being read.
+    */
+    if (stricmp(PrefetchJob.Name, name) == 0) {
+        return;
+    }
+
+    PrefetchWorker.Wait();
+    strncpy(PrefetchJob.Name, name, sizeof(PrefetchJob.Name));
+    PrefetchJob.Name[sizeof(PrefetchJob.Name) - 1] = '\0';
+    PrefetchJob.Theater = (TheaterData != NULL) ? Scen.Theater : THEATER_NONE;
+    PrefetchJob.Bytes = 0;
+    PrefetchWorker.Submit(Read_Prefetch, &PrefetchJob);
+}
+
+/***********************************************************************************************
+ * Finish_Prefetch -- Waits for the scenario prefetch to finish.                               *
+ *                                                                                             *
+ *    The prefetch reads through the mixfile system, so this must be called before a mixfile   *
+ *    is cached or freed, or the search paths or CD are changed. Start_Scenario,               *
+ *    Read_Scenario_INI, Init_Theater and Change_Local_Dir all call it first.                  *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void Finish_Prefetch(void)
+{
+    bool busy = PrefetchWorker.Is_Busy();
+
+    auto start = std::chrono::steady_clock::now();
+    PrefetchWorker.Wait();
+    auto wait = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    if (busy) {
+        DBG_INFO("Finish_Prefetch: waited %d ms for %s (%d bytes read).",
+                 (int)wait.count(),
+                 PrefetchJob.Name,
+                 PrefetchJob.Bytes);
+    }
+}
@@ -61,13 +61,24 @@
  *                                                                         *
  * DoList Management:																		*
  *   Execute_DoList -- Executes commands from the DoList                   *
+ *   Can_Delay_Event -- Tells if TIMING_FIX may move an event              *
  *   Clean_DoList -- Cleans out old events from the DoList                 *
  *   Queue_Record -- Records the DoList to disk                            *
  *   Queue_Playback -- plays back queue entries from a record file         *
+ *   Save_Queue_State -- Stores the event queue for a game snapshot        *
+ *   Load_Queue_State -- Restores the event queue from a game snapshot     *
  *                                                                         *
  * Debugging:																					*
  *   Compute_Game_CRC -- Computes a CRC value of the entire game.				*
+ *   Compute_Full_CRC -- Walks the whole game for the CRC                  *
+ *   Get_Game_CRC -- Returns the CRC of the current game state             *
  *   Add_CRC -- Adds a value to a CRC                                      *
+ *   Sync_CRC_Reset -- Rebuilds the incremental sync CRC                   *
+ *   Sync_CRC_Remove -- Takes a deleted object out of the sync CRC         *
+ *   Sync_Count -- Counts the objects of a sync heap                       *
+ *   Sync_Ptr -- Fetches an object of a sync heap                          *
+ *   Sync_Raw_Ptr -- Fetches the object at a heap ID of a sync heap        *
+ *   Sync_Terms -- Fetches the values an object adds to the full CRC       *
  *   Print_CRCs -- Prints a data file for finding Sync Bugs						*
  *   Init_Queue_Mono -- inits mono display                                 *
  *   Update_Queue_Mono -- updates mono display                             *
@@ -101,6 +112,36 @@ static unsigned int CRC[32] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
                                0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
 static const char* ColorNames[8] = {"Yellow", "LtBlue", "Red", "Green", "Orange", "Grey", "Blue", "Brown"};
 
+//---------------------------------------------------------------------------
+//	When Rule.IsIncrementalCRC is set, every infantry, unit, vessel, building
+// and aircraft keeps a hash of its sync fields in these tables (indexed by
+// heap ID). SyncTotal is the sum of all of them. Every live object is
+// rehashed when the CRC is computed, and only the hashes that changed
+// alter the total. -CHECKCRC rebuilds the total from scratch to compare.
+//---------------------------------------------------------------------------
+typedef enum SyncHeapType
+{
+    SYNC_INFANTRY,
+    SYNC_UNIT,
+    SYNC_VESSEL,
+    SYNC_BUILDING,
+    SYNC_AIRCRAFT,
+
+    SYNC_COUNT,
+    SYNC_FIRST = 0
+} SyncHeapType;
+
+#define SYNC_TERMS 4 // Most values one object adds to the full CRC.
+
+typedef struct
+{
+    unsigned* Hash; // Sync hash of each object by heap ID (0 if none).
+    int Length;     // Number of heap IDs the table covers.
+} SyncTableType;
+
+static SyncTableType SyncTables[SYNC_COUNT];
+static unsigned SyncTotal = 0;
+
 //...........................................................................
 // Mono debugging variables:
 // NetMonoMode: 0 = show connection output, 1 = flowcount output
@@ -192,6 +233,7 @@ static int Execute_DoList(int max_houses,
                           int* their_frame,
                           unsigned short* their_sent,
                           unsigned short* their_recv);
+static int Can_Delay_Event(EventClass const& event);
 static void Clean_DoList(ConnManClass* net);
 static void Queue_Record(void);
 static void Queue_Playback(void);
@@ -200,6 +242,12 @@ static void Queue_Playback(void);
 // Debugging:
 //...........................................................................
 static void Compute_Game_CRC(void);
+static unsigned Compute_Full_CRC(void);
+static int Sync_Count(int type);
+static ObjectClass* Sync_Ptr(int type, int index);
+static ObjectClass* Sync_Raw_Ptr(int type, int id);
+static int Sync_Terms(ObjectClass const* object, unsigned* terms);
+static void Compute_Sync_CRC(void);
 void Add_CRC(unsigned int* crc, unsigned int val);
 static void Print_CRCs(EventClass* ev);
 static void Init_Queue_Mono(ConnManClass* net);
@@ -3123,6 +3171,7 @@ static int Execute_DoList(int max_houses,
     HousesType house;
     HouseClass* hptr;
     int i, j, k;
+    int slot, next;
     int index;
     int check_crc;
 
@@ -3138,24 +3187,26 @@ static int Execute_DoList(int max_houses,
     // may execute past the frame it's scheduled to execute on, creating
     // a Packet-Recieved-Too-Late error.  To prevent this, find any events
     // that are scheduled to execute during this "period of vulnerability",
-    // and re-schedule for the end of that period.
+    // and re-schedule for the end of that period.  The DoList only looks
+    // at events it hasn't checked against this period before.
     //
-    for (j = 0; j < DoList.Count; j++) {
-        if (DoList[j].Type != EventClass::FRAMEINFO && DoList[j].Frame > (unsigned)NewMaxAheadFrame1
-            && DoList[j].Frame < (unsigned)NewMaxAheadFrame2) {
-            DoList[j].Frame = (unsigned)NewMaxAheadFrame2;
+    DoList.Delay((unsigned)NewMaxAheadFrame1, (unsigned)NewMaxAheadFrame2, Can_Delay_Event);
 #ifdef MIRROR_QUEUE
-            MirrorList[j].Frame = NewMaxAheadFrame2;
-#endif
-        }
+    for (j = 0; j < DoList.Count; j++) {
+        MirrorList[j].Frame = DoList[j].Frame;
     }
+#endif
 #endif
 
     //------------------------------------------------------------------------
     //	Execute the DoList.  Events must be executed in the same order on all
     //	systems; so, execute them in the order of the HouseClass array.  This
-    //	array is stored in the same order on all systems.
+    //	array is stored in the same order on all systems.  The DoList keeps a
+    //	list of the events due for each house, in DoList order, so only those
+    //	need to be visited.
     //------------------------------------------------------------------------
+    DoList.Advance((unsigned)Frame);
+
     for (i = 0; i < max_houses; i++) {
         //.....................................................................
         //	Convert our index into a HousesType value
@@ -3180,9 +3231,11 @@ static int Execute_DoList(int max_houses,
         }
 
         //.....................................................................
-        //	Loop through all events
+        //	Loop through all events due for this house
         //.....................................................................
-        for (j = 0; j < DoList.Count; j++) {
+        for (slot = DoList.First_Due(hptr->ID); slot != -1; slot = next) {
+            next = DoList.Next_Due(slot);
+            j = DoList.Position(slot);
 
             if (net)
                 Update_Queue_Mono(net, 6);
@@ -3326,6 +3379,7 @@ static int Execute_DoList(int max_houses,
                 //	Mark this event as executed.
                 //...............................................................
                 DoList[j].IsExecuted = 1;
+                DoList.Retire(slot);
 #ifdef MIRROR_QUEUE
                 MirrorList[j].IsExecuted = 1;
 #endif
@@ -3337,6 +3391,24 @@ static int Execute_DoList(int max_houses,
 
 } // end of Execute_DoList
 
+/***************************************************************************
+ * Can_Delay_Event -- Tells if TIMING_FIX may move an event                *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		event		event to check																*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		1 = event may be moved, 0 = it must keep its frame (FRAMEINFO)			*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *=========================================================================*/
+static int Can_Delay_Event(EventClass const& event)
+{
+    return (event.Type != EventClass::FRAMEINFO);
+
+} // end of Can_Delay_Event
+
 /***************************************************************************
  * Clean_DoList -- Cleans out old events from the DoList                   *
  *                                                                         *
@@ -3420,10 +3492,10 @@ static void Queue_Record(void)
     //------------------------------------------------------------------------
     //	Save the # of events, then all events.
     //------------------------------------------------------------------------
-    Session.RecordFile.Write(&j, sizeof(j));
+    Replay.Write(&j, sizeof(j));
     for (i = 0; i < DoList.Count; i++) {
         if (Frame == DoList[i].Frame && !DoList[i].IsExecuted) {
-            Session.RecordFile.Write(&DoList[i], sizeof(EventClass));
+            Replay.Write(&DoList[i], sizeof(EventClass));
             j--;
         }
     }
@@ -3473,6 +3545,15 @@ static void Queue_Playback(void)
             GameActive = false;
             return;
         }
+
+        //--------------------------------------------------------------------
+        //	Page Down/Up skip a minute forwards or backwards through the game
+        //--------------------------------------------------------------------
+        if (key == KN_PGDN) {
+            Replay.Seek(Frame + ReplayClass::KEYFRAME_RATE);
+        } else if (key == KN_PGUP) {
+            Replay.Seek(Frame - ReplayClass::KEYFRAME_RATE);
+        }
     }
 
     //------------------------------------------------------------------------
@@ -3525,9 +3606,9 @@ static void Queue_Playback(void)
     //	Read the DoList from disk
     //------------------------------------------------------------------------
     ok = 1;
-    if (Session.RecordFile.Read(&numevents, sizeof(numevents)) == sizeof(numevents)) {
+    if (Replay.Read(&numevents, sizeof(numevents)) == sizeof(numevents)) {
         for (i = 0; i < numevents; i++) {
-            if (Session.RecordFile.Read(&event, sizeof(EventClass)) == sizeof(EventClass)) {
+            if (Replay.Read(&event, sizeof(EventClass)) == sizeof(EventClass)) {
                 event.IsExecuted = 0;
                 DoList.Add(event);
 #ifdef MIRROR_QUEUE
@@ -3569,6 +3650,97 @@ static void Queue_Playback(void)
 
 } /* end of Queue_Playback */
 
+/***************************************************************************
+ * Save_Queue_State -- Stores the event queue for a game snapshot          *
+ *                                                                         *
+ * This stores the events in the DoList scheduled before the frame given,  *
+ * along with the CRC history and the TIMING_FIX window.  A replay         *
+ * keyframe only needs the events from before the current frame, since     *
+ * that is all playback has in its DoList; the rest are in the recorded    *
+ * frame data.                                                             *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *      pipe      pipe to store to                                         *
+ *      before    only events scheduled before this frame are stored       *
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *      true = success, false = failure                                    *
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *      none.                                                              *
+ *                                                                         *
+ *=========================================================================*/
+bool Save_Queue_State(Pipe& pipe, int before)
+{
+    int i, count;
+
+    pipe.Put(CRC, sizeof(CRC));
+#if (TIMING_FIX)
+    pipe.Put(&NewMaxAheadFrame1, sizeof(NewMaxAheadFrame1));
+    pipe.Put(&NewMaxAheadFrame2, sizeof(NewMaxAheadFrame2));
+#endif
+
+    count = 0;
+    for (i = 0; i < DoList.Count; i++) {
+        if ((int)DoList[i].Frame < before) {
+            count++;
+        }
+    }
+    pipe.Put(&count, sizeof(count));
+    for (i = 0; i < DoList.Count; i++) {
+        if ((int)DoList[i].Frame < before) {
+            pipe.Put(&DoList[i], sizeof(EventClass));
+        }
+    }
+
+    return (true);
+
+} /* end of Save_Queue_State */
+
+/***************************************************************************
+ * Load_Queue_State -- Restores the event queue from a game snapshot       *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *      straw     straw to load from                                       *
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *      true = success, false = failure                                    *
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *      none.                                                              *
+ *                                                                         *
+ *=========================================================================*/
+bool Load_Queue_State(Straw& straw)
+{
+    int i, count;
+    EventClass event;
+
+    straw.Get(CRC, sizeof(CRC));
+#if (TIMING_FIX)
+    straw.Get(&NewMaxAheadFrame1, sizeof(NewMaxAheadFrame1));
+    straw.Get(&NewMaxAheadFrame2, sizeof(NewMaxAheadFrame2));
+#endif
+
+    DoList.Init();
+#ifdef MIRROR_QUEUE
+    MirrorList.Init();
+#endif
+    count = 0;
+    straw.Get(&count, sizeof(count));
+    for (i = 0; i < count; i++) {
+        if (straw.Get(&event, sizeof(EventClass)) != sizeof(EventClass)) {
+            return (false);
+        }
+        DoList.Add(event);
+#ifdef MIRROR_QUEUE
+        MirrorList.Add(event);
+#endif
+    }
+
+    return (true);
+
+} /* end of Load_Queue_State */
+
 /***************************************************************************
  * Compute_Game_CRC -- Computes a CRC value of the entire game.				*
  *                                                                         *
@@ -3586,52 +3758,50 @@ static void Queue_Playback(void)
  *=========================================================================*/
 static void Compute_Game_CRC(void)
 {
-    int i, j;
-    VesselClass* vessp;
-    InfantryClass* infp;
-    UnitClass* unitp;
-    BuildingClass* bldgp;
-    ObjectClass* objp;
-    HouseClass* housep;
-
-    GameCRC = 0;
-
-    //------------------------------------------------------------------------
-    //	Infantry
-    //------------------------------------------------------------------------
-    for (i = 0; i < Infantry.Count(); i++) {
-        infp = (InfantryClass*)Infantry.Active_Ptr(i);
-        Add_CRC(&GameCRC, (int)infp->Coord + (int)infp->PrimaryFacing.Current());
-        Add_CRC(&GameCRC, (int)infp->Speed + (int)infp->NavCom);
-        Add_CRC(&GameCRC, (int)infp->Mission + (int)infp->TarCom);
+    if (Rule.IsIncrementalCRC) {
+        Compute_Sync_CRC();
+        return;
     }
 
-    //------------------------------------------------------------------------
-    //	Units
-    //------------------------------------------------------------------------
-    for (i = 0; i < Units.Count(); i++) {
-        unitp = (UnitClass*)Units.Active_Ptr(i);
-        Add_CRC(&GameCRC,
-                (int)unitp->Coord + (int)unitp->PrimaryFacing.Current() + (int)unitp->SecondaryFacing.Current());
-    }
+    GameCRC = Compute_Full_CRC();
 
-    //------------------------------------------------------------------------
-    //	Shippies
-    //------------------------------------------------------------------------
-    for (i = 0; i < Vessels.Count(); i++) {
-        vessp = (VesselClass*)Vessels.Active_Ptr(i);
-        Add_CRC(&GameCRC, (int)vessp->Coord + (int)vessp->PrimaryFacing.Current());
-        Add_CRC(&GameCRC, (int)vessp->Speed + (int)vessp->NavCom);
-        Add_CRC(&GameCRC, (int)vessp->Strength);
-        Add_CRC(&GameCRC, (int)vessp->Mission + (int)vessp->TarCom);
-    }
+} /* end of Compute_Game_CRC */
+
+/***************************************************************************
+ * Compute_Full_CRC -- Walks the whole game for the CRC                    *
+ *                                                                         *
+ * This is the CRC the game has always used. The values the heap objects   *
+ * add come from Sync_Terms.                                               *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		CRC value																				*
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *		none.																						*
+ *=========================================================================*/
+static unsigned Compute_Full_CRC(void)
+{
+    static SyncHeapType const order[] = {SYNC_INFANTRY, SYNC_UNIT, SYNC_VESSEL, SYNC_BUILDING};
+    unsigned crc = 0;
+    unsigned terms[SYNC_TERMS];
+    ObjectClass* objp;
+    HouseClass* housep;
+    int i, j;
 
     //------------------------------------------------------------------------
-    //	Buildings
+    //	Infantry, units, shippies and buildings
     //------------------------------------------------------------------------
-    for (i = 0; i < Buildings.Count(); i++) {
-        bldgp = (BuildingClass*)Buildings.Active_Ptr(i);
-        Add_CRC(&GameCRC, (int)bldgp->Coord + (int)bldgp->PrimaryFacing.Current());
+    for (int type = 0; type < ARRAY_SIZE(order); type++) {
+        for (i = 0; i < Sync_Count(order[type]); i++) {
+            objp = Sync_Ptr(order[type], i);
+            int count = Sync_Terms(objp, terms);
+            for (j = 0; j < count; j++) {
+                Add_CRC(&crc, terms[j]);
+            }
+        }
     }
 
     //------------------------------------------------------------------------
@@ -3639,7 +3809,7 @@ static void Compute_Game_CRC(void)
     //------------------------------------------------------------------------
     for (i = 0; i < Houses.Count(); i++) {
         housep = (HouseClass*)Houses.Active_Ptr(i);
-        Add_CRC(&GameCRC, (int)housep->Credits + (int)housep->Power + (int)housep->Drain);
+        Add_CRC(&crc, (int)housep->Credits + (int)housep->Power + (int)housep->Drain);
     }
 
     //------------------------------------------------------------------------
@@ -3648,7 +3818,7 @@ static void Compute_Game_CRC(void)
     for (i = 0; i < LAYER_COUNT; i++) {
         for (j = 0; j < Map.Layer[i].Count(); j++) {
             objp = Map.Layer[i][j];
-            Add_CRC(&GameCRC, (int)objp->Coord + (int)objp->What_Am_I());
+            Add_CRC(&crc, (int)objp->Coord + (int)objp->What_Am_I());
         }
     }
 
@@ -3657,16 +3827,37 @@ static void Compute_Game_CRC(void)
     //------------------------------------------------------------------------
     for (i = 0; i < Logic.Count(); i++) {
         objp = Logic[i];
-        Add_CRC(&GameCRC, (int)objp->Coord + (int)objp->What_Am_I());
+        Add_CRC(&crc, (int)objp->Coord + (int)objp->What_Am_I());
     }
 
     //------------------------------------------------------------------------
     //	A random #
     //------------------------------------------------------------------------
     // Capture the current internal value, don't roll the random, otherwise playbacks desync.
-    Add_CRC(&GameCRC, Scen.RandomNumber.Seed);
+    Add_CRC(&crc, Scen.RandomNumber.Seed);
 
-} /* end of Compute_Game_CRC */
+    return (crc);
+
+} /* end of Compute_Full_CRC */
+
+/***************************************************************************
+ * Get_Game_CRC -- Returns the CRC of the current game state               *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *      none.                                                              *
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *      the same CRC that is compared between the players each frame       *
+ *                                                                         *
+ * WARNINGS:                                                               *
+ *      none.                                                              *
+ *=========================================================================*/
+unsigned int Get_Game_CRC(void)
+{
+    Compute_Game_CRC();
+    return (GameCRC);
+
+} /* end of Get_Game_CRC */
 
 /***************************************************************************
  * Add_CRC -- Adds a value to a CRC                                        *
@@ -3701,6 +3892,443 @@ void Add_CRC(unsigned int* crc, unsigned int val)
 
 } /* end of Add_CRC */
 
+/***************************************************************************
+ * Sync_Table -- Fetches the sync hash table for an object type            *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		rtti		type of object																*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		ptr to table, NULL if this type isn't hashed, or if the incremental	*
+ *		CRC isn't in use.																		*
+ *=========================================================================*/
+static SyncTableType* Sync_Table(RTTIType rtti)
+{
+    SyncTableType* table;
+
+    switch (rtti) {
+    case RTTI_INFANTRY:
+        table = &SyncTables[SYNC_INFANTRY];
+        break;
+
+    case RTTI_UNIT:
+        table = &SyncTables[SYNC_UNIT];
+        break;
+
+    case RTTI_VESSEL:
+        table = &SyncTables[SYNC_VESSEL];
+        break;
+
+    case RTTI_BUILDING:
+        table = &SyncTables[SYNC_BUILDING];
+        break;
+
+    case RTTI_AIRCRAFT:
+        table = &SyncTables[SYNC_AIRCRAFT];
+        break;
+
+    default:
+        return (NULL);
+    }
+
+    return (table->Length != 0 ? table : NULL);
+}
+
+/***************************************************************************
+ * Sync_Count -- Counts the objects of a sync heap                         *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		type		SyncHeapType of the heap												*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		number of objects in the heap														*
+ *=========================================================================*/
+static int Sync_Count(int type)
+{
+    switch (type) {
+    case SYNC_INFANTRY:
+        return (Infantry.Count());
+    case SYNC_UNIT:
+        return (Units.Count());
+    case SYNC_VESSEL:
+        return (Vessels.Count());
+    case SYNC_BUILDING:
+        return (Buildings.Count());
+    case SYNC_AIRCRAFT:
+        return (Aircraft.Count());
+    }
+    return (0);
+}
+
+/***************************************************************************
+ * Sync_Ptr -- Fetches an object of a sync heap                            *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		type		SyncHeapType of the heap												*
+ *		index		index into the heap's list of objects, as for Ptr()			*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		ptr to the object																		*
+ *=========================================================================*/
+static ObjectClass* Sync_Ptr(int type, int index)
+{
+    switch (type) {
+    case SYNC_INFANTRY:
+        return (Infantry.Ptr(index));
+    case SYNC_UNIT:
+        return (Units.Ptr(index));
+    case SYNC_VESSEL:
+        return (Vessels.Ptr(index));
+    case SYNC_BUILDING:
+        return (Buildings.Ptr(index));
+    default:
+        return (Aircraft.Ptr(index));
+    }
+}
+
+/***************************************************************************
+ * Sync_Raw_Ptr -- Fetches the object at a heap ID of a sync heap          *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		type		SyncHeapType of the heap												*
+ *		id			heap ID of the object														*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		ptr to the object, which may not be active										*
+ *=========================================================================*/
+static ObjectClass* Sync_Raw_Ptr(int type, int id)
+{
+    switch (type) {
+    case SYNC_INFANTRY:
+        return (Infantry.Raw_Ptr(id));
+    case SYNC_UNIT:
+        return (Units.Raw_Ptr(id));
+    case SYNC_VESSEL:
+        return (Vessels.Raw_Ptr(id));
+    case SYNC_BUILDING:
+        return (Buildings.Raw_Ptr(id));
+    default:
+        return (Aircraft.Raw_Ptr(id));
+    }
+}
+
+/***************************************************************************
+ * Sync_Terms -- Fetches the values an object adds to the full CRC         *
+ *                                                                         *
+ * Compute_Full_CRC adds these for each object in its heap walk. They are  *
+ * the sums the original Compute_Game_CRC made, so the full CRC is still   *
+ * the same value it always was.                                           *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		object	object to fetch the values of											*
+ *		terms		filled in with up to SYNC_TERMS values								*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		number of values; aircraft only count in the layer walks, so 0			*
+ *=========================================================================*/
+static int Sync_Terms(ObjectClass const* object, unsigned* terms)
+{
+    switch (object->RTTI) {
+    case RTTI_INFANTRY: {
+        InfantryClass const* infp = (InfantryClass const*)object;
+        terms[0] = (int)infp->Coord + (int)infp->PrimaryFacing.Current();
+        terms[1] = (int)infp->Speed + (int)infp->NavCom;
+        terms[2] = (int)infp->Mission + (int)infp->TarCom;
+        return (3);
+    }
+
+    case RTTI_UNIT: {
+        UnitClass const* unitp = (UnitClass const*)object;
+        terms[0] = (int)unitp->Coord + (int)unitp->PrimaryFacing.Current() + (int)unitp->SecondaryFacing.Current();
+        return (1);
+    }
+
+    case RTTI_VESSEL: {
+        VesselClass const* vessp = (VesselClass const*)object;
+        terms[0] = (int)vessp->Coord + (int)vessp->PrimaryFacing.Current();
+        terms[1] = (int)vessp->Speed + (int)vessp->NavCom;
+        terms[2] = (int)vessp->Strength;
+        terms[3] = (int)vessp->Mission + (int)vessp->TarCom;
+        return (4);
+    }
+
+    case RTTI_BUILDING: {
+        BuildingClass const* bldgp = (BuildingClass const*)object;
+        terms[0] = (int)bldgp->Coord + (int)bldgp->PrimaryFacing.Current();
+        return (1);
+    }
+
+    default:
+        return (0);
+    }
+}
+
+/***************************************************************************
+ * Sync_Mix -- Mixes a value into a sync hash                              *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		hash		hash so far																	*
+ *		val		value to add																*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		new hash value																			*
+ *=========================================================================*/
+static inline unsigned Sync_Mix(unsigned hash, unsigned val)
+{
+    return ((hash ^ val) * 0x01000193U);
+}
+
+/***************************************************************************
+ * Sync_Hash -- Computes the sync hash for an object                       *
+ *                                                                         *
+ * The fields hashed for each type are the ones Compute_Game_CRC adds for  *
+ * that type. Aircraft only contribute their position, as they do through  *
+ * the layers in the full walk.                                            *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		object	object to hash																*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		hash value (never 0)																	*
+ *=========================================================================*/
+static unsigned Sync_Hash(ObjectClass const* object)
+{
+    unsigned hash = 0x811C9DC5U;
+
+    hash = Sync_Mix(hash, ((unsigned)object->RTTI << 16) | (unsigned)object->ID);
+    hash = Sync_Mix(hash, (unsigned)object->Coord);
+
+    switch (object->RTTI) {
+    case RTTI_INFANTRY: {
+        InfantryClass const* infp = (InfantryClass const*)object;
+        hash = Sync_Mix(hash, (unsigned)infp->PrimaryFacing.Current());
+        hash = Sync_Mix(hash, (unsigned)infp->Speed);
+        hash = Sync_Mix(hash, (unsigned)infp->NavCom);
+        hash = Sync_Mix(hash, (unsigned)infp->Mission);
+        hash = Sync_Mix(hash, (unsigned)infp->TarCom);
+        break;
+    }
+
+    case RTTI_UNIT: {
+        UnitClass const* unitp = (UnitClass const*)object;
+        hash = Sync_Mix(hash, (unsigned)unitp->PrimaryFacing.Current());
+        hash = Sync_Mix(hash, (unsigned)unitp->SecondaryFacing.Current());
+        break;
+    }
+
+    case RTTI_VESSEL: {
+        VesselClass const* vessp = (VesselClass const*)object;
+        hash = Sync_Mix(hash, (unsigned)vessp->PrimaryFacing.Current());
+        hash = Sync_Mix(hash, (unsigned)vessp->Speed);
+        hash = Sync_Mix(hash, (unsigned)vessp->NavCom);
+        hash = Sync_Mix(hash, (unsigned)vessp->Strength);
+        hash = Sync_Mix(hash, (unsigned)vessp->Mission);
+        hash = Sync_Mix(hash, (unsigned)vessp->TarCom);
+        break;
+    }
+
+    case RTTI_BUILDING:
+        hash = Sync_Mix(hash, (unsigned)((BuildingClass const*)object)->PrimaryFacing.Current());
+        break;
+
+    default:
+        break;
+    }
+
+    return (hash != 0 ? hash : 1);
+}
+
+/***************************************************************************
+ * Sync_Update -- Rehashes an object and adjusts the running total         *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		table		table the object belongs to											*
+ *		object	object to rehash															*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		none.																						*
+ *=========================================================================*/
+static void Sync_Update(SyncTableType* table, ObjectClass const* object)
+{
+    int id = object->ID;
+    unsigned hash = Sync_Hash(object);
+
+    SyncTotal += hash - table->Hash[id];
+    table->Hash[id] = hash;
+}
+
+/***************************************************************************
+ * Sync_CRC_Reset -- Rebuilds the incremental sync CRC                     *
+ *                                                                         *
+ * This must be called once all the objects of a scenario or saved game    *
+ * exist. It sizes the tables to the heaps and hashes every object. When   *
+ * the incremental CRC isn't in use, the tables are released instead.      *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		none.																						*
+ *=========================================================================*/
+void Sync_CRC_Reset(void)
+{
+    int lengths[SYNC_COUNT];
+    int i;
+
+    lengths[SYNC_INFANTRY] = Infantry.Length();
+    lengths[SYNC_UNIT] = Units.Length();
+    lengths[SYNC_VESSEL] = Vessels.Length();
+    lengths[SYNC_BUILDING] = Buildings.Length();
+    lengths[SYNC_AIRCRAFT] = Aircraft.Length();
+
+    SyncTotal = 0;
+    for (int type = SYNC_FIRST; type < SYNC_COUNT; type++) {
+        SyncTableType& table = SyncTables[type];
+        int length = Rule.IsIncrementalCRC ? lengths[type] : 0;
+
+        if (table.Length != length) {
+            delete[] table.Hash;
+            table.Hash = NULL;
+            table.Length = length;
+            if (length != 0) {
+                table.Hash = new unsigned[length];
+            }
+        }
+        if (length != 0) {
+            memset(table.Hash, 0, length * sizeof(unsigned));
+        }
+    }
+
+    if (!Rule.IsIncrementalCRC) {
+        return;
+    }
+
+    for (int type = SYNC_FIRST; type < SYNC_COUNT; type++) {
+        for (i = 0; i < Sync_Count(type); i++) {
+            Sync_Update(&SyncTables[type], Sync_Ptr(type, i));
+        }
+    }
+
+} /* end of Sync_CRC_Reset */
+
+/***************************************************************************
+ * Sync_CRC_Remove -- Takes a deleted object out of the sync CRC           *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		object	object being deleted														*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		none.																						*
+ *=========================================================================*/
+void Sync_CRC_Remove(ObjectClass const* object)
+{
+    SyncTableType* table = Sync_Table(object->RTTI);
+
+    if (table != NULL && (unsigned)object->ID < (unsigned)table->Length) {
+        int id = object->ID;
+        SyncTotal -= table->Hash[id];
+        table->Hash[id] = 0;
+    }
+
+} /* end of Sync_CRC_Remove */
+
+/***************************************************************************
+ * Check_Sync_CRC -- Checks the sync total against a full recompute        *
+ *                                                                         *
+ * The hash of every live object is summed from scratch and compared with  *
+ * the running total. A difference means a hash was left behind when its   *
+ * object went away without Sync_CRC_Remove, and each such heap ID is      *
+ * reported. The total is left alone so that the CRC still matches the     *
+ * other players.                                                          *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		true = the running total is right													*
+ *=========================================================================*/
+static bool Check_Sync_CRC(void)
+{
+    unsigned total = 0;
+    bool ok = true;
+
+    for (int type = SYNC_FIRST; type < SYNC_COUNT; type++) {
+        SyncTableType& table = SyncTables[type];
+        for (int i = 0; i < Sync_Count(type); i++) {
+            total += Sync_Hash(Sync_Ptr(type, i));
+        }
+        for (int id = 0; id < table.Length; id++) {
+            ObjectClass* objp = Sync_Raw_Ptr(type, id);
+            if (table.Hash[id] != 0 && (objp == NULL || !objp->IsActive)) {
+                DBG_ERROR("Check_Sync_CRC: frame %d, heap %d ID %d is gone but still hashed.", Frame, type, id);
+                ok = false;
+            }
+        }
+    }
+
+    if (total != SyncTotal) {
+        DBG_ERROR(
+            "Check_Sync_CRC: frame %d, sync total %08x differs from a full recompute %08x.", Frame, SyncTotal, total);
+        ok = false;
+    }
+    return (ok);
+
+} /* end of Check_Sync_CRC */
+
+/***************************************************************************
+ * Compute_Sync_CRC -- Computes the game CRC from the kept sync hashes     *
+ *                                                                         *
+ * Every live object of each sync heap is rehashed here, so nothing that   *
+ * changes a sync field has to report it. The hashes are combined by       *
+ * adjusting the running total by the ones that changed. The houses, map   *
+ * layers and logic list are still added in full every time, as the full   *
+ * CRC adds them.                                                          *
+ *                                                                         *
+ * INPUT:                                                                  *
+ *		none.																						*
+ *                                                                         *
+ * OUTPUT:                                                                 *
+ *		none.																						*
+ *=========================================================================*/
+static void Compute_Sync_CRC(void)
+{
+    ObjectClass* objp;
+    HouseClass* housep;
+    int i, j;
+
+    for (int type = SYNC_FIRST; type < SYNC_COUNT; type++) {
+        for (i = 0; i < Sync_Count(type); i++) {
+            Sync_Update(&SyncTables[type], Sync_Ptr(type, i));
+        }
+    }
+
+    if (Debug_Check_CRC) {
+        Check_Sync_CRC();
+    }
+
+    GameCRC = SyncTotal;
+
+    for (i = 0; i < Houses.Count(); i++) {
+        housep = (HouseClass*)Houses.Active_Ptr(i);
+        Add_CRC(&GameCRC, (int)housep->Credits + (int)housep->Power + (int)housep->Drain);
+    }
+
+    for (i = 0; i < LAYER_COUNT; i++) {
+        for (j = 0; j < Map.Layer[i].Count(); j++) {
+            objp = Map.Layer[i][j];
+            Add_CRC(&GameCRC, (int)objp->Coord + (int)objp->What_Am_I());
+        }
+    }
+
+    for (i = 0; i < Logic.Count(); i++) {
+        objp = Logic[i];
+        Add_CRC(&GameCRC, (int)objp->Coord + (int)objp->What_Am_I());
+    }
+
+    Add_CRC(&GameCRC, Scen.RandomNumber.Seed);
+
+} /* end of Compute_Sync_CRC */
+
 /***************************************************************************
  * Print_CRCs -- Prints a data file for finding Sync Bugs						*
  *                                                                         *
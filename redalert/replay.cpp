@@ -0,0 +1,482 @@
+//
+// Copyright 2020 Electronic Arts Inc.
+//
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is free
+// software: you can redistribute it and/or modify it under the terms of
+// the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is distributed
+// in the hope that it will be useful, but with permitted additional restrictions
+// under Section 7 of the GPL. See the GNU General Public License in LICENSE.TXT
+// distributed with this program. You should have received a copy of the
+// GNU General Public License along with permitted additional restrictions
+// with this program. If not, see https://github.com/electronicarts/CnC_Remastered_Collection
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : REPLAY.CPP                                                   *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   ReplayClass::Close -- Finishes with the recording file.                                   *
+ *   ReplayClass::Frame_Start -- Handles the recording file at the start of a game frame.      *
+ *   ReplayClass::Load_Keyframe -- Restores the game state stored in a keyframe block.         *
+ *   ReplayClass::Open_Play -- Opens a recording for playback.                                 *
+ *   ReplayClass::Open_Record -- Starts a new recording.                                       *
+ *   ReplayClass::Read -- Reads frame data from the recording.                                 *
+ *   ReplayClass::Read_Frames -- Reads the next block of frame data.                           *
+ *   ReplayClass::Seek -- Requests that playback continue from another frame.                  *
+ *   ReplayClass::Write -- Adds frame data to the recording.                                   *
+ *   ReplayClass::Write_Frames -- Writes the gathered frame data as a block.                   *
+ *   ReplayClass::Write_Keyframe -- Writes the complete game state as a block.                 *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include "function.h"
+#include "xpipe.h"
+#include "xstraw.h"
+#include "lcwpipe.h"
+#include "lcwstraw.h"
+
+/*
+**	Size of the blocks the LCW pipe compresses in.
+*/
+#define REPLAY_LCW_SIZE 0x2000
+
+ReplayClass::ReplayClass(void)
+    : File(NULL)
+    , IsRecording(false)
+    , IsIndexed(false)
+    , IsSeekPending(false)
+    , IsSeeking(false)
+    , Buffer(NULL)
+    , BufferSize(0)
+    , Fill(0)
+    , Index(0)
+    , BlockFrame(0)
+    , KeyFrame(-1)
+    , SeekFrame(0)
+{
+}
+
+ReplayClass::~ReplayClass(void)
+{
+    delete[] Buffer;
+    Buffer = NULL;
+}
+
+/***********************************************************************************************
+ * ReplayClass::Open_Record -- Starts a new recording.                                         *
+ *                                                                                             *
+ *    This opens the file, then writes the file header and the values needed to start the      *
+ *    same game again on playback.                                                             *
+ *                                                                                             *
+ * INPUT:   file  -- The file to record to.                                                    *
+ *                                                                                             *
+ * OUTPUT:  bool; Could the file be opened?                                                    *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+bool ReplayClass::Open_Record(CCFileClass& file)
+{
+    if (!file.Open(WRITE)) {
+        return (false);
+    }
+
+    Blocks.Open(&file);
+    Blocks.Write_Header();
+    Save_Recording_Values(file);
+
+    File = &file;
+    IsRecording = true;
+    IsIndexed = true;
+    IsSeekPending = false;
+    IsSeeking = false;
+    Fill = 0;
+    Index = 0;
+    KeyFrame = -1;
+    return (true);
+}
+
+/***********************************************************************************************
+ * ReplayClass::Open_Play -- Opens a recording for playback.                                   *
+ *                                                                                             *
+ *    This opens the file and loads the values the recorded game was started with. A file      *
+ *    without the header is taken to be a recording in the original format, which is just      *
+ *    the stream of frame data; it can be played back, but only from the start.                *
+ *                                                                                             *
+ * INPUT:   file  -- The file to play back.                                                    *
+ *                                                                                             *
+ * OUTPUT:  bool; Could the file be opened?                                                    *
+ *                                                                                             *
+ * WARNINGS:   Any seek requested beforehand is kept, so that it starts with the game.         *
+ *=============================================================================================*/
+bool ReplayClass::Open_Play(CCFileClass& file)
+{
+    if (!file.Open(READ)) {
+        return (false);
+    }
+
+    File = &file;
+    IsRecording = false;
+    IsIndexed = false;
+    IsSeeking = false;
+    Fill = 0;
+    Index = 0;
+    KeyFrame = -1;
+
+    Blocks.Open(&file);
+    if (Blocks.Read_Header()) {
+        Load_Recording_Values(file);
+        Blocks.Read_Index();
+        IsIndexed = true;
+    } else {
+        file.Seek(0, SEEK_SET);
+        Load_Recording_Values(file);
+    }
+    return (true);
+}
+
+/***********************************************************************************************
+ * ReplayClass::Close -- Finishes with the recording file.                                     *
+ *                                                                                             *
+ *    When recording, the last frame data is written, followed by the index of every block     *
+ *    and the trailer that locates it.                                                         *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void ReplayClass::Close(void)
+{
+    if (File == NULL) {
+        return;
+    }
+
+    if (IsRecording) {
+        Write_Frames();
+        Blocks.Write_Index(Frame);
+    }
+
+    File->Close();
+    File = NULL;
+    IsRecording = false;
+    IsIndexed = false;
+    IsSeekPending = false;
+    IsSeeking = false;
+    Fill = 0;
+    Index = 0;
+    Blocks.Close();
+}
+
+/***********************************************************************************************
+ * ReplayClass::Write -- Adds frame data to the recording.                                     *
+ *                                                                                             *
+ * INPUT:   buffer   -- Pointer to the data to record.                                         *
+ *                                                                                             *
+ *          length   -- The number of bytes to record.                                         *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes recorded.                                         *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+int ReplayClass::Write(void const* buffer, int length)
+{
+    if (File == NULL) {
+        return (0);
+    }
+
+    if (!IsIndexed) {
+        return (File->Write(buffer, length));
+    }
+
+    if (Fill == 0) {
+        BlockFrame = Frame;
+    }
+    Reserve(Fill + length);
+    memcpy(&Buffer[Fill], buffer, length);
+    Fill += length;
+    return (length);
+}
+
+/***********************************************************************************************
+ * ReplayClass::Read -- Reads frame data from the recording.                                   *
+ *                                                                                             *
+ * INPUT:   buffer   -- Pointer to the buffer to fill.                                         *
+ *                                                                                             *
+ *          length   -- The number of bytes to read.                                           *
+ *                                                                                             *
+ * OUTPUT:  Returns with the number of bytes read; less than requested at the end of the       *
+ *          recording.                                                                         *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+int ReplayClass::Read(void* buffer, int length)
+{
+    if (File == NULL) {
+        return (0);
+    }
+
+    if (!IsIndexed) {
+        return (File->Read(buffer, length));
+    }
+
+    int total = 0;
+    while (length > 0) {
+        if (Index == Fill && !Read_Frames()) {
+            break;
+        }
+
+        int count = (length < Fill - Index) ? length : Fill - Index;
+        memcpy(buffer, &Buffer[Index], count);
+        buffer = ((char*)buffer) + count;
+        Index += count;
+        length -= count;
+        total += count;
+    }
+    return (total);
+}
+
+/***********************************************************************************************
+ * ReplayClass::Frame_Start -- Handles the recording file at the start of a game frame.        *
+ *                                                                                             *
+ *    When recording, this writes out the frame data once enough has been gathered, and a      *
+ *    keyframe every KEYFRAME_RATE frames. The keyframe is taken before any of the frame is    *
+ *    processed, so that it holds exactly the state playback will have at that point.          *
+ *                                                                                             *
+ *    When playing back, this starts a requested seek by loading the last keyframe before the  *
+ *    target frame (unless running forward from the current frame is closer), and ends it once *
+ *    the target frame is reached.                                                             *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Call this before anything of the frame is recorded or played back.              *
+ *=============================================================================================*/
+void ReplayClass::Frame_Start(void)
+{
+    if (File == NULL) {
+        return;
+    }
+
+    if (IsRecording) {
+        if (Frame != KeyFrame && (Frame % KEYFRAME_RATE) == 0) {
+            Write_Frames();
+            Write_Keyframe();
+        } else if (Fill >= BLOCK_SIZE) {
+            Write_Frames();
+        }
+        return;
+    }
+
+    if (IsSeekPending) {
+        IsSeekPending = false;
+        IsSeeking = true;
+
+        int best = -1;
+        for (int index = 0; index < Blocks.Count(); index++) {
+            if (Blocks[index].Type == ReplayFileClass::BLOCK_KEYFRAME && Blocks[index].Frame <= SeekFrame) {
+                best = index;
+            }
+        }
+
+        /*
+        **	Going backwards without a keyframe to go back to isn't possible.
+        */
+        if (best != -1 && (SeekFrame < Frame || Blocks[best].Frame > Frame)) {
+
+            /*
+            **	A keyframe that won't load has already cleared the scenario, so playback
+            **	cannot go on from here.
+            */
+            if (!Load_Keyframe(Blocks[best])) {
+                IsSeeking = false;
+                GameActive = false;
+                return;
+            }
+        }
+    }
+
+    if (IsSeeking && Frame >= SeekFrame) {
+        IsSeeking = false;
+        HiddenPage.Clear();
+        Map.Flag_To_Redraw(true);
+    }
+}
+
+/***********************************************************************************************
+ * ReplayClass::Seek -- Requests that playback continue from another frame.                    *
+ *                                                                                             *
+ *    The seek starts with the next game frame. The frames in between are simulated without    *
+ *    being drawn or timed, which keeps the game state identical to the recorded one.          *
+ *                                                                                             *
+ * INPUT:   frame -- The frame to continue playback from.                                      *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void ReplayClass::Seek(int frame)
+{
+    if (frame < 0) {
+        frame = 0;
+    }
+    SeekFrame = frame;
+    IsSeekPending = true;
+}
+
+bool ReplayClass::Is_Seeking(void) const
+{
+    return (IsSeeking || IsSeekPending);
+}
+
+/*
+**	Makes sure the frame data buffer can hold the number of bytes specified.
+*/
+void ReplayClass::Reserve(int length)
+{
+    if (length <= BufferSize) {
+        return;
+    }
+
+    int size = (BufferSize > 0) ? BufferSize : BLOCK_SIZE;
+    while (size < length) {
+        size *= 2;
+    }
+
+    char* buffer = new char[size];
+    if (Fill > 0) {
+        memcpy(buffer, Buffer, Fill);
+    }
+    delete[] Buffer;
+    Buffer = buffer;
+    BufferSize = size;
+}
+
+/***********************************************************************************************
+ * ReplayClass::Write_Frames -- Writes the gathered frame data as a block.                     *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The block header is written after the data, once its length is known.           *
+ *=============================================================================================*/
+void ReplayClass::Write_Frames(void)
+{
+    if (Fill == 0) {
+        return;
+    }
+
+    int offset = Blocks.Begin_Block();
+
+    FilePipe fpipe(File);
+    LCWPipe pipe(LCWPipe::COMPRESS, REPLAY_LCW_SIZE);
+    pipe.Put_To(fpipe);
+    pipe.Put(Buffer, Fill);
+    pipe.Flush();
+
+    Blocks.End_Block(offset, ReplayFileClass::BLOCK_FRAMES, BlockFrame, Fill);
+    Fill = 0;
+}
+
+/***********************************************************************************************
+ * ReplayClass::Write_Keyframe -- Writes the complete game state as a block.                   *
+ *                                                                                             *
+ *    The state is the same as a network save game, plus the parts of the event queue that     *
+ *    playback keeps between frames.                                                           *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void ReplayClass::Write_Keyframe(void)
+{
+    int offset = Blocks.Begin_Block();
+
+    FilePipe fpipe(File);
+    LCWPipe pipe(LCWPipe::COMPRESS, REPLAY_LCW_SIZE);
+    pipe.Put_To(fpipe);
+    Save_Game_State(pipe);
+    Save_Queue_State(pipe, Frame);
+    pipe.Flush();
+
+    Blocks.End_Block(offset, ReplayFileClass::BLOCK_KEYFRAME, Frame, 0);
+    KeyFrame = Frame;
+}
+
+/***********************************************************************************************
+ * ReplayClass::Read_Frames -- Reads the next block of frame data.                             *
+ *                                                                                             *
+ *    Keyframe blocks met on the way are skipped; playback only loads them when seeking.       *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was there another block of frame data?                                       *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+bool ReplayClass::Read_Frames(void)
+{
+    ReplayFileClass::BlockHeader header;
+
+    Fill = 0;
+    Index = 0;
+
+    for (;;) {
+        if (!Blocks.Next_Block(header)) {
+            return (false);
+        }
+
+        int end = File->Seek(0, SEEK_CUR) + header.Length;
+        if (header.Type == ReplayFileClass::BLOCK_FRAMES) {
+            Reserve(header.Size);
+
+            FileStraw fstraw(File);
+            LCWStraw straw(LCWStraw::DECOMPRESS, REPLAY_LCW_SIZE);
+            straw.Get_From(fstraw);
+            Fill = straw.Get(Buffer, header.Size);
+            File->Seek(end, SEEK_SET);
+            return (Fill > 0);
+        }
+        File->Seek(end, SEEK_SET);
+    }
+}
+
+/***********************************************************************************************
+ * ReplayClass::Load_Keyframe -- Restores the game state stored in a keyframe block.           *
+ *                                                                                             *
+ * INPUT:   entry -- The index entry of the keyframe.                                          *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the keyframe loaded?                                                     *
+ *                                                                                             *
+ * WARNINGS:   Playback continues with the frame data that follows the keyframe.               *
+ *=============================================================================================*/
+bool ReplayClass::Load_Keyframe(ReplayFileClass::IndexEntry const& entry)
+{
+    ReplayFileClass::BlockHeader header;
+
+    if (!Blocks.Read_Block(entry, ReplayFileClass::BLOCK_KEYFRAME, header)) {
+        return (false);
+    }
+    int end = entry.Offset + sizeof(header) + header.Length;
+
+    FileStraw fstraw(File);
+    LCWStraw straw(LCWStraw::DECOMPRESS, REPLAY_LCW_SIZE);
+    straw.Get_From(fstraw);
+    if (!Load_Game_State(straw) || !Load_Queue_State(straw)) {
+        return (false);
+    }
+
+    File->Seek(end, SEEK_SET);
+    Fill = 0;
+    Index = 0;
+    return (true);
+}
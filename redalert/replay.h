@@ -0,0 +1,124 @@
+//
+// Copyright 2020 Electronic Arts Inc.
+//
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is free
+// software: you can redistribute it and/or modify it under the terms of
+// the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is distributed
+// in the hope that it will be useful, but with permitted additional restrictions
+// under Section 7 of the GPL. See the GNU General Public License in LICENSE.TXT
+// distributed with this program. You should have received a copy of the
+// GNU General Public License along with permitted additional restrictions
+// with this program. If not, see https://github.com/electronicarts/CnC_Remastered_Collection
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : REPLAY.H                                                     *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include "common/replayfile.h"
+
+class CCFileClass;
+
+/*
+**	This handles the recorded games kept in a ReplayFileClass container. The per-frame data written by the record
+**	code (events and the player's view) is gathered into blocks that are compressed as they
+**	are written. Every KEYFRAME_RATE frames the complete game state is stored as well, using
+**	the same data as a network save game, and an index of every block is appended when the
+**	recording is closed. Playback can then jump to any frame by loading the nearest keyframe
+**	before it and simulating the remaining frames without drawing them.
+**
+**	Recordings made before this container existed are still played back, from the start.
+*/
+class ReplayClass
+{
+public:
+    enum ReplayEnum
+    {
+        KEYFRAME_RATE = TICKS_PER_MINUTE, // Frames between stored game states.
+        BLOCK_SIZE = 0x8000               // Frame data gathered before a block is written.
+    };
+
+    ReplayClass(void);
+    ~ReplayClass(void);
+
+    bool Open_Record(CCFileClass& file);
+    bool Open_Play(CCFileClass& file);
+    void Close(void);
+
+    int Write(void const* buffer, int length);
+    int Read(void* buffer, int length);
+
+    void Frame_Start(void);
+    void Seek(int frame);
+
+    /*
+    **	Is playback running ahead to a requested frame? Those frames are neither drawn nor
+    **	timed.
+    */
+    bool Is_Seeking(void) const;
+
+private:
+    void Reset(void);
+    void Reserve(int length);
+    void Write_Frames(void);
+    void Write_Keyframe(void);
+    bool Read_Frames(void);
+    bool Load_Keyframe(ReplayFileClass::IndexEntry const& entry);
+
+    /*
+    **	The file being recorded to or played back from.
+    */
+    CCFileClass* File;
+
+    /*
+    **	Is the file being written? Otherwise it is being played back.
+    */
+    unsigned IsRecording : 1;
+
+    /*
+    **	Is the file in this container format? Older recordings are one raw stream.
+    */
+    unsigned IsIndexed : 1;
+
+    /*
+    **	Has a jump to SeekFrame been requested that hasn't been started yet? Once started,
+    **	playback is running ahead to SeekFrame.
+    */
+    unsigned IsSeekPending : 1;
+    unsigned IsSeeking : 1;
+
+    /*
+    **	The frame data of the current block. When recording, Fill bytes gathered so far,
+    **	starting with frame BlockFrame. When playing back, Fill bytes of which the first Index
+    **	have been read.
+    */
+    char* Buffer;
+    int BufferSize;
+    int Fill;
+    int Index;
+    int BlockFrame;
+
+    /*
+    **	The frame of the last keyframe written, and the frame playback is running ahead to.
+    */
+    int KeyFrame;
+    int SeekFrame;
+
+    /*
+    **	The blocks of the file.
+    */
+    ReplayFileClass Blocks;
+};
+
+#endif
@@ -182,6 +182,8 @@ RulesClass::RulesClass(void)
     , IsExplosiveHarvester(false)
     , IsMCVDeploy(false)
     , IsAllyReveal(true)
+    , IsIncrementalCRC(false)
+    , IsFullLayerSort(false)
     , IsSeparate(false)
     , IsTreeTarget(false)
     , IsMineAware(true)
@@ -262,6 +264,10 @@ RulesClass::RulesClass(void)
     , C4Delay(".03")
     , RepairThreshhold(1000)
     , PathDelay(".016")
+    , IsAStarPath(false)
+    , AStarNodeLimit(2000)
+    , IsZonePath(false)
+    , IsPathCache(false)
     , MovieTime(1, 4)
     , TiberiumShortScan(0x0600)
     , TiberiumLongScan(0x2000)
@@ -477,6 +483,8 @@ bool RulesClass::General(CCINIClass& ini)
         Incoming = ini.Get_MPHType(GENERAL, "Incoming", MPH_IMMOBILE);
         IronCurtainDuration = ini.Get_Fixed(GENERAL, "IronCurtain", IronCurtainDuration);
         IsAllyReveal = ini.Get_Bool(GENERAL, "AllyReveal", IsAllyReveal);
+        IsIncrementalCRC = ini.Get_Bool(GENERAL, "IncrementalCRC", IsIncrementalCRC);
+        IsFullLayerSort = ini.Get_Bool(GENERAL, "FullLayerSort", IsFullLayerSort);
         IsMCVDeploy = ini.Get_Bool(GENERAL, "MCVUndeploy", IsMCVDeploy);
         MaxDamage = ini.Get_Int(GENERAL, "MaxDamage", MaxDamage);
         MinDamage = ini.Get_Int(GENERAL, "MinDamage", MinDamage);
@@ -723,6 +731,10 @@ bool RulesClass::AI(CCINIClass& ini)
         PatrolTime = ini.Get_Fixed(AI, "PatrolScan", PatrolTime);
         RepairThreshhold = ini.Get_Int(AI, "CreditReserve", RepairThreshhold);
         PathDelay = ini.Get_Fixed(AI, "PathDelay", PathDelay);
+        IsAStarPath = ini.Get_Bool(AI, "AStarPath", IsAStarPath);
+        AStarNodeLimit = ini.Get_Int(AI, "AStarNodes", AStarNodeLimit);
+        IsZonePath = ini.Get_Bool(AI, "ZonePath", IsZonePath);
+        IsPathCache = ini.Get_Bool(AI, "PathCache", IsPathCache);
         TiberiumShortScan = ini.Get_Lepton(AI, "OreNearScan", TiberiumShortScan);
         TiberiumLongScan = ini.Get_Lepton(AI, "OreFarScan", TiberiumLongScan);
         AutocreateTime = ini.Get_Fixed(AI, "AutocreateTime", AutocreateTime);
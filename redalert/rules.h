@@ -539,6 +539,21 @@ public:
     */
     unsigned IsAllyReveal : 1;
 
+    /*
+    **	If true, the multiplayer sync CRC is combined from a hash kept for each object, which
+    **	is brought up to date whenever the CRC is computed, rather than from every object's
+    **	fields in turn. Every player must use the same setting.
+    */
+    unsigned IsIncrementalCRC : 1;
+
+    /*
+    **	If true, the layers are fully sorted every frame, instead of by the one bubble pass
+    **	that lets the order catch up over several frames. The order of the ground layer
+    **	decides which object is found first when scanning for targets and goes into the sync
+    **	CRC, so every player must use the same setting.
+    */
+    unsigned IsFullLayerSort : 1;
+
     /*
     **	Can the helipad (and airfield) be purchased separately from the associated
     **	aircraft.
@@ -847,6 +862,30 @@ public:
     */
     fixed PathDelay;
 
+    /*
+    **	If true, ground units plan their paths with a budgeted A* search over the cell
+    **	grid instead of following the straight line and the edges of obstacles.
+    */
+    unsigned IsAStarPath : 1;
+
+    /*
+    **	This is the most cells the A* path finder may expand for a single path. When the
+    **	budget runs out, the path leads to the cell found nearest the destination.
+    */
+    int AStarNodeLimit;
+
+    /*
+    **	If true, long trips are first planned across the map sectors using the movement
+    **	zones, and the path finder only searches for the leg through the next few sectors.
+    */
+    unsigned IsZonePath : 1;
+
+    /*
+    **	If true, a path found for one unit may be taken over by another unit of the same type
+    **	and owner that heads for the same place in the same frame, such as in a group move.
+    */
+    unsigned IsPathCache : 1;
+
     /*
     **	This is the special (debug version only) movie recorder timeout value. Each second
     **	results in about 2-3 megabytes.
@@ -32,16 +32,22 @@
  * Functions:                                                                                  *
  *   Code_All_Pointers -- Code all pointers.                                                   *
  *   Decode_All_Pointers -- Decodes all pointers.                                              *
+ *   Finish_Save_Game -- Waits for the last save game to be written.                           *
+ *   Fixup_All -- Restores the pointers and derived data after Get_All.                        *
+ *   Get_All -- Load all save game data from the straw.                                        *
  *   Get_Savefile_Info -- gets description, scenario #, house                                  *
  *   Load_Game -- loads a saved game                                                           *
+ *   Load_Game_State -- Replaces the game state with one stored by Save_Game_State.            *
  *   Load_MPlayer_Values -- Loads multiplayer-specific values                                  *
  *   Load_Misc_Values -- loads miscellaneous variables                                         *
  *   MPlayer_Save_Message -- pops up a "saving..." message                                     *
  *   Put_All -- Store all save game data to the pipe.                                          *
  *   Reconcile_Players -- Reconciles loaded data with the 'Players' vector							  *
  *   Save_Game -- saves a game to disk                                                         *
+ *   Save_Game_State -- Stores the complete game state to a pipe.                              *
  *   Save_MPlayer_Values -- Saves multiplayer-specific values                                  *
  *   Save_Misc_Values -- saves miscellaneous variables                                         *
+ *   Write_Save_Game -- Writes a save game that has been copied out of the game.               *
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
 #include "function.h"
@@ -51,6 +57,7 @@
 #include "shapipe.h"
 #include "lcwpipe.h"
 #include "lcwstraw.h"
+#include "worker.h"
 #include "vortex.h"
 #include "carry.h"
 
@@ -282,6 +289,259 @@ static void Put_All(Pipe& pipe, int save_net)
     pipe.Flush();
 }
 
+/***********************************************************************************************
+ * Get_All -- Load all save game data from the straw.                                          *
+ *                                                                                             *
+ *    This is the counterpart of Put_All. The current scenario is cleared and then every game  *
+ *    object and state value is read back in the same order that it was stored. The object     *
+ *    pointers are left in their coded form.                                                   *
+ *                                                                                             *
+ * INPUT:   straw    -- Reference to the straw that will supply the save game data.            *
+ *                                                                                             *
+ *          load_net -- Set to whether the multiplayer values were stored as well.             *
+ *                                                                                             *
+ * OUTPUT:  bool; Was all of the data there? If not, the game state is left half loaded.       *
+ *                                                                                             *
+ * WARNINGS:   Follow this with Fixup_All once the source has been finished with.              *
+ *=============================================================================================*/
+static bool Get_All(Straw& straw, int& load_net)
+{
+    /*
+    **	Clear the scenario so we start fresh; this calls the Init_Clear() routine
+    **	for the Map, and all object arrays.  It has the following important
+    **	effects:
+    **	- Every cell is cleared to 0's, via MapClass::Init_Clear()
+    **	- All heap elements' are cleared
+    **	- The Houses are Initialized, which also clears their HouseTriggers
+    **	  array
+    **	- The map's Layers & Logic Layer are cleared to empty
+    **	- The list of currently-selected objects is cleared
+    */
+    Clear_Scenario();
+
+    /*
+    **	Load the scenario global information.
+    */
+    if (straw.Get(&Scen, sizeof(Scen)) != sizeof(Scen)) {
+        return (false);
+    }
+
+    /*
+    **	Fixup the Sessionclass scenario info so we can work out which
+    ** CD to request later
+    */
+    if (load_net) {
+
+        CCFileClass scenario_file(Scen.ScenarioName);
+        if (!scenario_file.Is_Available()) {
+
+            int cd = -1;
+            if (Is_Mission_Counterstrike(Scen.ScenarioName)) {
+                cd = 2;
+#ifdef FIXIT_CSII //	checked - ajw 9/28/98
+                if (Expansion_AM_Present()) {
+                    cd = 3;
+                }
+#endif
+            }
+#ifdef FIXIT_CSII //	checked - ajw 9/28/98
+            if (Is_Mission_Aftermath(Scen.ScenarioName)) {
+                cd = 3;
+#ifdef BOGUSCD
+                cd = -1;
+#endif
+            }
+#endif
+            RequiredCD = cd;
+            if (!Force_CD_Available(RequiredCD)) {
+                Emergency_Exit(EXIT_FAILURE);
+            }
+
+            /*
+            ** Update the internal list of scenarios to include the counterstrike
+            ** list.
+            */
+            Session.Read_Scenario_Descriptions();
+        } else {
+            /*
+            ** The scenario is available so set RequiredCD to whatever is currently
+            ** in the drive.
+            */
+            RequiredCD = -1;
+        }
+    }
+
+    /*
+    **	Load the map.  The map comes first, since it loads the Theater & init's
+    **	mixfiles.  The map calls all the type-class's Init routines, telling them
+    **	what the Theater is; this must be done before any objects are created, so
+    **	they'll be properly created.
+    */
+    if (!Map.Load(straw)) {
+        return (false);
+    }
+
+    Call_Back();
+
+    /*
+    **	Load the object data.
+    */
+    if (!Houses.Load(straw) || !TeamTypes.Load(straw) || !Teams.Load(straw) || !TriggerTypes.Load(straw)
+        || !Triggers.Load(straw) || !Aircraft.Load(straw) || !Anims.Load(straw) || !Buildings.Load(straw)
+        || !Bullets.Load(straw)) {
+        return (false);
+    }
+
+    Call_Back();
+
+    if (!Infantry.Load(straw) || !Overlays.Load(straw) || !Smudges.Load(straw) || !Templates.Load(straw)
+        || !Terrains.Load(straw) || !Units.Load(straw) || !Factories.Load(straw) || !Vessels.Load(straw)) {
+        return (false);
+    }
+
+    /*
+    **	Load the Logic & Map Layers
+    */
+    if (!Logic.Load(straw)) {
+        return (false);
+    }
+
+    int count;
+    straw.Get(&count, sizeof(count));
+    MapTriggers.Clear();
+    int index;
+    for (index = 0; index < count; index++) {
+        TARGET target;
+        straw.Get(&target, sizeof(target));
+        MapTriggers.Add(As_Trigger(target));
+    }
+
+    straw.Get(&count, sizeof(count));
+    LogicTriggers.Clear();
+    for (index = 0; index < count; index++) {
+        TARGET target;
+        straw.Get(&target, sizeof(target));
+        LogicTriggers.Add(As_Trigger(target));
+    }
+    Logic.Init_Triggers();
+    Sync_CRC_Reset();
+
+    for (HousesType h = HOUSE_FIRST; h < HOUSE_COUNT; h++) {
+        straw.Get(&count, sizeof(count));
+        HouseTriggers[h].Clear();
+        for (index = 0; index < count; index++) {
+            TARGET target;
+            straw.Get(&target, sizeof(target));
+            HouseTriggers[h].Add(As_Trigger(target));
+        }
+    }
+
+    for (int i = 0; i < LAYER_COUNT; i++) {
+        if (!Map.Layer[i].Load(straw)) {
+            return (false);
+        }
+    }
+
+    Call_Back();
+
+    /*
+    **	Load the Score
+    */
+    straw.Get(&Score, sizeof(Score));
+    new (&Score) ScoreClass(NoInitClass());
+
+    /*
+    **	Load the AI Base
+    */
+    if (!Base.Load(straw)) {
+        return (false);
+    }
+
+    /*
+    **	Delete any carryover pseudo-saved game list.
+    */
+    while (Carryover != NULL) {
+        CarryoverClass* cptr = (CarryoverClass*)Carryover->Get_Next();
+        Carryover->Remove();
+        delete Carryover;
+        Carryover = cptr;
+    }
+
+    /*
+    **	Load any carryover pseudo-saved game list.
+    */
+    int carry_count = 0;
+    straw.Get(&carry_count, sizeof(carry_count));
+    while (carry_count) {
+        CarryoverClass* cptr = new CarryoverClass;
+        assert(cptr != NULL);
+
+        straw.Get(cptr, sizeof(CarryoverClass));
+        new (cptr) CarryoverClass(NoInitClass());
+        cptr->Zap();
+
+        if (!Carryover) {
+            Carryover = cptr;
+        } else {
+            cptr->Add_Tail(*Carryover);
+        }
+        carry_count--;
+    }
+
+    Call_Back();
+
+    /*
+    **	Load miscellaneous variables, including the map size & the Theater
+    */
+    if (!Load_Misc_Values(straw)) {
+        return (false);
+    }
+
+    /*
+    **	Load multiplayer values. Everything is read in order, so if the data ran short anywhere
+    **	before this, this read comes up short too.
+    */
+    if (straw.Get(&load_net, sizeof(load_net)) != sizeof(load_net)) {
+        return (false);
+    }
+    if (load_net) {
+        return (Load_MPlayer_Values(straw));
+    }
+    return (true);
+}
+
+/***********************************************************************************************
+ * Fixup_All -- Restores the pointers and derived data after Get_All.                          *
+ *                                                                                             *
+ * INPUT:   load_net -- Were the multiplayer values loaded too?                                *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+static void Fixup_All(int load_net)
+{
+    Decode_All_Pointers();
+    Map.Init_IO();
+    Map.Flag_To_Redraw(true);
+
+    /*
+    **	Fixup any expediency data that can be inferred from the physical
+    **	data loaded.
+    */
+    Post_Load_Game(load_net);
+
+    /*
+    ** Re-init unit trackers. They will be garbage pointers after the load
+    */
+    for (HousesType house = HOUSE_FIRST; house < HOUSE_COUNT; house++) {
+        HouseClass* hptr = HouseClass::As_Pointer(house);
+        if (hptr && hptr->IsActive) {
+            hptr->Init_Unit_Trackers();
+        }
+    }
+}
+
 /***************************************************************************
  * Save_Game -- saves a game to disk                                       *
  *                                                                         *
@@ -340,44 +600,51 @@ bool Save_Game(int id, char const* descr, bool)
 }
 
 /*
-** Version that takes file name. ST - 9/9/2019 11:10AM
+**	A save game that has been copied out of the game and is waiting to be compressed,
+**	encrypted and written to disk by the save worker. Only one save is ever in flight;
+**	the next save waits for it first.
 */
-bool NowSavingGame = false; // TEMP MBL: Need to discuss better solution with Steve
-bool Save_Game(const char* file_name, const char* descr)
+struct SaveJobType
 {
-    NowSavingGame = true; // TEMP MBL: Need to discuss better solution with Steve
-
-    int save_net = 0; // 1 = save network/modem game
-
-    if (Session.Type == GAME_GLYPHX_MULTIPLAYER) {
-        save_net = 1;
-    }
+    char Name[_MAX_PATH];
+    char Descr[DESCRIP_MAX];
+    unsigned Scenario;
+    HousesType House;
+    unsigned Version;
+    MemoryPipe Prefix; // Written ahead of the header (DLL values).
+    MemoryPipe Data;   // The game data, as it goes into the pipe chain.
+    bool Result;
+};
+
+static SaveJobType SaveJob;
+static WorkerClass SaveWorker;
 
-    unsigned scenario;
-    HousesType house;
-
-    scenario = Scen.Scenario;        // get current scenario #
-    house = PlayerPtr->Class->House; // get current house
-
-    /*
-    **	Code everybody's pointers
-    */
-    Code_All_Pointers();
+/***********************************************************************************************
+ * Write_Save_Game -- Writes a save game that has been copied out of the game.                 *
+ *                                                                                             *
+ *    This runs on the save worker thread. It only uses the copy in the job, so the game can   *
+ *    carry on while the data is compressed, encrypted and written.                            *
+ *                                                                                             *
+ * INPUT:   data  -- Pointer to the SaveJobType to write.                                      *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+static void Write_Save_Game(void* data)
+{
+    SaveJobType* job = (SaveJobType*)data;
 
     /*
     **	Open the file
     */
-    CDFileClass file(file_name);
+    CDFileClass file(job->Name);
 
     FilePipe fpipe(&file);
-#ifdef REMASTER_BUILD
-    /*
-    ** Save the DLLs variables first, so we can do a version check in the DLL when we begin the load
-    */
-    if (RunningAsDLL) {
-        DLLSave(fpipe);
+    if (job->Prefix.Get_Length() > 0) {
+        fpipe.Put(job->Prefix.Get_Buffer(), job->Prefix.Get_Length());
     }
-#endif
+
     /*
     **	Save the description, scenario #, and house
     **	(scenario # & house are saved separately from the actual Scenario &
@@ -387,24 +654,20 @@ bool Save_Game(const char* file_name, const char* descr)
     **	which may or may not be a HousesType number; so, saving 'house'
     **	here ensures we can always pull out the house for this file.)
     */
-    char descr_buf[DESCRIP_MAX];
-    memset(descr_buf, '\0', sizeof(descr_buf));
-    sprintf(descr_buf, "%s\r\n", descr); // put CR-LF after text
-    // descr_buf[strlen(descr_buf) + 1] = 26;		// put CTRL-Z after NULL
-    fpipe.Put(descr_buf, DESCRIP_MAX);
+    if (fpipe.Put(job->Descr, DESCRIP_MAX) != DESCRIP_MAX) {
+        job->Result = false;
+        fpipe.End();
+        return;
+    }
 
-    fpipe.Put(&scenario, sizeof(scenario));
+    fpipe.Put(&job->Scenario, sizeof(job->Scenario));
 
-    fpipe.Put(&house, sizeof(house));
+    fpipe.Put(&job->House, sizeof(job->House));
 
     /*
     **	Save the save-game version, for loading verification
     */
-    unsigned int version = SAVEGAME_VERSION;
-#ifdef FIXIT_CSII //	checked - ajw 9/28/98
-    version++;
-#endif
-    fpipe.Put(&version, sizeof(version));
+    fpipe.Put(&job->Version, sizeof(job->Version));
 
     int pos = file.Seek(0, SEEK_CUR);
 
@@ -424,27 +687,111 @@ bool Save_Game(const char* file_name, const char* descr)
     LCWPipe pipe(LCWPipe::COMPRESS, SAVE_BLOCK_SIZE);
     bpipe.Key(&FastKey, BlowfishEngine::MAX_KEY_LENGTH);
 
-    sha.Put_To(fpipe);
-    bpipe.Put_To(sha);
-    pipe.Put_To(bpipe);
-    Put_All(pipe, save_net);
+    sha.Put_To(fpipe);
+    bpipe.Put_To(sha);
+    pipe.Put_To(bpipe);
+    pipe.Put(job->Data.Get_Buffer(), job->Data.Get_Length());
+
+    /*
+    **	Output the real final message digest. This is the one that is of
+    **	the data image as it exists on the disk.
+    */
+    pipe.Flush();
+    file.Seek(pos, SEEK_SET);
+    sha.Result(digest);
+    fpipe.Put(digest, sizeof(digest));
+
+    pipe.End();
+
+    job->Result = true;
+}
+
+/*
+** Version that takes file name. ST - 9/9/2019 11:10AM
+*/
+bool NowSavingGame = false; // TEMP MBL: Need to discuss better solution with Steve
+bool Save_Game(const char* file_name, const char* descr)
+{
+    NowSavingGame = true; // TEMP MBL: Need to discuss better solution with Steve
+
+    int save_net = 0; // 1 = save network/modem game
+
+    if (Session.Type == GAME_GLYPHX_MULTIPLAYER) {
+        save_net = 1;
+    }
+
+    /*
+    **	The previous save must be on disk before its copy can be reused.
+    */
+    SaveWorker.Wait();
+
+    strncpy(SaveJob.Name, file_name, sizeof(SaveJob.Name));
+    SaveJob.Name[sizeof(SaveJob.Name) - 1] = '\0';
+
+    SaveJob.Scenario = Scen.Scenario;           // get current scenario #
+    SaveJob.House = PlayerPtr->Class->House; // get current house
+
+    memset(SaveJob.Descr, '\0', sizeof(SaveJob.Descr));
+    snprintf(SaveJob.Descr, sizeof(SaveJob.Descr), "%s\r\n", descr); // put CR-LF after text
+
+    SaveJob.Version = SAVEGAME_VERSION;
+#ifdef FIXIT_CSII //	checked - ajw 9/28/98
+    SaveJob.Version++;
+#endif
 
     /*
-    **	Output the real final message digest. This is the one that is of
-    **	the data image as it exists on the disk.
+    **	Code everybody's pointers, and copy the game data out while they are coded. This is
+    **	all the game has to wait for; the rest is done by the save worker.
     */
-    pipe.Flush();
-    file.Seek(pos, SEEK_SET);
-    sha.Result(digest);
-    fpipe.Put(digest, sizeof(digest));
+    Code_All_Pointers();
 
-    pipe.End();
+    SaveJob.Prefix.Clear();
+#ifdef REMASTER_BUILD
+    /*
+    ** Save the DLLs variables first, so we can do a version check in the DLL when we begin the load
+    */
+    if (RunningAsDLL) {
+        DLLSave(SaveJob.Prefix);
+    }
+#endif
+
+    SaveJob.Data.Clear();
+    Put_All(SaveJob.Data, save_net);
 
     Decode_All_Pointers();
 
     NowSavingGame = false; // TEMP MBL: Need to discuss better solution with Steve
 
+#ifdef REMASTER_BUILD
+    /*
+    **	The DLL's caller expects the file to be there when this returns.
+    */
+    Write_Save_Game(&SaveJob);
+    return (SaveJob.Result);
+#else
+    SaveJob.Result = false;
+    SaveWorker.Submit(Write_Save_Game, &SaveJob);
     return (true);
+#endif
+}
+
+/***********************************************************************************************
+ * Finish_Save_Game -- Waits for the last save game to be written.                             *
+ *                                                                                             *
+ *    Save_Game returns as soon as the game data has been copied; the file is written in the   *
+ *    background. Call this before reading save files, before exiting, or to find out whether  *
+ *    the save succeeded.                                                                      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the last save game written successfully (true if there was none)?        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+bool Finish_Save_Game(void)
+{
+    SaveWorker.Wait();
+    return (SaveJob.Name[0] == '\0' || SaveJob.Result);
 }
 
 /***************************************************************************
@@ -509,12 +856,16 @@ bool Load_Game(int id)
 */
 bool Load_Game(const char* file_name)
 {
-    int i;
     unsigned scenario;
     HousesType house;
     char descr_buf[DESCRIP_MAX];
     int load_net = 0; // 1 = save network/modem game
 
+    /*
+    **	The file may be the one still being written.
+    */
+    Finish_Save_Game();
+
     /*
     **	Open the file
     */
@@ -613,219 +964,13 @@ bool Load_Game(const char* file_name)
     bstraw.Get_From(fstraw);
     straw.Get_From(bstraw);
 
-    /*
-    **	Clear the scenario so we start fresh; this calls the Init_Clear() routine
-    **	for the Map, and all object arrays.  It has the following important
-    **	effects:
-    **	- Every cell is cleared to 0's, via MapClass::Init_Clear()
-    **	- All heap elements' are cleared
-    **	- The Houses are Initialized, which also clears their HouseTriggers
-    **	  array
-    **	- The map's Layers & Logic Layer are cleared to empty
-    **	- The list of currently-selected objects is cleared
-    */
-    Clear_Scenario();
-
-    /*
-    **	Load the scenario global information.
-    */
-    straw.Get(&Scen, sizeof(Scen));
-
-    /*
-    **	Fixup the Sessionclass scenario info so we can work out which
-    ** CD to request later
-    */
-    if (load_net) {
-
-        CCFileClass scenario_file(Scen.ScenarioName);
-        if (!scenario_file.Is_Available()) {
-
-            int cd = -1;
-            if (Is_Mission_Counterstrike(Scen.ScenarioName)) {
-                cd = 2;
-#ifdef FIXIT_CSII //	checked - ajw 9/28/98
-                if (Expansion_AM_Present()) {
-                    cd = 3;
-                }
-#endif
-            }
-#ifdef FIXIT_CSII //	checked - ajw 9/28/98
-            if (Is_Mission_Aftermath(Scen.ScenarioName)) {
-                cd = 3;
-#ifdef BOGUSCD
-                cd = -1;
-#endif
-            }
-#endif
-            RequiredCD = cd;
-            if (!Force_CD_Available(RequiredCD)) {
-                Emergency_Exit(EXIT_FAILURE);
-            }
-
-            /*
-            ** Update the internal list of scenarios to include the counterstrike
-            ** list.
-            */
-            Session.Read_Scenario_Descriptions();
-        } else {
-            /*
-            ** The scenario is available so set RequiredCD to whatever is currently
-            ** in the drive.
-            */
-            RequiredCD = -1;
-        }
-    }
-
-    /*
-    **	Load the map.  The map comes first, since it loads the Theater & init's
-    **	mixfiles.  The map calls all the type-class's Init routines, telling them
-    **	what the Theater is; this must be done before any objects are created, so
-    **	they'll be properly created.
-    */
-    Map.Load(straw);
-
-    Call_Back();
-
-    /*
-    **	Load the object data.
-    */
-    Houses.Load(straw);
-    TeamTypes.Load(straw);
-    Teams.Load(straw);
-    TriggerTypes.Load(straw);
-    Triggers.Load(straw);
-    Aircraft.Load(straw);
-    Anims.Load(straw);
-    Buildings.Load(straw);
-    Bullets.Load(straw);
-
-    Call_Back();
-
-    Infantry.Load(straw);
-    Overlays.Load(straw);
-    Smudges.Load(straw);
-    Templates.Load(straw);
-    Terrains.Load(straw);
-    Units.Load(straw);
-    Factories.Load(straw);
-    Vessels.Load(straw);
-
-    /*
-    **	Load the Logic & Map Layers
-    */
-    Logic.Load(straw);
-
-    int count;
-    straw.Get(&count, sizeof(count));
-    MapTriggers.Clear();
-    int index;
-    for (index = 0; index < count; index++) {
-        TARGET target;
-        straw.Get(&target, sizeof(target));
-        MapTriggers.Add(As_Trigger(target));
-    }
-
-    straw.Get(&count, sizeof(count));
-    LogicTriggers.Clear();
-    for (index = 0; index < count; index++) {
-        TARGET target;
-        straw.Get(&target, sizeof(target));
-        LogicTriggers.Add(As_Trigger(target));
-    }
-
-    for (HousesType h = HOUSE_FIRST; h < HOUSE_COUNT; h++) {
-        straw.Get(&count, sizeof(count));
-        HouseTriggers[h].Clear();
-        for (index = 0; index < count; index++) {
-            TARGET target;
-            straw.Get(&target, sizeof(target));
-            HouseTriggers[h].Add(As_Trigger(target));
-        }
-    }
-
-    for (i = 0; i < LAYER_COUNT; i++) {
-        Map.Layer[i].Load(straw);
-    }
-
-    Call_Back();
-
-    /*
-    **	Load the Score
-    */
-    straw.Get(&Score, sizeof(Score));
-    new (&Score) ScoreClass(NoInitClass());
-
-    /*
-    **	Load the AI Base
-    */
-    Base.Load(straw);
-
-    /*
-    **	Delete any carryover pseudo-saved game list.
-    */
-    while (Carryover != NULL) {
-        CarryoverClass* cptr = (CarryoverClass*)Carryover->Get_Next();
-        Carryover->Remove();
-        delete Carryover;
-        Carryover = cptr;
-    }
-
-    /*
-    **	Load any carryover pseudo-saved game list.
-    */
-    int carry_count = 0;
-    straw.Get(&carry_count, sizeof(carry_count));
-    while (carry_count) {
-        CarryoverClass* cptr = new CarryoverClass;
-        assert(cptr != NULL);
-
-        straw.Get(cptr, sizeof(CarryoverClass));
-        new (cptr) CarryoverClass(NoInitClass());
-        cptr->Zap();
-
-        if (!Carryover) {
-            Carryover = cptr;
-        } else {
-            cptr->Add_Tail(*Carryover);
-        }
-        carry_count--;
-    }
-
-    Call_Back();
-
-    /*
-    **	Load miscellaneous variables, including the map size & the Theater
-    */
-    Load_Misc_Values(straw);
-
-    /*
-    **	Load multiplayer values
-    */
-    straw.Get(&load_net, sizeof(load_net));
-    if (load_net) {
-        Load_MPlayer_Values(straw);
+    if (!Get_All(straw, load_net)) {
+        file.Close();
+        return (false);
     }
 
     file.Close();
-    Decode_All_Pointers();
-    Map.Init_IO();
-    Map.Flag_To_Redraw(true);
-
-    /*
-    **	Fixup any expediency data that can be inferred from the physical
-    **	data loaded.
-    */
-    Post_Load_Game(load_net);
-
-    /*
-    ** Re-init unit trackers. They will be garbage pointers after the load
-    */
-    for (HousesType house = HOUSE_FIRST; house < HOUSE_COUNT; house++) {
-        HouseClass* hptr = HouseClass::As_Pointer(house);
-        if (hptr && hptr->IsActive) {
-            hptr->Init_Unit_Trackers();
-        }
-    }
+    Fixup_All(load_net);
 
     Call_Back();
 
@@ -1025,6 +1170,52 @@ bool Load_Game(const char* file_name)
     return (true);
 }
 
+/***********************************************************************************************
+ * Save_Game_State -- Stores the complete game state to a pipe.                                *
+ *                                                                                             *
+ *    This stores the same data as a network save game, but without any of the save file       *
+ *    header, compression or encryption; the caller chains whatever it needs onto the pipe.    *
+ *                                                                                             *
+ * INPUT:   pipe  -- Reference to the pipe that will receive the game state.                   *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the state stored?                                                        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+bool Save_Game_State(Pipe& pipe)
+{
+    Code_All_Pointers();
+    Put_All(pipe, 1);
+    Decode_All_Pointers();
+
+    return (true);
+}
+
+/***********************************************************************************************
+ * Load_Game_State -- Replaces the game state with one stored by Save_Game_State.              *
+ *                                                                                             *
+ *    Unlike Load_Game, this does not reload the rules, sidebar art or music, since the state  *
+ *    is expected to come from the scenario that is already running.                           *
+ *                                                                                             *
+ * INPUT:   straw -- Reference to the straw that will supply the game state.                   *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the state loaded?                                                        *
+ *                                                                                             *
+ * WARNINGS:   If the state was cut short, the game state is left half loaded and the game     *
+ *             cannot go on.                                                                   *
+ *=============================================================================================*/
+bool Load_Game_State(Straw& straw)
+{
+    int load_net = 0;
+
+    if (!Get_All(straw, load_net)) {
+        return (false);
+    }
+    Fixup_All(load_net);
+
+    return (true);
+}
+
 /***************************************************************************
  * Save_Misc_Values -- saves miscellaneous variables                       *
  *                                                                         *
@@ -1434,6 +1625,8 @@ bool Get_Savefile_Info(int id, char* buf, unsigned* scenp, HousesType* housep)
     unsigned int version;
     char descr_buf[DESCRIP_MAX];
 
+    Finish_Save_Game();
+
     /*
     **	Generate the filename to load
     */
@@ -65,6 +65,7 @@
 #include "factory.h"
 #include "carry.h"
 #include "common/framelimit.h"
+#include <chrono>
 
 extern int PreserveVQAScreen;
 
@@ -269,6 +270,7 @@ bool ScenarioClass::Set_Global_To(int global, bool value)
         if (previous != value) {
             GlobalFlags[global] = value;
             IsGlobalChanged = true;
+            Logic.Wake_Triggers(TEVENT_GLOBAL_SET);
 
             /*
             **	Special case to scan through all triggers and if any are found that depend on this
@@ -312,6 +314,12 @@ bool ScenarioClass::Set_Global_To(int global, bool value)
  *=============================================================================================*/
 bool Start_Scenario(char* name, bool briefing)
 {
+    /*
+    **	The prefetch reads through the mixfiles, so it must be done before anything here
+    **	asks for a CD or touches a mixfile.
+    */
+    Finish_Prefetch();
+
     if (Session.Type != GAME_NORMAL) {
         briefing = false;
     }
@@ -319,9 +327,13 @@ bool Start_Scenario(char* name, bool briefing)
     // BG	Theme.Queue_Song(THEME_QUIET);
     Theme.Stop();
     IsTanyaDead = SaveTanya;
+
+    auto start = std::chrono::steady_clock::now();
     if (!Read_Scenario(name)) {
         return (false);
     }
+    auto load = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    DBG_INFO("Start_Scenario: %s loaded in %d ms.", name, (int)load.count());
 
     /*
     ** This was added in the Sept 16th 2020 update, causes colors to alternate for both in standalone.
@@ -390,7 +402,8 @@ bool Start_Scenario(char* name, bool briefing)
     if (Scen.BriefMovie != VQ_NONE) {
         sprintf(buffer, "%s.VQA", VQName[Scen.BriefMovie]);
     }
-    if (Session.Type == GAME_NORMAL && (Scen.BriefMovie == VQ_NONE || !CCFileClass(buffer).Is_Available())) {
+    if (Session.Type == GAME_NORMAL && Benches == NULL
+        && (Scen.BriefMovie == VQ_NONE || !CCFileClass(buffer).Is_Available())) {
         /*
         ** Make sure the mouse is visible before showing the restatement.
         */
@@ -632,6 +645,8 @@ void Fill_In_Data(void)
             HouseTriggers[tp->House].Add(Find_Or_Make(tp));
         }
     }
+    Logic.Init_Triggers();
+    Sync_CRC_Reset();
 
     ScenarioInit--;
 
@@ -731,6 +746,8 @@ void Post_Load_Game(int load_multi)
     }
     Scen.BridgeCount = Map.Intact_Bridge_Count();
     Map.Zone_Reset(MZONEF_ALL);
+    Map.Threat_Recount();
+    Clear_Path_Cache();
 }
 
 /***********************************************************************************************
@@ -787,11 +804,14 @@ void Clear_Scenario(void)
 
     MapTriggers.Clear();
     LogicTriggers.Clear();
+    Logic.Init_Triggers();
 
     for (HousesType house = HOUSE_FIRST; house < HOUSE_COUNT; house++) {
         HouseTriggers[house].Clear();
     }
 
+    Clear_Path_Cache();
+
     /*
     ** Call everyone's Init routine, except the Map's; for the Map, only call
     ** MapClass::Init, which clears the Cell array.  The Display::Init requires
@@ -802,6 +822,7 @@ void Clear_Scenario(void)
     Map.Init_Clear();
     Score.Init();
     Logic.Init();
+    Interpolate_Clear();
 
     HouseClass::Init();
     ObjectClass::Init();
@@ -926,6 +947,24 @@ void Do_Win(void)
         return;
     }
 
+    /*
+    **	Start reading the next scenario while the movies play. Until the map selection has
+    **	been made this is a guess at the usual choice, the A variation of the next mission.
+    */
+    if (!Session.Play && !Scen.IsOneTimeOnly && !Scen.IsEndOfGame && Scen.Scenario < 99) {
+        char scenarioname[_MAX_FNAME + _MAX_EXT];
+        strcpy(scenarioname, Scen.ScenarioName);
+        if (Scen.IsNoMapSel) {
+            scenarioname[6] = 'B';
+        } else {
+            char buf[10];
+            sprintf(buf, "%02d", Scen.Scenario + 1);
+            memcpy(&scenarioname[3], buf, 2);
+            scenarioname[6] = 'A';
+        }
+        Prefetch_Scenario(scenarioname);
+    }
+
     Hide_Mouse();
     VisiblePage.Clear();
     Show_Mouse();
@@ -1009,6 +1048,7 @@ void Do_Win(void)
         } else {
             Scen.Set_Scenario_Name(Map_Selection());
         }
+        Prefetch_Scenario(Scen.ScenarioName);
 
         Keyboard->Clear();
     }
@@ -2026,6 +2066,8 @@ bool Read_Scenario_INI(char* fname, bool)
 {
     //	char fname[_MAX_FNAME+_MAX_EXT];			// full INI filename
 
+    Finish_Prefetch();
+
     ScenarioInit++;
 
     Clear_Scenario();
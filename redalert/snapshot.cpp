@@ -0,0 +1,163 @@
+//
+// Copyright 2020 Electronic Arts Inc.
+//
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is free
+// software: you can redistribute it and/or modify it under the terms of
+// the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is distributed
+// in the hope that it will be useful, but with permitted additional restrictions
+// under Section 7 of the GPL. See the GNU General Public License in LICENSE.TXT
+// distributed with this program. You should have received a copy of the
+// GNU General Public License along with permitted additional restrictions
+// with this program. If not, see https://github.com/electronicarts/CnC_Remastered_Collection
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : SNAPSHOT.CPP                                                 *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   Check_Snapshot -- Verifies that a restored snapshot replays identically.                  *
+ *   SnapshotClass::Clear -- Discards the snapshot.                                            *
+ *   SnapshotClass::Restore -- Puts the game back to the state in the snapshot.                *
+ *   SnapshotClass::Take -- Copies the current game state into the snapshot.                   *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include "function.h"
+#include "xstraw.h"
+#include <limits.h>
+
+SnapshotClass::SnapshotClass(void)
+    : TakenFrame(0)
+{
+}
+
+/***********************************************************************************************
+ * SnapshotClass::Take -- Copies the current game state into the snapshot.                     *
+ *                                                                                             *
+ *    Any earlier snapshot is replaced. This should be called at the start of a game frame,    *
+ *    before any of the frame has been processed.                                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the snapshot taken?                                                      *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+bool SnapshotClass::Take(void)
+{
+    BStart(BENCH_SNAPSHOT);
+
+    Data.Clear();
+    TakenFrame = Frame;
+    Save_Game_State(Data);
+    Save_Queue_State(Data, INT_MAX);
+
+    BEnd(BENCH_SNAPSHOT);
+    return (true);
+}
+
+/***********************************************************************************************
+ * SnapshotClass::Restore -- Puts the game back to the state in the snapshot.                  *
+ *                                                                                             *
+ *    The snapshot is kept, so the game can be restored to it again.                           *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  bool; Was the game state restored?                                                 *
+ *                                                                                             *
+ * WARNINGS:   Events queued since the snapshot was taken are lost.                            *
+ *=============================================================================================*/
+bool SnapshotClass::Restore(void)
+{
+    if (!Is_Valid()) {
+        return (false);
+    }
+
+    BStart(BENCH_RESTORE);
+
+    BufferStraw straw(Data.Get_Buffer(), Data.Get_Length());
+    bool ok = Load_Game_State(straw) && Load_Queue_State(straw);
+
+    BEnd(BENCH_RESTORE);
+    return (ok);
+}
+
+/***********************************************************************************************
+ * SnapshotClass::Clear -- Discards the snapshot.                                              *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   The memory is kept for the next snapshot.                                       *
+ *=============================================================================================*/
+void SnapshotClass::Clear(void)
+{
+    Data.Clear();
+}
+
+/***********************************************************************************************
+ * Check_Snapshot -- Verifies that a restored snapshot replays identically.                    *
+ *                                                                                             *
+ *    Every CHECK_RATE frames this takes a snapshot, lets the game run CHECK_TICKS frames and  *
+ *    notes the game CRC. It then restores the snapshot and runs the same frames again; the    *
+ *    CRC must come out the same. Since events queued after a snapshot are lost when it is     *
+ *    restored, this is only done in benchmark runs, which take no input.                      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   Call this at the start of a game frame. The frames that are run twice are       *
+ *             counted twice by the other benchmarks.                                          *
+ *=============================================================================================*/
+void Check_Snapshot(void)
+{
+    enum
+    {
+        CHECK_RATE = TICKS_PER_SECOND * 10,
+        CHECK_TICKS = TICKS_PER_SECOND * 2
+    };
+
+    static SnapshotClass _snapshot;
+    static bool _replaying = false;
+    static unsigned int _crc = 0;
+
+    if (Benches == NULL) {
+        return;
+    }
+
+    if (!_snapshot.Is_Valid()) {
+        if ((Frame % CHECK_RATE) == 0) {
+            _snapshot.Take();
+            _replaying = false;
+        }
+        return;
+    }
+
+    if (Frame != _snapshot.Get_Frame() + CHECK_TICKS) {
+        return;
+    }
+
+    unsigned int crc = Get_Game_CRC();
+    if (!_replaying) {
+        _crc = crc;
+        _replaying = true;
+        _snapshot.Restore();
+        return;
+    }
+
+    if (crc != _crc) {
+        DBG_ERROR("Check_Snapshot: frame %d, game CRC %08x after restoring frame %d differs from %08x.",
+                  Frame,
+                  crc,
+                  _snapshot.Get_Frame(),
+                  _crc);
+    }
+    _snapshot.Clear();
+}
@@ -0,0 +1,83 @@
+//
+// Copyright 2020 Electronic Arts Inc.
+//
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is free
+// software: you can redistribute it and/or modify it under the terms of
+// the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is distributed
+// in the hope that it will be useful, but with permitted additional restrictions
+// under Section 7 of the GPL. See the GNU General Public License in LICENSE.TXT
+// distributed with this program. You should have received a copy of the
+// GNU General Public License along with permitted additional restrictions
+// with this program. If not, see https://github.com/electronicarts/CnC_Remastered_Collection
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : SNAPSHOT.H                                                   *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include "xpipe.h"
+
+/*
+**	This holds a copy of the complete game state in memory, so that the game can be put back
+**	to an earlier frame (for rewinding, or for rolling back and simulating again) without
+**	going through a save file. The state is the same as a network save game plus the event
+**	queue, stored uncompressed. The buffer is kept between snapshots, so once it has grown to
+**	the size of the game no more memory is allocated.
+**
+**	Taking or restoring a snapshot is meant to stay under 5 ms on a full 8 player map. Both
+**	are timed as benchmarks (BENCH_SNAPSHOT and BENCH_RESTORE) so this can be checked with
+**	the -BENCHMARK switch.
+*/
+class SnapshotClass
+{
+public:
+    SnapshotClass(void);
+
+    bool Take(void);
+    bool Restore(void);
+    void Clear(void);
+
+    /*
+    **	Is there a snapshot to restore?
+    */
+    bool Is_Valid(void) const
+    {
+        return (Data.Get_Length() > 0);
+    }
+
+    /*
+    **	The frame the snapshot was taken on.
+    */
+    int Get_Frame(void) const
+    {
+        return (TakenFrame);
+    }
+
+    /*
+    **	The number of bytes the snapshot takes up.
+    */
+    int Size(void) const
+    {
+        return (Data.Get_Length());
+    }
+
+private:
+    MemoryPipe Data;
+    int TakenFrame;
+
+    SnapshotClass(SnapshotClass const& rvalue);
+    SnapshotClass& operator=(SnapshotClass const& rvalue);
+};
+
+#endif
@@ -644,6 +644,12 @@ void Prog_End(const char* why, bool fatal)
         *((int*)0) = 0;
     }
 
+    /*
+    **	Don't leave a half written save game behind.
+    */
+    Finish_Save_Game();
+    Finish_Prefetch();
+
     if (Session.Type == GAME_GLYPHX_MULTIPLAYER) {
         return;
     }
@@ -762,6 +768,8 @@ void Read_Setup_Options(RawFileClass* config_file)
     */
     VideoBackBufferAllowed = ini.Get_Bool("Options", "VideoBackBuffer", true);
     AllowHardwareBlitFills = ini.Get_Bool("Options", "HardwareFills", true);
+    MFCD::IsMappingAllowed = ini.Get_Bool("Options", "MapMixFiles", true);
+    RawFileClass::ReadAheadWindow = ini.Get_Int("Options", "ReadAhead", RawFileClass::ReadAheadWindow);
 }
 
 void Get_OS_Version(void)
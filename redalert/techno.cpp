@@ -58,6 +58,7 @@
  *   TechnoClass::Draw_Pips -- Draws the transport pips and other techno graphics.             *
  *   TechnoClass::Electric_Zap -- Fires electric zap at the target specified.                  *
  *   TechnoClass::Enter_Idle_Mode -- Object enters its default idle condition.                 *
+ *   TechnoClass::Evaluate_Buckets -- Finds the ring scan target within a band of rings.       *
  *   TechnoClass::Evaluate_Cell -- Determine the value and object of specified cell.           *
  *   TechnoClass::Evaluate_Just_Cell -- Evaluate a cell as a target by itself.                 *
  *   TechnoClass::Evaluate_Object -- Determines score value of specified object.               *
@@ -690,6 +691,23 @@ TechnoClass::TechnoClass(RTTIType rtti, int id, HousesType house)
     }
 }
 
+/***********************************************************************************************
+ * TechnoClass::~TechnoClass -- Destructor for techno objects.                                 *
+ *                                                                                             *
+ *    Takes the object out of the incremental sync CRC before its heap slot is released.       *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+TechnoClass::~TechnoClass(void)
+{
+    Sync_CRC_Remove(this);
+    House = 0;
+}
+
 /***********************************************************************************************
  * TechnoClass::Is_Visible_On_Radar -- Is this object visible on player's radar screen?        *
  *                                                                                             *
@@ -2079,6 +2097,109 @@ bool TechnoClass::Evaluate_Object(ThreatType method,
         return (Weapon_Range(0) - Distance(Cell_Coord(cell)));
     }
 
+    /***********************************************************************************************
+     * TechnoClass::Evaluate_Buckets -- Finds the ring scan target within a band of rings.         *
+     *                                                                                             *
+     *    This examines the cells that lie between the inner and outer ring (inclusive) around the *
+     *    cell specified, but only in those buckets that hold an object this object could target.  *
+     *    The result is the target found in the cell that Greatest_Threat's ring scan would have   *
+     *    examined last, which is the one that scan would pick for the same band of rings.         *
+     *                                                                                             *
+     * INPUT:   method   -- The scan method to use for target searching.                           *
+     *                                                                                             *
+     *          mask     -- Prebuilt mask of object RTTI types acceptable for scanning.            *
+     *                                                                                             *
+     *          cell     -- The cell at the center of the rings.                                   *
+     *                                                                                             *
+     *          inner    -- The innermost ring to examine (zero is the center cell).               *
+     *                                                                                             *
+     *          outer    -- The outermost ring to examine.                                         *
+     *                                                                                             *
+     *          range    -- Scan range limit to pass on to Evaluate_Cell().                        *
+     *                                                                                             *
+     *          zone     -- The zone restriction if any. A -1 means no zone check required.        *
+     *                                                                                             *
+     *          bestval  -- The value a target must exceed to be picked.                           *
+     *                                                                                             *
+     * OUTPUT:  Returns with the target object picked. If there is none, then NULL is returned.    *
+     *                                                                                             *
+     * WARNINGS:   Evaluate_Cell() must not change any state, since the cells are not examined in  *
+     *             ring order.                                                                     *
+     *=============================================================================================*/
+    TechnoClass const* TechnoClass::Evaluate_Buckets(
+        ThreatType method, int mask, CELL cell, int inner, int outer, int range, int zone, int bestval) const
+    {
+        int cx = Cell_X(cell);
+        int cy = Cell_Y(cell);
+        int x1 = max(cx - outer, Map.MapCellX);
+        int y1 = max(cy - outer, Map.MapCellY);
+        int x2 = min(cx + outer, Map.MapCellX + Map.MapCellWidth - 1);
+        int y2 = min(cy + outer, Map.MapCellY + Map.MapCellHeight - 1);
+
+        /*
+        **	Medics only target allies and everyone else only targets non-allies, so buckets
+        **	holding nothing of the other kind can be skipped.
+        */
+        bool medic = Combat_Damage() < 0;
+        unsigned houses = 0;
+        for (HousesType house = HOUSE_FIRST; house < HOUSE_COUNT; house++) {
+            if (House->Is_Ally(house) == medic) {
+                houses |= (1U << house);
+            }
+        }
+
+        TechnoClass const* best = NULL;
+        int bestorder = -1;
+
+        for (int by = y1 / BUCKET_SIZE; by <= y2 / BUCKET_SIZE; by++) {
+            for (int bx = x1 / BUCKET_SIZE; bx <= x2 / BUCKET_SIZE; bx++) {
+                if (!(Map.Threat_Houses(XY_Cell(bx * BUCKET_SIZE, by * BUCKET_SIZE)) & houses)) {
+                    continue;
+                }
+
+                int ystart = max(by * BUCKET_SIZE, y1);
+                int yend = min(by * BUCKET_SIZE + BUCKET_SIZE - 1, y2);
+                int xstart = max(bx * BUCKET_SIZE, x1);
+                int xend = min(bx * BUCKET_SIZE + BUCKET_SIZE - 1, x2);
+
+                for (int y = ystart; y <= yend; y++) {
+                    for (int x = xstart; x <= xend; x++) {
+                        int dx = x - cx;
+                        int dy = y - cy;
+                        int radius = max(abs(dx), abs(dy));
+                        if (radius < inner) {
+                            continue;
+                        }
+
+                        /*
+                        **	Work out when the ring scan would examine this cell. Each ring scans the
+                        **	top and bottom rows in pairs from left to right, and then the left and
+                        **	right columns in pairs from top to bottom.
+                        */
+                        int order;
+                        if (abs(dy) == radius) {
+                            order = (dx + radius) * 2 + ((radius > 0 && dy == radius) ? 1 : 0);
+                        } else {
+                            order = (radius * 2 + 1) * 2 + (dy + radius - 1) * 2 + ((dx == radius) ? 1 : 0);
+                        }
+                        order |= (radius << 16);
+                        if (order < bestorder) {
+                            continue;
+                        }
+
+                        TechnoClass const* object;
+                        int value;
+                        if (Evaluate_Cell(method, mask, XY_Cell(x, y), range, &object, value, zone) && bestval < value) {
+                            best = object;
+                            bestorder = order;
+                        }
+                    }
+                }
+            }
+        }
+        return (best);
+    }
+
     bool TechnoClass::Is_Cloaked(HousesType house, bool check_invisible) const
     {
         const bool is_invisible = check_invisible && Techno_Type_Class()->IsInvisible;
@@ -2214,6 +2335,13 @@ bool TechnoClass::Evaluate_Object(ThreatType method,
                 for (int index = 0; index < Aircraft.Count(); index++) {
                     TechnoClass* object = Aircraft.Ptr(index);
 
+                    /*
+                    **	Evaluate_Object() would reject an aircraft that is out of range anyway.
+                    */
+                    if (range > 0 && Distance(object) > range) {
+                        continue;
+                    }
+
                     int value = 0;
                     if (object->In_Which_Layer() != LAYER_GROUND
                         && Evaluate_Object(method, mask, range, object, value)) {
@@ -2234,6 +2362,40 @@ bool TechnoClass::Evaluate_Object(ThreatType method,
                 mask |= (1 << RTTI_AIRCRAFT);
             }
 
+            /*
+            **	Unless this object could pick a wall as a target (these are the cell independent
+            **	checks of Evaluate_Just_Cell), only the cells in buckets that hold objects of
+            **	interest need be examined. The ring scan below stops at the first ring holding a
+            **	target at a quarter, a half and the whole of the range. The bucket scan covers
+            **	the same three stages and picks the cell the ring scan would have seen last.
+            */
+            WeaponTypeClass const* weapon = Techno_Type_Class()->PrimaryWeapon;
+            bool walls = What_Am_I() != RTTI_VESSEL && !House->IsHuman && Rule.Diff[House->Difficulty].IsWallDestroyer
+                         && weapon != NULL && weapon->WarheadPtr != NULL && weapon->WarheadPtr->IsWallDestroyer
+                         && (weapon->Bullet == NULL || weapon->Bullet->IsAntiGround);
+            if (!walls) {
+                if (crange > 0) {
+                    int quarter = crange / 4;
+                    int half = crange / 2;
+                    TechnoClass const* found = Evaluate_Buckets(method, mask, cell, 0, quarter, range, zone, bestval);
+                    if (found != NULL) {
+                        bestobject = found;
+                    }
+                    if (bestobject == NULL && half > quarter) {
+                        bestobject = Evaluate_Buckets(method, mask, cell, quarter + 1, half, range, zone, bestval);
+                    }
+                    if (bestobject == NULL && crange - 1 > half) {
+                        bestobject = Evaluate_Buckets(method, mask, cell, half + 1, crange - 1, range, zone, bestval);
+                    }
+                }
+
+                BEnd(BENCH_GREATEST_THREAT);
+                if (bestobject != NULL) {
+                    return (bestobject->As_Target());
+                }
+                return (TARGET_NONE);
+            }
+
             /*
             **	Radiate outward from the object's location, looking for the best
             **	target.
@@ -2345,13 +2507,16 @@ bool TechnoClass::Evaluate_Object(ThreatType method,
                 */
                 if (bestobject != NULL) {
                     if (radius == crange / 4) {
+                        BEnd(BENCH_GREATEST_THREAT);
                         return (bestobject->As_Target());
                     }
                     if (radius == crange / 2) {
+                        BEnd(BENCH_GREATEST_THREAT);
                         return (bestobject->As_Target());
                     }
                 }
                 if (bestcell != -1) {
+                    BEnd(BENCH_GREATEST_THREAT);
                     return (::As_Target(bestcell));
                 }
             }
@@ -4056,6 +4221,7 @@ bool TechnoClass::Evaluate_Object(ThreatType method,
             /*
             **	Change ownership now.
             */
+            Map.Threat_Owner(this, newowner->Class->House);
             House = newowner;
             IsOwnedByPlayer = (House == PlayerPtr);
 
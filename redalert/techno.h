@@ -281,10 +281,7 @@ public:
         , PrimaryFacing(x)
         , Arm(x){};
 #endif
-    virtual ~TechnoClass(void)
-    {
-        House = 0;
-    };
+    virtual ~TechnoClass(void);
 
     /*
     **	Query functions.
@@ -383,6 +380,8 @@ public:
     bool
     Evaluate_Object(ThreatType method, int mask, int range, TechnoClass const* object, int& value, int zone = -1) const;
     int Evaluate_Just_Cell(CELL cell) const;
+    TechnoClass const* Evaluate_Buckets(
+        ThreatType method, int mask, CELL cell, int inner, int outer, int range, int zone, int bestval) const;
     virtual bool Electric_Zap(COORDINATE target_coord,
                               int which,
                               WindowNumberType window,
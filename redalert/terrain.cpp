@@ -502,9 +502,14 @@ void TerrainClass::AI(void)
         **	last stage of the crumbling animation, delete the terrain object.
         */
         if (IsCrumbling && Fetch_Stage() == Get_Build_Frame_Count(Class->Get_Image_Data()) - 1) {
+            CELL cell = Coord_Cell(Coord);
+            short const* offset = Occupy_List();
+
             delete this;
 
-            Map.Zone_Reset(MZONEF_NORMAL | MZONEF_CRUSHER | MZONEF_DESTROYER);
+            while (*offset != REFRESH_EOL) {
+                Map.Zone_Change(cell + *offset++, MZONEF_NORMAL | MZONEF_CRUSHER | MZONEF_DESTROYER);
+            }
         }
     }
 }
@@ -155,12 +155,7 @@ TriggerClass::TriggerClass(TriggerTypeClass* trigtype)
 TriggerClass::~TriggerClass(void)
 {
     if (GameActive && Class.Is_Valid() && (Class->Attaches_To() & ATTACH_GENERAL) != 0) {
-        if (LogicTriggerID >= LogicTriggers.ID(this)) {
-            LogicTriggerID--;
-            if (LogicTriggerID < 0 && LogicTriggers.Count() == 0) {
-                LogicTriggerID = 0;
-            }
-        }
+        Logic.Trigger_Deleted();
     }
 
     if (GameActive && Class.Is_Valid() && (Class->Attaches_To() & ATTACH_MAP) != 0) {
@@ -227,6 +222,12 @@ bool TriggerClass::Spring(TEventType event, ObjectClass* obj, CELL cell, bool fo
 {
     assert(Triggers.ID(this) == ID);
 
+    /*
+    **	The event state may change from here on, so make sure the logic loop takes
+    **	another look at this trigger.
+    */
+    Logic.Wake_Trigger(this);
+
     bool e1 = Class->Event1(Event1, event, Class->House, obj, forced);
     bool e2 = false;
     bool execute = false;
@@ -0,0 +1,149 @@
+#include "common/dirtyrect.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+enum
+{
+    TEST_WIDTH = 320,
+    TEST_HEIGHT = 200,
+    TEST_PITCH = 336
+};
+
+static unsigned char Surface[TEST_PITCH * TEST_HEIGHT];
+static unsigned char Presented[TEST_PITCH * TEST_HEIGHT];
+
+static uint32_t Test_Random(uint32_t& seed, unsigned range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) % range);
+}
+
+/*
+**	Copies the rects found onto the presented image, as converting them would, and checks
+**	that the result matches the surface.
+*/
+static int Present(DirtyRectClass& dirty, char const* what)
+{
+    int count = dirty.Find(Surface, TEST_PITCH);
+
+    if (count > DirtyRectClass::MAX_RECTS) {
+        fprintf(stderr, "DirtyRectClass found %d rects %s\n", count, what);
+        return 1;
+    }
+
+    for (int index = 0; index < count; index++) {
+        Rect const& rect = dirty.Get_Rect(index);
+        if (rect.X < 0 || rect.Y < 0 || rect.X + rect.Width > TEST_WIDTH || rect.Y + rect.Height > TEST_HEIGHT) {
+            fprintf(stderr, "DirtyRectClass found a rect outside the surface %s\n", what);
+            return 1;
+        }
+        for (int y = rect.Y; y < rect.Y + rect.Height; y++) {
+            memcpy(Presented + y * TEST_PITCH + rect.X, Surface + y * TEST_PITCH + rect.X, rect.Width);
+        }
+    }
+
+    for (int y = 0; y < TEST_HEIGHT; y++) {
+        if (memcmp(Presented + y * TEST_PITCH, Surface + y * TEST_PITCH, TEST_WIDTH) != 0) {
+            fprintf(stderr, "DirtyRectClass missed a change on row %d %s\n", y, what);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+int test_dirtyrect(void)
+{
+    DirtyRectClass dirty;
+    uint32_t seed = 1;
+    int ret = 0;
+
+    memset(Surface, 0x11, sizeof(Surface));
+    memset(Presented, 0, sizeof(Presented));
+
+    if (!dirty.Init(TEST_WIDTH, TEST_HEIGHT)) {
+        fprintf(stderr, "DirtyRectClass failed to allocate\n");
+        return 1;
+    }
+
+    ret |= Present(dirty, "on the first frame");
+    if (dirty.Get_Area() != TEST_WIDTH * TEST_HEIGHT) {
+        fprintf(stderr, "DirtyRectClass didn't give the whole surface on the first frame\n");
+        ret = 1;
+    }
+
+    /*
+    **	A still screen needs nothing.
+    */
+    dirty.Touch();
+    ret |= Present(dirty, "on a still screen");
+    if (dirty.Get_Count() != 0) {
+        fprintf(stderr, "DirtyRectClass found %d rects on a still screen\n", dirty.Get_Count());
+        ret = 1;
+    }
+
+    /*
+    **	Two small changes far apart, like a sidebar digit and the radar, give two small rects.
+    */
+    Surface[20 * TEST_PITCH + 300] = 0x22;
+    Surface[21 * TEST_PITCH + 305] = 0x22;
+    Surface[150 * TEST_PITCH + 10] = 0x33;
+    dirty.Touch();
+    ret |= Present(dirty, "for two small changes");
+    if (dirty.Get_Count() != 2 || dirty.Get_Area() != 12 + 1) {
+        fprintf(stderr,
+                "DirtyRectClass found %d rects of %d pixels for two small changes\n",
+                dirty.Get_Count(),
+                dirty.Get_Area());
+        ret = 1;
+    }
+
+    /*
+    **	Rects added directly are given even without a touch, and aren't compared.
+    */
+    dirty.Add(Rect(-10, 190, 20, 30));
+    ret |= Present(dirty, "for an added rect");
+    if (dirty.Get_Count() != 1 || dirty.Get_Area() != 10 * 10) {
+        fprintf(stderr, "DirtyRectClass didn't clip an added rect\n");
+        ret = 1;
+    }
+
+    /*
+    **	Changes scattered all over still come out as no more than MAX_RECTS rects.
+    */
+    for (int index = 0; index < 500; index++) {
+        Surface[Test_Random(seed, TEST_HEIGHT) * TEST_PITCH + Test_Random(seed, TEST_WIDTH)] += 1;
+    }
+    dirty.Touch();
+    ret |= Present(dirty, "for scattered changes");
+
+    /*
+    **	A palette change needs everything.
+    */
+    dirty.Add_All();
+    ret |= Present(dirty, "after Add_All");
+    if (dirty.Get_Area() != TEST_WIDTH * TEST_HEIGHT) {
+        fprintf(stderr, "DirtyRectClass didn't give the whole surface after Add_All\n");
+        ret = 1;
+    }
+
+    /*
+    **	Scrolling changes most rows; every change must still be found.
+    */
+    for (int frame = 0; frame < 10; frame++) {
+        for (int y = 0; y < TEST_HEIGHT; y++) {
+            for (int x = 0; x < TEST_WIDTH - 80; x++) {
+                Surface[y * TEST_PITCH + x] = Test_Random(seed, 256);
+            }
+        }
+        dirty.Touch();
+        ret |= Present(dirty, "while scrolling");
+    }
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    return test_dirtyrect();
+}
@@ -0,0 +1,183 @@
+#include "common/framepace.h"
+
+#include <stdio.h>
+
+typedef FramePacerClass::ClockType ClockType;
+
+static ClockType::time_point Test_Time(ClockType::time_point base, int microseconds)
+{
+    return (base + std::chrono::microseconds(microseconds));
+}
+
+/*
+**	A late frame is made up for by the next one, and only falling a whole frame behind
+**	starts the pacing afresh.
+*/
+int test_framepace_deadlines(void)
+{
+    FramePacerClass pacer;
+    ClockType::time_point base = ClockType::now();
+    int ret = 0;
+
+    pacer.Set_Rate(100);
+
+    pacer.Next_Frame(base);
+    if (pacer.Get_Deadline() != Test_Time(base, 10000)) {
+        fprintf(stderr, "FramePacerClass didn't start from the first frame\n");
+        ret = 1;
+    }
+
+    if (pacer.Is_Due(Test_Time(base, 9999)) || !pacer.Is_Due(Test_Time(base, 10000))) {
+        fprintf(stderr, "FramePacerClass gave a frame as due at the wrong time\n");
+        ret = 1;
+    }
+
+    pacer.Next_Frame(Test_Time(base, 11000));
+    if (pacer.Get_Deadline() != Test_Time(base, 20000)) {
+        fprintf(stderr, "FramePacerClass let a late frame push the next one back\n");
+        ret = 1;
+    }
+
+    pacer.Next_Frame(Test_Time(base, 45000));
+    if (pacer.Get_Deadline() != Test_Time(base, 55000)) {
+        fprintf(stderr, "FramePacerClass didn't start again after falling behind\n");
+        ret = 1;
+    }
+
+    pacer.Set_Rate(0);
+    if (!pacer.Is_Due(base)) {
+        fprintf(stderr, "FramePacerClass held back a frame without a limit\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+/*
+**	At a rate that doesn't divide a second into whole microseconds the deadlines must not
+**	drift from where they should be.
+*/
+int test_framepace_drift(void)
+{
+    enum
+    {
+        TEST_RATE = 144,
+        TEST_FRAMES = 14400
+    };
+
+    FramePacerClass pacer;
+    ClockType::time_point base = ClockType::now();
+
+    pacer.Set_Rate(TEST_RATE);
+    pacer.Next_Frame(base);
+
+    for (int frame = 1; frame < TEST_FRAMES; frame++) {
+        pacer.Next_Frame(pacer.Get_Deadline());
+    }
+
+    auto expected = base + std::chrono::nanoseconds((long long)TEST_FRAMES * 1000000000 / TEST_RATE);
+    auto error = std::chrono::duration_cast<std::chrono::microseconds>(pacer.Get_Deadline() - expected).count();
+
+    if (error < -100 || error > 100) {
+        fprintf(stderr, "FramePacerClass drifted %d us over %d frames\n", (int)error, (int)TEST_FRAMES);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+**	Sleep_Until must never wake early. How late it wakes depends on the machine, so it is
+**	only reported, except for something far off.
+*/
+int test_framepace_sleep(void)
+{
+    enum
+    {
+        TEST_SLEEPS = 20,
+        TEST_SLEEP = 5000
+    };
+
+    long long late = 0;
+    long long worst = 0;
+
+    for (int index = 0; index < TEST_SLEEPS; index++) {
+        auto when = ClockType::now() + std::chrono::microseconds(TEST_SLEEP);
+
+        FramePacerClass::Sleep_Until(when);
+
+        auto overshoot = std::chrono::duration_cast<std::chrono::microseconds>(ClockType::now() - when).count();
+        if (overshoot < 0) {
+            fprintf(stderr, "FramePacerClass::Sleep_Until woke %d us early\n", (int)-overshoot);
+            return 1;
+        }
+        late += overshoot;
+        worst = overshoot > worst ? overshoot : worst;
+    }
+
+    printf("FramePacerClass::Sleep_Until: %d us late on average, %d us at worst\n",
+           (int)(late / TEST_SLEEPS),
+           (int)worst);
+
+    if (worst > 50000) {
+        fprintf(stderr, "FramePacerClass::Sleep_Until woke far too late\n");
+        return 1;
+    }
+    return 0;
+}
+
+/*
+**	The fraction follows the time between the last two ticks, and nothing is blended until
+**	there are two ticks to go by or after a gap too long to be the tick rate.
+*/
+int test_framepace_fraction(void)
+{
+    TickFractionClass fraction;
+    ClockType::time_point base = ClockType::now();
+    int ret = 0;
+
+    fraction.Tick(base);
+    if (fraction.Get_Fraction(Test_Time(base, 1000)) != TickFractionClass::FRACTION_ONE) {
+        fprintf(stderr, "TickFractionClass blended before knowing the tick rate\n");
+        ret = 1;
+    }
+
+    fraction.Tick(Test_Time(base, 40000));
+    if (fraction.Get_Fraction(Test_Time(base, 40000)) != 0
+        || fraction.Get_Fraction(Test_Time(base, 50000)) != TickFractionClass::FRACTION_ONE / 4
+        || fraction.Get_Fraction(Test_Time(base, 60000)) != TickFractionClass::FRACTION_ONE / 2
+        || fraction.Get_Fraction(Test_Time(base, 90000)) != TickFractionClass::FRACTION_ONE) {
+        fprintf(stderr, "TickFractionClass gave the wrong fraction between ticks\n");
+        ret = 1;
+    }
+
+    fraction.Tick(Test_Time(base, 1040000));
+    if (fraction.Get_Fraction(Test_Time(base, 1050000)) != TickFractionClass::FRACTION_ONE) {
+        fprintf(stderr, "TickFractionClass took a pause for the tick rate\n");
+        ret = 1;
+    }
+
+    fraction.Tick(Test_Time(base, 1060000));
+    if (fraction.Get_Fraction(Test_Time(base, 1070000)) != TickFractionClass::FRACTION_ONE / 2) {
+        fprintf(stderr, "TickFractionClass didn't settle again after a pause\n");
+        ret = 1;
+    }
+
+    fraction.Reset();
+    fraction.Tick(Test_Time(base, 1080000));
+    if (fraction.Get_Fraction(Test_Time(base, 1090000)) != TickFractionClass::FRACTION_ONE) {
+        fprintf(stderr, "TickFractionClass blended after a reset\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_framepace_deadlines();
+    ret |= test_framepace_drift();
+    ret |= test_framepace_sleep();
+    ret |= test_framepace_fraction();
+
+    return ret;
+}
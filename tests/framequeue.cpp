@@ -0,0 +1,255 @@
+#include "common/framequeue.h"
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+**	A cut down copy of the parts of EventClass that the DoList works with.
+*/
+struct TestEvent
+{
+    unsigned Frame : 26;
+    unsigned ID : 5;
+    unsigned IsExecuted : 1;
+    unsigned IsFrameInfo : 1;
+    unsigned Tag;
+};
+
+enum
+{
+    TEST_HOUSES = 8,
+    TEST_FRAMES = 3000,
+    TEST_SIZE = 4096
+};
+
+static QueueClass<TestEvent, TEST_SIZE> ScanList;
+static FrameQueueClass<TestEvent, TEST_SIZE, 256, 32> BucketList;
+
+static unsigned Test_Random(uint32_t& seed, unsigned range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) % range);
+}
+
+static int Can_Delay(TestEvent const& event)
+{
+    return (!event.IsFrameInfo);
+}
+
+static void Record(uint32_t& hash, unsigned frame, TestEvent const& event)
+{
+    hash = (hash ^ frame) * 16777619U;
+    hash = (hash ^ event.Tag) * 16777619U;
+}
+
+/*
+**	Everything that happens on one frame of the replay; the same for both lists.
+*/
+struct TestFrame
+{
+    unsigned Frame;
+    int Adds;
+    TestEvent Events[8];
+    int IsHuman[TEST_HOUSES];
+    unsigned DelayFrom;
+    unsigned DelayTo;
+    int Budget;
+};
+
+static void Make_Frame(uint32_t& seed, unsigned& tag, TestFrame& frame)
+{
+    frame.Adds = Test_Random(seed, 8);
+    for (int index = 0; index < frame.Adds; index++) {
+        TestEvent& event = frame.Events[index];
+        event.ID = Test_Random(seed, TEST_HOUSES);
+        event.IsExecuted = 0;
+        event.IsFrameInfo = Test_Random(seed, 4) == 0;
+        event.Tag = tag++;
+
+        /*
+        **	Mostly a little ahead, as MaxAhead schedules them; some late, some far enough
+        **	ahead to share a bucket with a nearer frame.
+        */
+        switch (Test_Random(seed, 20)) {
+        case 0:
+            event.Frame = frame.Frame - Test_Random(seed, 3);
+            break;
+
+        case 1:
+            event.Frame = frame.Frame + 256 + Test_Random(seed, 300);
+            break;
+
+        default:
+            event.Frame = frame.Frame + Test_Random(seed, 40);
+            break;
+        }
+    }
+
+    /*
+    **	Now and then a house stops taking part, leaving its events behind, or comes back.
+    */
+    if (Test_Random(seed, 50) == 0) {
+        int house = Test_Random(seed, TEST_HOUSES);
+        frame.IsHuman[house] = !frame.IsHuman[house];
+    }
+
+    /*
+    **	A TIMING event opens a new period of vulnerability.
+    */
+    if (Test_Random(seed, 100) == 0) {
+        frame.DelayFrom = frame.Frame;
+        frame.DelayTo = frame.Frame + 5 + Test_Random(seed, 40);
+    }
+
+    /*
+    **	An out of sync prompt stops execution part way through the frame.
+    */
+    frame.Budget = (Test_Random(seed, 70) == 0) ? (int)Test_Random(seed, 5) : -1;
+}
+
+/*
+**	The original Execute_DoList: a scan of the whole list for every house.
+*/
+static void Execute_Scan(TestFrame const& frame, uint32_t& hash)
+{
+    int budget = frame.Budget;
+
+    for (int j = 0; j < ScanList.Count; j++) {
+        if (!ScanList[j].IsFrameInfo && ScanList[j].Frame > frame.DelayFrom && ScanList[j].Frame < frame.DelayTo) {
+            ScanList[j].Frame = frame.DelayTo;
+        }
+    }
+
+    for (int house = 0; house < TEST_HOUSES; house++) {
+        if (!frame.IsHuman[house]) {
+            continue;
+        }
+        for (int j = 0; j < ScanList.Count; j++) {
+            if (ScanList[j].ID == (unsigned)house && frame.Frame >= ScanList[j].Frame && !ScanList[j].IsExecuted) {
+                if (budget-- == 0) {
+                    return;
+                }
+                Record(hash, frame.Frame, ScanList[j]);
+                ScanList[j].IsExecuted = 1;
+            }
+        }
+    }
+}
+
+/*
+**	The same, visiting only the events due for each house.
+*/
+static void Execute_Bucket(TestFrame const& frame, uint32_t& hash)
+{
+    int budget = frame.Budget;
+
+    BucketList.Delay(frame.DelayFrom, frame.DelayTo, Can_Delay);
+    BucketList.Advance(frame.Frame);
+
+    for (int house = 0; house < TEST_HOUSES; house++) {
+        if (!frame.IsHuman[house]) {
+            continue;
+        }
+        int next;
+        for (int slot = BucketList.First_Due(house); slot != -1; slot = next) {
+            next = BucketList.Next_Due(slot);
+            int j = BucketList.Position(slot);
+            if (BucketList[j].ID == (unsigned)house && frame.Frame >= BucketList[j].Frame
+                && !BucketList[j].IsExecuted) {
+                if (budget-- == 0) {
+                    return;
+                }
+                Record(hash, frame.Frame, BucketList[j]);
+                BucketList[j].IsExecuted = 1;
+                BucketList.Retire(slot);
+            }
+        }
+    }
+}
+
+template <class Q> static void Clean(Q& list, unsigned frame)
+{
+    while (list.Count && (list.First().IsExecuted || frame > list.First().Frame)) {
+        list.Next();
+    }
+}
+
+/*
+**	Replays the same stream of events through both lists and checks that every event is
+**	executed on the same frame and in the same order, which is what keeps the game CRC
+**	identical.
+*/
+int test_frame_queue(uint32_t start)
+{
+    uint32_t seed = start;
+    static TestFrame frame;
+    unsigned tag = 0;
+    uint32_t scanhash = 2166136261U;
+    uint32_t buckethash = 2166136261U;
+    int executed = 0;
+
+    ScanList.Init();
+    BucketList.Init();
+
+    frame.Frame = 0;
+    frame.DelayFrom = 0;
+    frame.DelayTo = 0;
+    for (int house = 0; house < TEST_HOUSES; house++) {
+        frame.IsHuman[house] = 1;
+    }
+
+    for (int count = 0; count < TEST_FRAMES; count++) {
+        Make_Frame(seed, tag, frame);
+
+        for (int index = 0; index < frame.Adds; index++) {
+            ScanList.Add(frame.Events[index]);
+            BucketList.Add(frame.Events[index]);
+        }
+
+        uint32_t before = scanhash;
+        Execute_Scan(frame, scanhash);
+        Execute_Bucket(frame, buckethash);
+        executed += before != scanhash;
+
+        if (scanhash != buckethash) {
+            fprintf(stderr, "FrameQueueClass(%08x) executed differently on frame %u\n", start, frame.Frame);
+            return 1;
+        }
+
+        Clean(ScanList, frame.Frame);
+        Clean(BucketList, frame.Frame);
+        if (ScanList.Count != BucketList.Count) {
+            fprintf(stderr, "FrameQueueClass(%08x) kept %d events, expected %d\n", start, BucketList.Count, ScanList.Count);
+            return 1;
+        }
+
+        /*
+        **	Mostly one frame at a time, but loading a game can move the frame anywhere.
+        */
+        if (count == TEST_FRAMES / 2) {
+            frame.Frame += 400;
+        } else if (count == TEST_FRAMES * 3 / 4) {
+            frame.Frame -= 100;
+        } else {
+            frame.Frame++;
+        }
+    }
+
+    if (executed < TEST_FRAMES / 2) {
+        fprintf(stderr, "FrameQueueClass(%08x) only executed events on %d frames\n", start, executed);
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_frame_queue(1);
+    ret |= test_frame_queue(0x1234);
+    ret |= test_frame_queue(0xdeadbeef);
+
+    return ret;
+}
@@ -0,0 +1,151 @@
+#include "common/framestats.h"
+
+#include <stdio.h>
+#include <thread>
+
+enum
+{
+    TEST_FRAMES = 10000
+};
+
+/*
+**	Frames are added by a thread of their own while they're read, as the presentation thread
+**	does, and every one must be counted exactly once across the resets.
+*/
+int test_framestats_threaded(void)
+{
+    FrameStatsClass stats;
+    int frames = 0;
+    int dropped = 0;
+
+    std::thread thread([&stats] {
+        for (int index = 1; index <= TEST_FRAMES; index++) {
+            stats.Add(index % 100);
+            if (index % 10 == 0) {
+                stats.Drop();
+            }
+        }
+    });
+
+    for (int index = 0; index < 1000; index++) {
+        FrameStatsType taken = stats.Get(true);
+        frames += taken.Frames;
+        dropped += taken.Dropped;
+    }
+    thread.join();
+
+    FrameStatsType taken = stats.Get(true);
+    frames += taken.Frames;
+    dropped += taken.Dropped;
+
+    if (frames != TEST_FRAMES || dropped != TEST_FRAMES / 10) {
+        fprintf(stderr, "FrameStatsClass counted %d frames and %d dropped\n", frames, dropped);
+        return 1;
+    }
+    return 0;
+}
+
+int test_framestats(void)
+{
+    FrameStatsClass stats;
+    int ret = 0;
+
+    FrameStatsType empty = stats.Get();
+    if (empty.Frames != 0 || empty.Average != 0 || empty.Worst != 0) {
+        fprintf(stderr, "FrameStatsClass didn't start empty\n");
+        ret = 1;
+    }
+
+    stats.Add(1000);
+    stats.Add(3000);
+    stats.Add(2000);
+    stats.Drop();
+
+    FrameStatsType summary = stats.Get();
+    if (summary.Frames != 3 || summary.Dropped != 1 || summary.Average != 2000 || summary.Worst != 3000
+        || summary.Last != 2000) {
+        fprintf(stderr,
+                "FrameStatsClass gave %d frames, %d dropped, %d average, %d worst, %d last\n",
+                summary.Frames,
+                summary.Dropped,
+                summary.Average,
+                summary.Worst,
+                summary.Last);
+        ret = 1;
+    }
+
+    /*
+    **	Getting without a reset leaves everything in place.
+    */
+    if (stats.Get(true).Frames != 3) {
+        fprintf(stderr, "FrameStatsClass lost frames on a plain Get\n");
+        ret = 1;
+    }
+
+    stats.Add(500);
+    summary = stats.Get();
+    if (summary.Frames != 1 || summary.Dropped != 0 || summary.Average != 500 || summary.Worst != 500) {
+        fprintf(stderr, "FrameStatsClass kept frames over a reset\n");
+        ret = 1;
+    }
+
+    ret |= test_framestats_threaded();
+    return ret;
+}
+
+/*
+**	Only the last HISTORY frames count, and percentiles are given to the bucket.
+*/
+int test_framehistogram(void)
+{
+    FrameHistogramClass histogram;
+    int ret = 0;
+
+    for (int index = 0; index < FrameHistogramClass::HISTORY; index++) {
+        histogram.Add(index < FrameHistogramClass::HISTORY / 10 ? 20200 : 8100);
+    }
+
+    if (histogram.Get_Frames() != FrameHistogramClass::HISTORY || histogram.Get_Percentile(50) != 8500
+        || histogram.Get_Percentile(95) != 20200 || histogram.Get_Worst() != 20200) {
+        fprintf(stderr,
+                "FrameHistogramClass gave 50%% %d, 95%% %d, worst %d\n",
+                histogram.Get_Percentile(50),
+                histogram.Get_Percentile(95),
+                histogram.Get_Worst());
+        ret = 1;
+    }
+
+    /*
+    **	The slow frames were the oldest, so a full history of new ones pushes them all out.
+    */
+    for (int index = 0; index < FrameHistogramClass::HISTORY; index++) {
+        histogram.Add(8100);
+    }
+
+    if (histogram.Get_Count(20200 / FrameHistogramClass::BUCKET_WIDTH) != 0 || histogram.Get_Worst() != 8100
+        || histogram.Get_Count(8100 / FrameHistogramClass::BUCKET_WIDTH) != FrameHistogramClass::HISTORY) {
+        fprintf(stderr, "FrameHistogramClass kept frames older than its history\n");
+        ret = 1;
+    }
+
+    /*
+    **	Anything too long for the buckets goes in the last.
+    */
+    histogram.Clear();
+    histogram.Add(1000000);
+    if (histogram.Get_Count(FrameHistogramClass::BUCKETS - 1) != 1 || histogram.Get_Percentile(99) != 1000000) {
+        fprintf(stderr, "FrameHistogramClass lost a long frame\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_framestats();
+    ret |= test_framehistogram();
+
+    return ret;
+}
@@ -1,7 +1,9 @@
 #include "common/lcw.h"
 
 #include <stdint.h>
+#include <stdlib.h>
 #include <string.h>
+#include <chrono>
 #include <iostream>
 
 int test_lcw()
@@ -26,11 +28,107 @@ int test_lcw()
     return ret;
 }
 
+/*
+**	Fills a buffer with data shaped like what gets compressed: a mix of repeated rows with a
+**	few changes, runs of one byte, and noise.
+*/
+static void Make_Data(unsigned char* data, unsigned length, uint32_t seed)
+{
+    unsigned pos = 0;
+
+    while (pos < length) {
+        seed = seed * 1103515245 + 12345;
+        unsigned count = 16 + ((seed >> 8) % 2000);
+        if (count > length - pos) {
+            count = length - pos;
+        }
+
+        switch ((seed >> 20) % 4) {
+        case 0:
+            memset(&data[pos], seed >> 24, count);
+            break;
+
+        case 1:
+            for (unsigned index = 0; index < count; index++) {
+                seed = seed * 1103515245 + 12345;
+                data[pos + index] = seed >> 24;
+            }
+            break;
+
+        default:
+            /*
+            **	A copy of something earlier, from anywhere up to a long way back.
+            */
+            if (pos > 0) {
+                seed = seed * 1103515245 + 12345;
+                unsigned from = (seed >> 8) % pos;
+                for (unsigned index = 0; index < count; index++) {
+                    data[pos + index] = data[from + index] ^ ((index % 97) == 0 ? 1 : 0);
+                }
+            } else {
+                memset(&data[pos], 0, count);
+            }
+            break;
+        }
+        pos += count;
+    }
+}
+
+/*
+**	Round trips generated data of sizes that need every command code, including data past the
+**	64k that absolute copies can reach, at each effort level. Also reports how fast each level
+**	compresses.
+*/
+int test_lcw_large()
+{
+    static const unsigned sizes[] = {0x10000, 0x40000, 0x100000};
+    static const int efforts[] = {LCW_EFFORT_FAST, LCW_EFFORT_NORMAL, LCW_EFFORT_BEST};
+    int ret = 0;
+
+    for (unsigned size_index = 0; size_index < sizeof(sizes) / sizeof(sizes[0]); size_index++) {
+        unsigned length = sizes[size_index];
+        unsigned char* data = (unsigned char*)malloc(length);
+        unsigned char* lcwbuff = (unsigned char*)malloc(length + length / 63 + 2);
+        unsigned char* decompbuff = (unsigned char*)malloc(length);
+
+        Make_Data(data, length, length);
+
+        for (unsigned effort_index = 0; effort_index < sizeof(efforts) / sizeof(efforts[0]); effort_index++) {
+            int effort = efforts[effort_index];
+
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            int complen = LCW_Comp(data, lcwbuff, length, effort);
+            std::chrono::duration<double> took = std::chrono::steady_clock::now() - start;
+
+            memset(decompbuff, 0, length);
+            int decomplen = LCW_Uncompress(lcwbuff, decompbuff, length);
+
+            if (decomplen != (int)length || memcmp(decompbuff, data, length) != 0) {
+                fprintf(stderr, "LCW_Comp(%u bytes, effort %d) did not generate the expected round trip data.\n", length, effort);
+                ret = 1;
+            }
+
+            printf("LCW_Comp %7u bytes, effort %5d: %7d bytes, %8.2f MB/s\n",
+                   length,
+                   effort,
+                   complen,
+                   took.count() > 0 ? length / took.count() / (1024 * 1024) : 0.0);
+        }
+
+        free(data);
+        free(lcwbuff);
+        free(decompbuff);
+    }
+
+    return ret;
+}
+
 int main(int argc, char** argv)
 {
     int ret = 0;
 
     ret |= test_lcw();
+    ret |= test_lcw_large();
 
     return ret;
 }
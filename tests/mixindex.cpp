@@ -0,0 +1,181 @@
+#include "common/mixindex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <chrono>
+
+/*
+**	The same layout as MixFileClass::SubBlock.
+*/
+struct TestBlock
+{
+    int32_t CRC;
+    int32_t Offset;
+    int32_t Size;
+};
+
+enum
+{
+    TEST_MIXFILES = 32,
+    TEST_FILES = 1500,
+    TEST_LOOKUPS = 200000
+};
+
+static TestBlock Blocks[TEST_MIXFILES][TEST_FILES];
+
+static uint32_t Test_Random(uint32_t& seed)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 16) | (seed << 16));
+}
+
+static int Compare_Block(void const* ptr1, void const* ptr2)
+{
+    int32_t crc1 = ((TestBlock const*)ptr1)->CRC;
+    int32_t crc2 = ((TestBlock const*)ptr2)->CRC;
+    return (crc1 < crc2) ? -1 : (crc1 > crc2);
+}
+
+/*
+**	The search that MixFileClass::Offset did before the index; a binary search in every
+**	mixfile in turn.
+*/
+static TestBlock const* Sweep_Find(int32_t crc, int* mixfile)
+{
+    TestBlock key;
+    key.CRC = crc;
+    for (int index = 0; index < TEST_MIXFILES; index++) {
+        TestBlock const* block =
+            (TestBlock const*)bsearch(&key, Blocks[index], TEST_FILES, sizeof(TestBlock), Compare_Block);
+        if (block != NULL) {
+            *mixfile = index;
+            return (block);
+        }
+    }
+    return (NULL);
+}
+
+/*
+**	Builds mixfiles where some files appear in more than one, as when a mod overrides the
+**	originals, and checks that the index finds the same entry as the search for every one of
+**	them and for names that aren't there.
+*/
+int test_mix_index(uint32_t seed)
+{
+    MixIndexClass index;
+
+    for (int mix = 0; mix < TEST_MIXFILES; mix++) {
+        for (int file = 0; file < TEST_FILES; file++) {
+            TestBlock& block = Blocks[mix][file];
+            if (mix > 0 && (Test_Random(seed) % 10) == 0) {
+                block.CRC = Blocks[Test_Random(seed) % mix][Test_Random(seed) % TEST_FILES].CRC;
+            } else {
+                block.CRC = (int32_t)Test_Random(seed);
+            }
+            block.Offset = file * 100;
+            block.Size = mix;
+        }
+        qsort(Blocks[mix], TEST_FILES, sizeof(TestBlock), Compare_Block);
+        for (int file = 0; file < TEST_FILES; file++) {
+            index.Add(Blocks[mix][file].CRC, Blocks[mix], &Blocks[mix][file]);
+        }
+    }
+
+    for (int mix = 0; mix < TEST_MIXFILES; mix++) {
+        for (int file = 0; file < TEST_FILES; file++) {
+            int32_t crc = Blocks[mix][file].CRC;
+            int expected_mix = -1;
+            TestBlock const* expected = Sweep_Find(crc, &expected_mix);
+
+            void const* owner = NULL;
+            TestBlock const* block = (TestBlock const*)index.Find(crc, &owner);
+
+            if (block == NULL || owner != Blocks[expected_mix] || block->CRC != crc
+                || block->Offset != expected->Offset) {
+                fprintf(stderr, "MixIndexClass(%08x) found the wrong entry for %08x\n", seed, (unsigned)crc);
+                return 1;
+            }
+        }
+    }
+
+    for (int count = 0; count < 1000; count++) {
+        int32_t crc = (int32_t)Test_Random(seed);
+        int mix;
+        if (Sweep_Find(crc, &mix) == NULL && index.Find(crc, NULL) != NULL) {
+            fprintf(stderr, "MixIndexClass(%08x) found %08x, which was never added\n", seed, (unsigned)crc);
+            return 1;
+        }
+    }
+
+    index.Clear();
+    if (index.Count() != 0 || index.Find(Blocks[0][0].CRC, NULL) != NULL) {
+        fprintf(stderr, "MixIndexClass(%08x) still finds entries after Clear()\n", seed);
+        return 1;
+    }
+
+    return 0;
+}
+
+/*
+**	Reports lookups per second for the index and for the old search, over the names loaded
+**	at startup: mostly files that exist, spread over all the mixfiles, with some misses from
+**	checking for optional files.
+*/
+int test_mix_index_speed(void)
+{
+    MixIndexClass index;
+    static int32_t names[TEST_LOOKUPS];
+    uint32_t seed = 0x5eed;
+    int found = 0;
+
+    for (int mix = 0; mix < TEST_MIXFILES; mix++) {
+        for (int file = 0; file < TEST_FILES; file++) {
+            index.Add(Blocks[mix][file].CRC, Blocks[mix], &Blocks[mix][file]);
+        }
+    }
+    for (int count = 0; count < TEST_LOOKUPS; count++) {
+        if ((Test_Random(seed) % 8) == 0) {
+            names[count] = (int32_t)Test_Random(seed);
+        } else {
+            names[count] = Blocks[Test_Random(seed) % TEST_MIXFILES][Test_Random(seed) % TEST_FILES].CRC;
+        }
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int count = 0; count < TEST_LOOKUPS; count++) {
+        found += index.Find(names[count], NULL) != NULL;
+    }
+    std::chrono::duration<double> indexed = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int count = 0; count < TEST_LOOKUPS; count++) {
+        int mix;
+        found -= Sweep_Find(names[count], &mix) != NULL;
+    }
+    std::chrono::duration<double> swept = std::chrono::steady_clock::now() - start;
+
+    printf("MixIndexClass %d mixfiles of %d files: %.0f lookups/s indexed, %.0f lookups/s searched\n",
+           TEST_MIXFILES,
+           TEST_FILES,
+           indexed.count() > 0 ? TEST_LOOKUPS / indexed.count() : 0.0,
+           swept.count() > 0 ? TEST_LOOKUPS / swept.count() : 0.0);
+
+    if (found != 0) {
+        fprintf(stderr, "MixIndexClass found a different number of files than the search\n");
+        return 1;
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_mix_index(1);
+    ret |= test_mix_index(0xdeadbeef);
+    ret |= test_mix_index_speed();
+
+    return ret;
+}
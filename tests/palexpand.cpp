@@ -0,0 +1,152 @@
+#include "common/palexpand.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <chrono>
+#ifdef SDL2_BUILD
+#include <SDL.h>
+#endif
+
+enum
+{
+    TEST_REPEATS = 20
+};
+
+static uint32_t Test_Random(uint32_t& seed, unsigned range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) % range);
+}
+
+/*
+**	Every odd width and pitch, so the unrolled loops and their leftovers are all checked.
+*/
+int test_palexpand_match(uint32_t const* table)
+{
+    enum
+    {
+        MAX_WIDTH = 70,
+        HEIGHT = 3
+    };
+
+    static unsigned char src[(MAX_WIDTH + 5) * HEIGHT];
+    static uint32_t expect[(MAX_WIDTH + 3) * HEIGHT];
+    static uint32_t result[(MAX_WIDTH + 3) * HEIGHT];
+    uint32_t seed = 2;
+
+    for (unsigned index = 0; index < sizeof(src); index++) {
+        src[index] = Test_Random(seed, 256);
+    }
+
+    for (int width = 1; width <= MAX_WIDTH; width++) {
+        int src_pitch = width + 5;
+        int dst_pitch = (width + 3) * 4;
+
+        memset(expect, 0xAA, sizeof(expect));
+        memset(result, 0xAA, sizeof(result));
+        Palette_Expand_Scalar(table, src, src_pitch, expect, dst_pitch, width, HEIGHT);
+        Palette_Expand(table, src, src_pitch, result, dst_pitch, width, HEIGHT);
+
+        if (memcmp(expect, result, sizeof(result)) != 0) {
+            fprintf(stderr, "Palette_Expand (%s) differs at width %d\n", Palette_Expand_Kernel(), width);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+**	Times each version on a frame of the size given, in microseconds per frame.
+*/
+int test_palexpand_speed(uint32_t const* table, int width, int height)
+{
+    unsigned char* src = (unsigned char*)malloc(width * height);
+    uint32_t* dst = (uint32_t*)malloc(width * height * 4);
+    uint32_t seed = 3;
+
+    if (src == NULL || dst == NULL) {
+        free(src);
+        free(dst);
+        return 1;
+    }
+
+    for (int index = 0; index < width * height; index++) {
+        src[index] = Test_Random(seed, 256);
+    }
+
+    /*
+    **	Touch the output first, so that neither version pays for faulting its pages in.
+    */
+    memset(dst, 0, width * height * 4);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < TEST_REPEATS; repeat++) {
+        Palette_Expand_Scalar(table, src, width, dst, width * 4, width, height);
+    }
+    auto scalar = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (int repeat = 0; repeat < TEST_REPEATS; repeat++) {
+        Palette_Expand(table, src, width, dst, width * 4, width, height);
+    }
+    auto kernel = std::chrono::steady_clock::now() - start;
+
+    printf("Palette_Expand %dx%d: scalar %d us, %s %d us",
+           width,
+           height,
+           (int)(std::chrono::duration_cast<std::chrono::microseconds>(scalar).count() / TEST_REPEATS),
+           Palette_Expand_Kernel(),
+           (int)(std::chrono::duration_cast<std::chrono::microseconds>(kernel).count() / TEST_REPEATS));
+
+#ifdef SDL2_BUILD
+    /*
+    **	The same conversion through SDL, as the SDL2 video backend used to do it.
+    */
+    SDL_Surface* from = SDL_CreateRGBSurfaceWithFormatFrom(src, width, height, 8, width, SDL_PIXELFORMAT_INDEX8);
+    SDL_Surface* to = SDL_CreateRGBSurfaceWithFormatFrom(dst, width, height, 32, width * 4, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Palette* palette = SDL_AllocPalette(256);
+
+    if (from != NULL && to != NULL && palette != NULL) {
+        SDL_SetSurfacePalette(from, palette);
+
+        start = std::chrono::steady_clock::now();
+        for (int repeat = 0; repeat < TEST_REPEATS; repeat++) {
+            SDL_BlitSurface(from, NULL, to, NULL);
+        }
+        auto sdl = std::chrono::steady_clock::now() - start;
+
+        printf(", SDL_BlitSurface %d us",
+               (int)(std::chrono::duration_cast<std::chrono::microseconds>(sdl).count() / TEST_REPEATS));
+    }
+
+    SDL_FreePalette(palette);
+    SDL_FreeSurface(to);
+    SDL_FreeSurface(from);
+#endif
+    printf("\n");
+
+    free(src);
+    free(dst);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    static uint32_t table[256];
+    uint32_t seed = 1;
+    int ret = 0;
+
+    for (int index = 0; index < 256; index++) {
+        table[index] = Test_Random(seed, 0x1000000) | 0xFF000000;
+    }
+
+    ret |= test_palexpand_match(table);
+    ret |= test_palexpand_speed(table, 640, 400);
+    ret |= test_palexpand_speed(table, 1280, 800);
+    ret |= test_palexpand_speed(table, 1920, 1200);
+    ret |= test_palexpand_speed(table, 2560, 1600);
+
+    return ret;
+}
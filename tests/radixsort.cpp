@@ -0,0 +1,73 @@
+#include "common/radixsort.h"
+
+#include <stdio.h>
+#include <stdint.h>
+
+/*
+**	Keys shaped like the coordinates LayerClass sorts: a cell and lepton in each 16 bit half,
+**	with many objects sharing a row and some sharing a coordinate.
+*/
+static unsigned Test_Key(uint32_t& seed, int spread)
+{
+    seed = seed * 1103515245 + 12345;
+    unsigned y = (seed >> 8) % spread;
+    seed = seed * 1103515245 + 12345;
+    unsigned x = (seed >> 8) % spread;
+    return ((y << 24) | (0x80 << 16) | (x << 8) | 0x80);
+}
+
+int test_radix_sort(int count, int spread, uint32_t expected)
+{
+    static unsigned keys[1000];
+    static void* items[1000];
+    static unsigned keytemp[1000];
+    static void* itemtemp[1000];
+    static int slots[1000];
+
+    int ret = 0;
+    uint32_t seed = (uint32_t)count;
+    for (int i = 0; i < count; i++) {
+        keys[i] = Test_Key(seed, spread);
+        items[i] = &slots[i];
+    }
+
+    Radix_Sort(keys, items, count, keytemp, itemtemp);
+
+    /*
+    **	The keys must be in order, equal keys must keep their original order and the
+    **	resulting order must match the one recorded, whatever the platform.
+    */
+    uint32_t hash = 2166136261U;
+    for (int i = 0; i < count; i++) {
+        int slot = (int)((int*)items[i] - slots);
+        if (i > 0) {
+            int prev = (int)((int*)items[i - 1] - slots);
+            if (keys[i] < keys[i - 1] || (keys[i] == keys[i - 1] && slot < prev)) {
+                fprintf(stderr, "Radix_Sort(%d, %d) out of order at %d\n", count, spread, i);
+                ret = 1;
+                break;
+            }
+        }
+        hash = (hash ^ (uint32_t)slot) * 16777619U;
+    }
+
+    if (hash != expected) {
+        fprintf(stderr, "Radix_Sort(%d, %d) -> order %08x, expected %08x\n", count, spread, hash, expected);
+        ret = 1;
+    }
+
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_radix_sort(1, 4, 0x050c5d1f);
+    ret |= test_radix_sort(2, 4, 0xeb741d64);
+    ret |= test_radix_sort(100, 4, 0x60904bf1);
+    ret |= test_radix_sort(500, 64, 0xd061c7b1);
+    ret |= test_radix_sort(1000, 128, 0x2b6d63df);
+
+    return ret;
+}
@@ -0,0 +1,197 @@
+#include "common/rawfile.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+enum
+{
+    TEST_SIZE = 300000,
+    TEST_BIAS_START = 1000,
+    TEST_BIAS_LENGTH = 200000
+};
+
+static unsigned char Data[TEST_SIZE];
+static unsigned char Buffer[TEST_SIZE];
+
+static const char* TestName = "test_rawfile.tmp";
+
+static uint32_t Test_Random(uint32_t& seed, unsigned range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) % range);
+}
+
+static bool Write_Test_File(void)
+{
+    uint32_t seed = 1;
+    for (int index = 0; index < TEST_SIZE; index++) {
+        Data[index] = Test_Random(seed, 256);
+    }
+
+    FILE* fp = fopen(TestName, "wb");
+    if (fp == NULL) {
+        fprintf(stderr, "RawFileClass: can't create %s\n", TestName);
+        return false;
+    }
+    bool ok = fwrite(Data, 1, TEST_SIZE, fp) == TEST_SIZE;
+    fclose(fp);
+    return ok;
+}
+
+/*
+**	Reads the whole file in small pieces, the way INI loading does (pieces of up to size
+**	bytes) or music streaming does (pieces of exactly size bytes).
+*/
+static int Read_Stream(int size, bool fixed, long long& reads)
+{
+    RawFileClass file(TestName);
+    if (!file.Open(READ)) {
+        fprintf(stderr, "RawFileClass: can't open %s\n", TestName);
+        return 1;
+    }
+
+    long long before = RawFileClass::Stats.Reads;
+    uint32_t seed = 2;
+    int pos = 0;
+    while (pos < TEST_SIZE) {
+        int length = fixed ? size : 1 + Test_Random(seed, size);
+        int count = file.Read(Buffer + pos, length);
+        if (count != (length < TEST_SIZE - pos ? length : TEST_SIZE - pos)) {
+            fprintf(stderr,
+                    "RawFileClass(%d) read %d bytes at %d, expected %d\n",
+                    RawFileClass::ReadAheadWindow,
+                    count,
+                    pos,
+                    length);
+            return 1;
+        }
+        pos += count;
+    }
+    reads = RawFileClass::Stats.Reads - before;
+
+    if (file.Read(Buffer, 1) != 0 || memcmp(Buffer, Data, TEST_SIZE) != 0) {
+        fprintf(stderr, "RawFileClass(%d) read the wrong data\n", RawFileClass::ReadAheadWindow);
+        return 1;
+    }
+    return 0;
+}
+
+/*
+**	Reads a biased part of the file the way a VQA is played from a mixfile: a chunk header,
+**	then the chunk or a seek past it, with the odd seek back to look at a header again.
+*/
+static int Read_Chunks(long long& reads, long long& seeks)
+{
+    RawFileClass file(TestName);
+    if (!file.Open(READ)) {
+        fprintf(stderr, "RawFileClass: can't open %s\n", TestName);
+        return 1;
+    }
+    file.Bias(TEST_BIAS_START, TEST_BIAS_LENGTH);
+
+    long long before = RawFileClass::Stats.Reads;
+    long long beforeseeks = RawFileClass::Stats.Seeks;
+    uint32_t seed = 3;
+    int pos = 0;
+    while (pos < TEST_BIAS_LENGTH) {
+        unsigned char header[8];
+        int count = file.Read(header, sizeof(header));
+        int expected = sizeof(header) < TEST_BIAS_LENGTH - pos ? sizeof(header) : TEST_BIAS_LENGTH - pos;
+        if (count != expected || memcmp(header, Data + TEST_BIAS_START + pos, count) != 0) {
+            fprintf(stderr, "RawFileClass(%d) read a bad header at %d\n", RawFileClass::ReadAheadWindow, pos);
+            return 1;
+        }
+        pos += count;
+
+        int size = Test_Random(seed, 6000);
+        switch (Test_Random(seed, 8)) {
+        case 0:
+            pos = file.Seek(size, SEEK_CUR);
+            break;
+
+        case 1:
+            pos = file.Seek(pos - sizeof(header), SEEK_SET);
+            break;
+
+        default:
+            count = file.Read(Buffer, size);
+            expected = size < TEST_BIAS_LENGTH - pos ? size : TEST_BIAS_LENGTH - pos;
+            if (count != expected || memcmp(Buffer, Data + TEST_BIAS_START + pos, count) != 0) {
+                fprintf(stderr, "RawFileClass(%d) read a bad chunk at %d\n", RawFileClass::ReadAheadWindow, pos);
+                return 1;
+            }
+            pos += count;
+            break;
+        }
+
+        if (file.Seek(0) != pos) {
+            fprintf(stderr,
+                    "RawFileClass(%d) is at %d, expected %d\n",
+                    RawFileClass::ReadAheadWindow,
+                    file.Seek(0),
+                    pos);
+            return 1;
+        }
+    }
+    reads = RawFileClass::Stats.Reads - before;
+    seeks = RawFileClass::Stats.Seeks - beforeseeks;
+    return 0;
+}
+
+/*
+**	Checks that read-ahead returns the same data as reading straight from the file, and
+**	that it needs far fewer low level reads to do it.
+*/
+int test_read_ahead(void)
+{
+    int ret = 0;
+    long long direct = 0;
+    long long ahead = 0;
+    long long directmusic = 0;
+    long long aheadmusic = 0;
+    long long directchunks = 0;
+    long long aheadchunks = 0;
+    long long directseeks = 0;
+    long long aheadseeks = 0;
+
+    RawFileClass::ReadAheadWindow = 0;
+    ret |= Read_Stream(4096, false, direct);
+    ret |= Read_Stream(8192 + 128, true, directmusic);
+    ret |= Read_Chunks(directchunks, directseeks);
+
+    RawFileClass::ReadAheadWindow = 0x8000;
+    ret |= Read_Stream(4096, false, ahead);
+    ret |= Read_Stream(8192 + 128, true, aheadmusic);
+    ret |= Read_Chunks(aheadchunks, aheadseeks);
+
+    printf("RawFileClass: stream %lld reads direct, %lld with read-ahead\n", direct, ahead);
+    printf("RawFileClass: music %lld reads direct, %lld with read-ahead\n", directmusic, aheadmusic);
+    printf("RawFileClass: chunks %lld reads %lld seeks direct, %lld reads %lld seeks with read-ahead\n",
+           directchunks,
+           directseeks,
+           aheadchunks,
+           aheadseeks);
+
+    if (ret == 0
+        && (ahead * 4 > direct || aheadmusic * 3 > directmusic
+            || aheadchunks + aheadseeks >= directchunks + directseeks)) {
+        fprintf(stderr, "RawFileClass: read-ahead didn't cut the number of low level operations\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    if (!Write_Test_File()) {
+        return 1;
+    }
+
+    ret |= test_read_ahead();
+
+    remove(TestName);
+    return ret;
+}
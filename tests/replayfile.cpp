@@ -0,0 +1,276 @@
+#include "common/replayfile.h"
+#include "common/rawfile.h"
+#include "common/xpipe.h"
+#include "common/xstraw.h"
+#include "common/lcwpipe.h"
+#include "common/lcwstraw.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+enum
+{
+    TEST_BLOCKS = 12,
+    TEST_MAX_SIZE = 20000,
+    TEST_LCW_SIZE = 0x2000,
+    TEST_VALUES = 0x12345678
+};
+
+/*
+**	What each block was written with, and where it ended up in the file.
+*/
+struct TestBlock
+{
+    int Type;
+    int Frame;
+    int Size;
+    int Offset;
+    int End;
+    unsigned char Data[TEST_MAX_SIZE];
+};
+
+static TestBlock Blocks[TEST_BLOCKS];
+static unsigned char Buffer[TEST_MAX_SIZE];
+static unsigned char Copy[TEST_BLOCKS * TEST_MAX_SIZE * 2];
+
+static const char* TestName = "test_replayfile.tmp";
+static const char* CutName = "test_replayfile_cut.tmp";
+
+static unsigned Test_Random(uint32_t& seed, unsigned range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) % range);
+}
+
+/*
+**	Writes a recording of frame blocks with a keyframe block every fourth block, as the game
+**	does. The data is short runs of random values, which compress about as well as the
+**	game's own frame data. Only a closed recording gets its index and trailer.
+*/
+static bool Write_Test_File(bool closed)
+{
+    RawFileClass file(TestName);
+    ReplayFileClass replay;
+    uint32_t seed = 1;
+    int values = TEST_VALUES;
+
+    if (!file.Open(WRITE)) {
+        fprintf(stderr, "ReplayFileClass: can't create %s\n", TestName);
+        return false;
+    }
+    replay.Open(&file);
+    replay.Write_Header();
+    file.Write(&values, sizeof(values));
+
+    for (int index = 0; index < TEST_BLOCKS; index++) {
+        TestBlock& block = Blocks[index];
+
+        block.Type = (index % 4) == 0 ? ReplayFileClass::BLOCK_KEYFRAME : ReplayFileClass::BLOCK_FRAMES;
+        block.Frame = index * 30;
+        block.Size = 1 + Test_Random(seed, TEST_MAX_SIZE);
+        for (int pos = 0; pos < block.Size;) {
+            unsigned char value = Test_Random(seed, 256);
+            for (int run = 1 + Test_Random(seed, 8); run > 0 && pos < block.Size; run--) {
+                block.Data[pos++] = value;
+            }
+        }
+
+        block.Offset = replay.Begin_Block();
+        {
+            FilePipe fpipe(&file);
+            LCWPipe pipe(LCWPipe::COMPRESS, TEST_LCW_SIZE);
+            pipe.Put_To(fpipe);
+            pipe.Put(block.Data, block.Size);
+            pipe.Flush();
+        }
+        replay.End_Block(block.Offset, block.Type, block.Frame, block.Size);
+        block.End = file.Seek(0, SEEK_CUR);
+    }
+
+    if (closed) {
+        replay.Write_Index(TEST_BLOCKS * 30);
+    }
+    replay.Close();
+    file.Close();
+    return true;
+}
+
+/*
+**	Makes a copy of the test file cut short at the length given.
+*/
+static bool Cut_Test_File(int length)
+{
+    RawFileClass file(TestName);
+    RawFileClass cut(CutName);
+
+    if (!file.Open(READ) || file.Read(Copy, length) != length || !cut.Open(WRITE)) {
+        fprintf(stderr, "ReplayFileClass: can't cut %s to %d bytes\n", TestName, length);
+        return false;
+    }
+    bool ok = cut.Write(Copy, length) == length;
+    cut.Close();
+    return ok;
+}
+
+static int File_Size(const char* name)
+{
+    RawFileClass file(name);
+    return file.Size();
+}
+
+/*
+**	Reads a recording back the way playback does: the header, the index, every frame block in
+**	turn and every keyframe through the index. The first 'complete' blocks must all be found
+**	with the data they were written with, and nothing after them.
+*/
+static int Check_Test_File(const char* name, int complete, const char* what)
+{
+    RawFileClass file(name);
+    ReplayFileClass replay;
+    ReplayFileClass::BlockHeader header;
+    int values = 0;
+
+    if (!file.Open(READ)) {
+        fprintf(stderr, "ReplayFileClass: can't open %s\n", name);
+        return 1;
+    }
+    replay.Open(&file);
+    if (!replay.Read_Header() || file.Read(&values, sizeof(values)) != sizeof(values) || values != TEST_VALUES) {
+        fprintf(stderr, "ReplayFileClass: %s has a bad header\n", what);
+        return 1;
+    }
+    int start = file.Seek(0, SEEK_CUR);
+
+    replay.Read_Index();
+    if (replay.Count() != complete || file.Seek(0, SEEK_CUR) != start) {
+        fprintf(stderr, "ReplayFileClass: %s has %d blocks, expected %d\n", what, replay.Count(), complete);
+        return 1;
+    }
+    for (int index = 0; index < complete; index++) {
+        if (replay[index].Type != Blocks[index].Type || replay[index].Frame != Blocks[index].Frame
+            || replay[index].Offset != Blocks[index].Offset) {
+            fprintf(stderr, "ReplayFileClass: %s has a bad index entry %d\n", what, index);
+            return 1;
+        }
+    }
+
+    for (int index = 0; index < complete; index++) {
+        if (!replay.Next_Block(header) || header.Type != Blocks[index].Type || header.Size != Blocks[index].Size
+            || header.Length != Blocks[index].End - Blocks[index].Offset - (int)sizeof(header)) {
+            fprintf(stderr, "ReplayFileClass: %s has a bad header for block %d\n", what, index);
+            return 1;
+        }
+
+        int end = file.Seek(0, SEEK_CUR) + header.Length;
+        FileStraw fstraw(&file);
+        LCWStraw straw(LCWStraw::DECOMPRESS, TEST_LCW_SIZE);
+        straw.Get_From(fstraw);
+        if (straw.Get(Buffer, header.Size) != header.Size || memcmp(Buffer, Blocks[index].Data, header.Size) != 0) {
+            fprintf(stderr, "ReplayFileClass: %s has bad data in block %d\n", what, index);
+            return 1;
+        }
+        file.Seek(end, SEEK_SET);
+    }
+    if (replay.Next_Block(header)) {
+        fprintf(stderr, "ReplayFileClass: %s has a block after the last complete one\n", what);
+        return 1;
+    }
+
+    for (int index = 0; index < complete; index++) {
+        bool keyframe = replay.Read_Block(replay[index], ReplayFileClass::BLOCK_KEYFRAME, header);
+        if (keyframe != (Blocks[index].Type == ReplayFileClass::BLOCK_KEYFRAME)) {
+            fprintf(stderr, "ReplayFileClass: %s found the wrong block type at block %d\n", what, index);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*
+**	A closed recording is read back through its index.
+*/
+int test_replayfile_closed(void)
+{
+    if (!Write_Test_File(true)) {
+        return 1;
+    }
+    return Check_Test_File(TestName, TEST_BLOCKS, "a closed recording");
+}
+
+/*
+**	A recording that was never closed has no index, so its blocks are found by scanning.
+*/
+int test_replayfile_unclosed(void)
+{
+    if (!Write_Test_File(false)) {
+        return 1;
+    }
+    return Check_Test_File(TestName, TEST_BLOCKS, "an unclosed recording");
+}
+
+/*
+**	A recording cut short anywhere is read up to its last complete block. A cut in the index or
+**	trailer loses the trailer but none of the blocks. A block cut short can't be read, even
+**	through an index entry that was kept for it.
+*/
+int test_replayfile_truncated(void)
+{
+    char what[64];
+    int ret = 0;
+
+    if (!Write_Test_File(true)) {
+        return 1;
+    }
+    int size = File_Size(TestName);
+    int last = Blocks[TEST_BLOCKS - 1].End;
+
+    int cuts[] = {size - 1, last + 10, last, last - 1, Blocks[5].Offset + 20, Blocks[3].End, Blocks[0].Offset + 2};
+    for (int index = 0; index < (int)(sizeof(cuts) / sizeof(cuts[0])); index++) {
+        int complete = 0;
+        while (complete < TEST_BLOCKS && Blocks[complete].End <= cuts[index]) {
+            complete++;
+        }
+
+        if (!Cut_Test_File(cuts[index])) {
+            return 1;
+        }
+        snprintf(what, sizeof(what), "a recording cut to %d of %d bytes", cuts[index], size);
+        ret |= Check_Test_File(CutName, complete, what);
+    }
+
+    /*
+    **	A keyframe in the index whose data was cut off.
+    */
+    if (!Cut_Test_File(Blocks[4].End - 1)) {
+        return 1;
+    }
+    RawFileClass file(CutName);
+    ReplayFileClass replay;
+    ReplayFileClass::IndexEntry entry;
+    ReplayFileClass::BlockHeader header;
+
+    entry.Type = Blocks[4].Type;
+    entry.Frame = Blocks[4].Frame;
+    entry.Offset = Blocks[4].Offset;
+    file.Open(READ);
+    replay.Open(&file);
+    if (replay.Read_Block(entry, ReplayFileClass::BLOCK_KEYFRAME, header)) {
+        fprintf(stderr, "ReplayFileClass: a keyframe cut short was read\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_replayfile_closed();
+    ret |= test_replayfile_unclosed();
+    ret |= test_replayfile_truncated();
+
+    remove(TestName);
+    remove(CutName);
+    return ret;
+}
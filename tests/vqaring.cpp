@@ -0,0 +1,167 @@
+#include "common/vqaring.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <chrono>
+#include <thread>
+
+enum
+{
+    TEST_SLOTS = 4,
+    TEST_WIDTH = 32,
+    TEST_HEIGHT = 16,
+    TEST_FRAMES = 300
+};
+
+/*
+**	Writes every frame into the ring, with its frame number in every pixel and a palette on
+**	every tenth frame, then marks the end.
+*/
+static void Test_Decoder(VQAFrameRingClass* ring)
+{
+    int framenum = 0;
+
+    while (framenum < TEST_FRAMES) {
+        VQADecodedFrame* frame = ring->Begin_Write(2);
+        if (frame == nullptr) {
+            if (ring->Is_Stopped()) {
+                return;
+            }
+            continue;
+        }
+
+        memset(frame->Image, framenum & 0xFF, TEST_WIDTH * TEST_HEIGHT);
+        frame->PaletteSize = 0;
+        if ((framenum % 10) == 0) {
+            memset(frame->Palette, framenum & 0xFF, sizeof(frame->Palette));
+            frame->PaletteSize = sizeof(frame->Palette);
+        }
+        frame->FrameNum = framenum;
+        frame->IsKey = false;
+        ring->End_Write();
+
+        if ((framenum % 50) == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        framenum++;
+    }
+    ring->Finish();
+}
+
+/*
+**	Every frame comes out once and in order with its own image and palette, whether the
+**	display keeps up or drops frames to catch up.
+*/
+int test_vqaring_order(bool drop)
+{
+    VQAFrameRingClass ring;
+
+    if (!ring.Init(TEST_SLOTS, TEST_WIDTH * TEST_HEIGHT)) {
+        fprintf(stderr, "VQAFrameRingClass failed to allocate\n");
+        return 1;
+    }
+
+    std::thread decoder(Test_Decoder, &ring);
+
+    int expected = 0;
+    int shown = 0;
+    int dropped = 0;
+    int ret = 0;
+
+    while (expected < TEST_FRAMES && ret == 0) {
+        VQADecodedFrame* frame = ring.Peek();
+        if (frame == nullptr) {
+            if (ring.Is_Finished() && ring.Count() == 0) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+
+        if (frame->FrameNum != expected) {
+            fprintf(stderr, "VQAFrameRingClass gave frame %d, expected %d\n", frame->FrameNum, expected);
+            ret = 1;
+            break;
+        }
+
+        bool bad = frame->Image[0] != (expected & 0xFF)
+                   || frame->Image[TEST_WIDTH * TEST_HEIGHT - 1] != (expected & 0xFF);
+        if ((expected % 10) == 0) {
+            bad |= frame->PaletteSize != sizeof(frame->Palette) || frame->Palette[767] != (expected & 0xFF);
+        } else {
+            bad |= frame->PaletteSize != 0;
+        }
+        if (bad) {
+            fprintf(stderr, "VQAFrameRingClass frame %d has the wrong image or palette\n", expected);
+            ret = 1;
+            break;
+        }
+
+        /*
+        **	Drop every frame that has a newer one behind it, the way a display that has fallen
+        **	behind would.
+        */
+        if (drop && ring.Peek(1) != nullptr) {
+            dropped++;
+        } else {
+            shown++;
+        }
+        ring.Release();
+        expected++;
+    }
+
+    ring.Stop();
+    decoder.join();
+
+    if (ret == 0 && (expected != TEST_FRAMES || shown + dropped != TEST_FRAMES)) {
+        fprintf(stderr, "VQAFrameRingClass gave %d frames, expected %d\n", expected, TEST_FRAMES);
+        ret = 1;
+    }
+    return ret;
+}
+
+/*
+**	Stopping the ring wakes a decoder waiting on a full ring, and Start lets it carry on
+**	with the frames it already wrote still in place.
+*/
+int test_vqaring_stop(void)
+{
+    VQAFrameRingClass ring;
+
+    if (!ring.Init(TEST_SLOTS, TEST_WIDTH * TEST_HEIGHT)) {
+        fprintf(stderr, "VQAFrameRingClass failed to allocate\n");
+        return 1;
+    }
+
+    std::thread decoder(Test_Decoder, &ring);
+    while (ring.Count() < TEST_SLOTS) {
+        std::this_thread::yield();
+    }
+    ring.Stop();
+    decoder.join();
+
+    if (ring.Count() != TEST_SLOTS || ring.Is_Finished() || ring.Begin_Write(0) != nullptr) {
+        fprintf(stderr, "VQAFrameRingClass lost frames or accepted one when stopped\n");
+        return 1;
+    }
+
+    ring.Start();
+    ring.Release();
+    VQADecodedFrame* frame = ring.Begin_Write(0);
+    if (frame == nullptr || ring.Peek()->FrameNum != 1) {
+        fprintf(stderr, "VQAFrameRingClass didn't accept a frame after Start\n");
+        return 1;
+    }
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_vqaring_order(false);
+    ret |= test_vqaring_order(true);
+    ret |= test_vqaring_stop();
+
+    return ret;
+}
@@ -0,0 +1,116 @@
+#include "common/worker.h"
+
+#include <stdio.h>
+#include <chrono>
+
+enum
+{
+    TEST_JOBS = 200
+};
+
+struct TestJob
+{
+    int Index;
+    int* Next;
+    int Order;
+};
+
+/*
+**	Notes where in the run order this job came, and takes a little while so that the
+**	submitting thread gets ahead of it.
+*/
+static void Test_Job(void* data)
+{
+    TestJob* job = (TestJob*)data;
+
+    if ((job->Index % 10) == 0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    job->Order = (*job->Next)++;
+}
+
+/*
+**	Every job runs exactly once, in the order it was submitted, and is finished once Wait()
+**	returns.
+*/
+int test_worker_order(void)
+{
+    static TestJob jobs[TEST_JOBS];
+    WorkerClass worker;
+    int next = 0;
+
+    if (worker.Is_Busy()) {
+        fprintf(stderr, "WorkerClass busy before any job was submitted\n");
+        return 1;
+    }
+
+    for (int index = 0; index < TEST_JOBS; index++) {
+        jobs[index].Index = index;
+        jobs[index].Next = &next;
+        jobs[index].Order = -1;
+        worker.Submit(Test_Job, &jobs[index]);
+    }
+    worker.Wait();
+
+    if (worker.Is_Busy()) {
+        fprintf(stderr, "WorkerClass busy after Wait()\n");
+        return 1;
+    }
+
+    if (next != TEST_JOBS) {
+        fprintf(stderr, "WorkerClass ran %d jobs, expected %d\n", next, TEST_JOBS);
+        return 1;
+    }
+
+    for (int index = 0; index < TEST_JOBS; index++) {
+        if (jobs[index].Order != index) {
+            fprintf(stderr, "WorkerClass ran job %d as number %d\n", index, jobs[index].Order);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+/*
+**	A worker that is destroyed with a job outstanding finishes it first.
+*/
+int test_worker_destroy(void)
+{
+    TestJob job;
+    int next = 0;
+
+    job.Index = 0;
+    job.Next = &next;
+    job.Order = -1;
+
+    {
+        WorkerClass worker;
+        worker.Submit(Test_Job, &job);
+    }
+
+    if (job.Order != 0) {
+        fprintf(stderr, "WorkerClass destroyed without running its job\n");
+        return 1;
+    }
+
+    /*
+    **	One that never ran anything has no thread to stop.
+    */
+    {
+        WorkerClass worker;
+        worker.Wait();
+    }
+
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_worker_order();
+    ret |= test_worker_destroy();
+
+    return ret;
+}
@@ -0,0 +1,293 @@
+#include "common/zoneupdate.h"
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+
+/*
+**	A map laid out as Red Alert's is: a square grid of cells with the playable area inside it,
+**	cells numbered row by row.
+*/
+enum
+{
+    TEST_GRID = 48,
+    TEST_X = 1,
+    TEST_Y = 2,
+    TEST_WIDTH = 45,
+    TEST_HEIGHT = 43,
+    TEST_CELLS = TEST_GRID * TEST_GRID,
+    TEST_EDITS = 4000
+};
+
+struct TestMap
+{
+    bool Passable[TEST_CELLS];
+    unsigned char Zones[TEST_CELLS];
+
+    int Cells(void) const
+    {
+        return TEST_CELLS;
+    }
+
+    int X(int cell) const
+    {
+        return cell % TEST_GRID;
+    }
+
+    int Y(int cell) const
+    {
+        return cell / TEST_GRID;
+    }
+
+    int XY(int x, int y) const
+    {
+        return y * TEST_GRID + x;
+    }
+
+    bool Inside(int x, int y) const
+    {
+        return (y >= TEST_Y && y < TEST_Y + TEST_HEIGHT && x >= TEST_X && x < TEST_X + TEST_WIDTH);
+    }
+
+    bool Clear(int cell) const
+    {
+        return Inside(X(cell), Y(cell)) && Passable[cell];
+    }
+
+    unsigned char& Zone(int cell)
+    {
+        return Zones[cell];
+    }
+};
+
+static TestMap Map;
+static TestMap Fresh;
+
+static unsigned Test_Random(uint32_t& seed, unsigned range)
+{
+    seed = seed * 1103515245 + 12345;
+    return ((seed >> 8) % range);
+}
+
+static bool Test_Inside(int x, int y)
+{
+    return (y >= TEST_Y && y < TEST_Y + TEST_HEIGHT && x >= TEST_X && x < TEST_X + TEST_WIDTH);
+}
+
+/*
+**	A cut down copy of MapClass::Zone_Span, the scanline flood fill that Zone_Reset makes.
+*/
+static int Test_Span(TestMap& map, int x, int y, int zone)
+{
+    int filled = 0;
+    int xbegin = x;
+    int xend = x;
+
+    if (!Test_Inside(x, y) || map.Zones[y * TEST_GRID + x] != 0 || !map.Passable[y * TEST_GRID + x]) {
+        return 0;
+    }
+
+    while (xbegin - 1 >= TEST_X && map.Zones[y * TEST_GRID + xbegin - 1] == 0
+           && map.Passable[y * TEST_GRID + xbegin - 1]) {
+        xbegin--;
+    }
+    while (xend + 1 < TEST_X + TEST_WIDTH && map.Zones[y * TEST_GRID + xend + 1] == 0
+           && map.Passable[y * TEST_GRID + xend + 1]) {
+        xend++;
+    }
+
+    for (int index = xbegin; index <= xend; index++) {
+        map.Zones[y * TEST_GRID + index] = zone;
+        filled++;
+    }
+
+    for (int index = xbegin - 1; index <= xend; index++) {
+        filled += Test_Span(map, index, y - 1, zone);
+        filled += Test_Span(map, index, y + 1, zone);
+    }
+    return filled;
+}
+
+/*
+**	As Zone_Reset: fills every zone from scratch, starting each from the first cell not yet in
+**	one. Returns true if it ran out of zone numbers.
+*/
+static bool Test_Reset(TestMap& map)
+{
+    int zone = 1;
+
+    memset(map.Zones, 0, sizeof(map.Zones));
+    for (int y = 0; y < TEST_GRID; y++) {
+        for (int x = 0; x < TEST_GRID; x++) {
+            if (Test_Span(map, x, y, zone)) {
+                zone++;
+            }
+        }
+    }
+    return zone > 256;
+}
+
+/*
+**	Two cells touching at a corner share a zone when the lower one is down and to the left of
+**	the upper one, but not when it is down and to the right. The update must keep to this.
+*/
+int test_zoneupdate_corners(void)
+{
+    ZoneUpdateClass<TestMap> update;
+    int ret = 0;
+    int a = TEST_Y * TEST_GRID + TEST_X;
+    int b = a + TEST_GRID + 1;
+    int c = a + 5;
+    int d = c + TEST_GRID - 1;
+
+    memset(Map.Passable, 0, sizeof(Map.Passable));
+    Map.Passable[a] = Map.Passable[b] = Map.Passable[c] = Map.Passable[d] = true;
+
+    update.Recount(Map, Test_Reset(Map));
+    if (Map.Zones[a] == Map.Zones[b] || Map.Zones[c] != Map.Zones[d]) {
+        fprintf(stderr, "Zone_Span didn't join cells across a corner as it always has\n");
+        ret = 1;
+    }
+
+    for (int cell = 0; cell < 4; cell++) {
+        int here = (cell == 0) ? a : (cell == 1) ? b : (cell == 2) ? c : d;
+
+        Map.Passable[here] = false;
+        update.Changed(Map, here);
+        update.Update(Map);
+        Map.Passable[here] = true;
+        update.Changed(Map, here);
+        update.Update(Map);
+
+        memcpy(Fresh.Passable, Map.Passable, sizeof(Fresh.Passable));
+        Test_Reset(Fresh);
+        if (memcmp(Map.Zones, Fresh.Zones, sizeof(Map.Zones)) != 0) {
+            fprintf(stderr, "ZoneUpdateClass didn't join cells across a corner as Zone_Span does\n");
+            ret = 1;
+        }
+    }
+    return ret;
+}
+
+/*
+**	Once a fill runs out of zone numbers, only another full fill will do.
+*/
+int test_zoneupdate_overflow(void)
+{
+    ZoneUpdateClass<TestMap> update;
+    int ret = 0;
+
+    memset(Map.Passable, 0, sizeof(Map.Passable));
+    for (int y = TEST_Y; y < TEST_Y + TEST_HEIGHT; y += 2) {
+        for (int x = TEST_X; x < TEST_X + TEST_WIDTH; x += 2) {
+            Map.Passable[y * TEST_GRID + x] = true;
+        }
+    }
+    update.Recount(Map, Test_Reset(Map));
+    if (!update.Is_Overflow()) {
+        fprintf(stderr, "ZoneUpdateClass didn't see the fill run out of zones\n");
+        ret = 1;
+    }
+
+    int cell = TEST_Y * TEST_GRID + TEST_X + 1;
+    Map.Passable[cell] = true;
+    update.Changed(Map, cell);
+    if (update.Update(Map)) {
+        fprintf(stderr, "ZoneUpdateClass updated zones that had run out\n");
+        ret = 1;
+    }
+
+    for (int y = TEST_Y; y < TEST_Y + TEST_HEIGHT; y += 2) {
+        for (int x = TEST_X; x < TEST_X + TEST_WIDTH; x++) {
+            Map.Passable[y * TEST_GRID + x] = true;
+        }
+    }
+    update.Recount(Map, Test_Reset(Map));
+
+    cell = (TEST_Y + 1) * TEST_GRID + TEST_X;
+    Map.Passable[cell] = true;
+    update.Changed(Map, cell);
+    memcpy(Fresh.Passable, Map.Passable, sizeof(Fresh.Passable));
+    Test_Reset(Fresh);
+    if (!update.Update(Map) || memcmp(Map.Zones, Fresh.Zones, sizeof(Map.Zones)) != 0) {
+        fprintf(stderr, "ZoneUpdateClass didn't update zones after a full fill\n");
+        ret = 1;
+    }
+    return ret;
+}
+
+/*
+**	Random walls built and knocked down, each followed by a check against a fresh fill, just
+**	as -CHECKMAP does in game. Some edits are made in blocks, as a bridge is, and some are only
+**	noted and left for a later update to pick up along with the next edit.
+*/
+int test_zoneupdate_random(int blocked)
+{
+    ZoneUpdateClass<TestMap> update;
+    uint32_t seed = blocked;
+    int resets = 0;
+
+    for (int cell = 0; cell < TEST_CELLS; cell++) {
+        Map.Passable[cell] = Test_Random(seed, 100) >= (unsigned)blocked;
+    }
+    update.Recount(Map, Test_Reset(Map));
+
+    for (int edit = 0; edit < TEST_EDITS; edit++) {
+        int x = TEST_X + Test_Random(seed, TEST_WIDTH);
+        int y = TEST_Y + Test_Random(seed, TEST_HEIGHT);
+
+        if (Test_Random(seed, 8) == 0) {
+            bool passable = Test_Random(seed, 2) != 0;
+            int width = 1 + Test_Random(seed, 4);
+            int height = 1 + Test_Random(seed, 4);
+            for (int row = y; row < y + height && row < TEST_GRID; row++) {
+                for (int column = x; column < x + width && column < TEST_GRID; column++) {
+                    Map.Passable[row * TEST_GRID + column] = passable;
+                    update.Changed(Map, row * TEST_GRID + column);
+                }
+            }
+        } else {
+            int cell = y * TEST_GRID + x;
+            Map.Passable[cell] = !Map.Passable[cell];
+            update.Changed(Map, cell);
+        }
+
+        if (Test_Random(seed, 4) == 0) {
+            continue;
+        }
+
+        memcpy(Fresh.Passable, Map.Passable, sizeof(Fresh.Passable));
+        bool overflow = Test_Reset(Fresh);
+
+        if (!update.Update(Map)) {
+            update.Recount(Map, Test_Reset(Map));
+            resets++;
+            continue;
+        }
+
+        if (overflow) {
+            fprintf(stderr, "ZoneUpdateClass didn't run out of zones after edit %d at %d%% blocked\n", edit, blocked);
+            return 1;
+        }
+        if (memcmp(Map.Zones, Fresh.Zones, sizeof(Map.Zones)) != 0) {
+            fprintf(stderr, "ZoneUpdateClass differs from a fresh fill after edit %d at %d%% blocked\n", edit, blocked);
+            return 1;
+        }
+    }
+
+    printf("ZoneUpdateClass: %d edits at %d%% blocked, %d full fills\n", (int)TEST_EDITS, blocked, resets);
+    return 0;
+}
+
+int main(int argc, char** argv)
+{
+    int ret = 0;
+
+    ret |= test_zoneupdate_corners();
+    ret |= test_zoneupdate_overflow();
+    ret |= test_zoneupdate_random(20);
+    ret |= test_zoneupdate_random(40);
+    ret |= test_zoneupdate_random(55);
+
+    return ret;
+}
@@ -1516,6 +1516,7 @@ static void Sync_Delay(void)
             if (input) {
                 Keyboard_Process(input);
             }
+            Interpolate_Frame();
             Map.Render();
         }
 
@@ -1624,6 +1625,7 @@ bool Main_Loop()
                 Keyboard_Process(input);
             }
             //			HidPage.Lock();
+            Interpolate_Frame();
             Map.Render();
             //			HidPage.Unlock();
         }
@@ -1647,6 +1649,12 @@ bool Main_Loop()
 
     //	Heap_Dump_Check( "Before Logic.AI" );
 
+    /*
+    **	Note where everything is drawn before it moves, so that the frames drawn until the next
+    **	tick can show the moves part way through.
+    */
+    Interpolate_Tick();
+
     /*
     **	AI logic operations are performed here.
     */
@@ -2240,8 +2248,22 @@ void Play_Movie(char const* name, ThemeType theme, bool clrscrn)
                 // Set_Palette(BlackPalette);
                 SysMemPage.Clear();
                 InMovie = true;
+                long long reads = RawFileClass::Stats.Reads;
+                long long seeks = RawFileClass::Stats.Seeks;
                 VQA_Play(vqa, VQAMODE_RUN);
+                VQAStatistics stats;
+                VQA_GetStats(vqa, &stats);
                 VQA_Close(vqa);
+                DBG_INFO("Play_Movie: %s took %lld file reads and %lld seeks.",
+                         fullname,
+                         RawFileClass::Stats.Reads - reads,
+                         RawFileClass::Stats.Seeks - seeks);
+                DBG_INFO("Play_Movie: %s drew %d of %d frames, dropped %d and showed %d late.",
+                         fullname,
+                         stats.FramesDrawn,
+                         stats.FramesLoaded,
+                         stats.FramesSkipped,
+                         stats.FramesLate);
                 // Resume_Audio_Thread();
                 InMovie = false;
                 Free_Interpolated_Palettes();
@@ -37,6 +37,7 @@
 #include "function.h"
 #include <stdarg.h>
 #include "common/filepcx.h"
+#include "common/framelimit.h"
 #ifdef CHEAT_KEYS
 
 extern bool ScreenRecording;
@@ -238,6 +239,17 @@ void Debug_Key(unsigned input)
             PlayerPtr->Flag_To_Lose();
             break;
 
+        /*
+        **	Frame time histograms, to the log or over the screen.
+        */
+        case KN_H:
+            Dump_Frame_Histograms();
+            break;
+
+        case (int)KN_H | (int)KN_ALT_BIT:
+            Toggle_Frame_Overlay();
+            break;
+
         case KN_F:
             Debug_Find_Path ^= 1;
             break;
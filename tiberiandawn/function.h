@@ -552,6 +552,15 @@ int Do_Menu(char const** strings, bool blue);
 extern int UnknownKey;
 int Main_Menu(unsigned int timeout);
 
+/*
+**	MOTION.CPP
+*/
+void Interpolate_Tick(void);
+void Interpolate_Frame(void);
+COORDINATE Interpolated_Coord(ObjectClass const* object, COORDINATE coord);
+void Interpolate_Forget(ObjectClass const* object);
+void Interpolate_Clear(void);
+
 /*
 ** MPLAYER.CPP
 */
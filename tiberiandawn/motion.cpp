@@ -0,0 +1,327 @@
+//
+// Copyright 2020 Electronic Arts Inc.
+//
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is free
+// software: you can redistribute it and/or modify it under the terms of
+// the GNU General Public License as published by the Free Software Foundation,
+// either version 3 of the License, or (at your option) any later version.
+
+// TiberianDawn.DLL and RedAlert.dll and corresponding source code is distributed
+// in the hope that it will be useful, but with permitted additional restrictions
+// under Section 7 of the GPL. See the GNU General Public License in LICENSE.TXT
+// distributed with this program. You should have received a copy of the
+// GNU General Public License along with permitted additional restrictions
+// with this program. If not, see https://github.com/electronicarts/CnC_Remastered_Collection
+
+/***********************************************************************************************
+ *                                                                                             *
+ *                 Project Name : Command & Conquer                                            *
+ *                                                                                             *
+ *                    File Name : MOTION.CPP                                                   *
+ *                                                                                             *
+ *---------------------------------------------------------------------------------------------*
+ * Functions:                                                                                  *
+ *   Interpolate_Clear -- Throws away every record.                                            *
+ *   Interpolate_Forget -- Throws away the record of an object leaving the map.                *
+ *   Interpolate_Frame -- Works out how far between logic ticks the next frame is drawn.       *
+ *   Interpolate_Tick -- Records where the moving objects are before a logic tick.             *
+ *   Interpolated_Coord -- Fetches the coordinate to draw an object at.                        *
+ *   Snapshot_Find -- Finds the record kept for an object of any kind.                         *
+ *   Snapshot_Heap -- Records where the objects of one heap are.                               *
+ *   Snapshot_Moved -- Checks whether anything recorded has moved since.                       *
+ *   Snapshot_Of -- Finds the record kept for an object.                                       *
+ * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+#include "function.h"
+#include "common/framepace.h"
+#include "common/settings.h"
+#include <vector>
+
+/*
+**	Where an object was drawn at the start of the last logic tick. Records are kept apart from
+**	the objects themselves, indexed by heap slot, so that nothing the simulation or the save
+**	games see is changed. A heap slot can be freed and handed to a new object within a tick,
+**	so the pointer alone doesn't tell a record from a stale one; the record is thrown away
+**	when its object leaves the map, which it must do before its slot is freed.
+*/
+struct MotionType
+{
+    ObjectClass const* Object;
+    COORDINATE Coord;
+};
+
+static std::vector<MotionType> UnitMotion;
+static std::vector<MotionType> InfantryMotion;
+static std::vector<MotionType> AircraftMotion;
+static std::vector<MotionType> BulletMotion;
+
+static TickFractionClass MotionTicks;
+
+/*
+**	How far the frame being drawn is from the last tick towards the current one, out of
+**	TickFractionClass::FRACTION_ONE. At FRACTION_ONE everything is drawn where it really is.
+*/
+static int MotionFraction = TickFractionClass::FRACTION_ONE;
+
+/*
+**	An object that moves further than this in one tick has been placed rather than moved
+**	there, and is not slid across the map.
+*/
+#define MOTION_MAX_LEPTONS (CELL_LEPTON_W * 2)
+
+/***********************************************************************************************
+ * Snapshot_Heap -- Records where the objects of one heap are.                                 *
+ *                                                                                             *
+ *    Only objects that are down on the map are recorded. Anything that comes out of limbo     *
+ *    during the tick has no record and so is drawn where it appears.                          *
+ *                                                                                             *
+ * INPUT:   heap  -- The heap of objects to record.                                            *
+ *                                                                                             *
+ *          table -- The records for the heap, indexed by heap slot.                           *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T> static void Snapshot_Heap(TFixedIHeapClass<T>& heap, std::vector<MotionType>& table)
+{
+    MotionType empty = {NULL, 0};
+
+    table.assign(heap.Length(), empty);
+
+    for (int index = 0; index < heap.Count(); index++) {
+        T* object = heap.Ptr(index);
+
+        if (object != NULL && object->IsActive && object->IsDown && !object->IsInLimbo) {
+            MotionType& motion = table[heap.ID(object)];
+            motion.Object = object;
+            motion.Coord = object->Render_Coord();
+        }
+    }
+}
+
+/***********************************************************************************************
+ * Snapshot_Moved -- Checks whether anything recorded has moved since.                         *
+ *                                                                                             *
+ * INPUT:   heap  -- The heap of objects that was recorded.                                    *
+ *                                                                                             *
+ *          table -- The records for the heap.                                                 *
+ *                                                                                             *
+ * OUTPUT:  bool; Is any recorded object now somewhere else?                                   *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T> static bool Snapshot_Moved(TFixedIHeapClass<T>& heap, std::vector<MotionType> const& table)
+{
+    for (int index = 0; index < heap.Count(); index++) {
+        T* object = heap.Ptr(index);
+        int id = heap.ID(object);
+
+        if (id < (int)table.size() && table[id].Object == object && object->IsActive
+            && table[id].Coord != object->Render_Coord()) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+/***********************************************************************************************
+ * Snapshot_Of -- Finds the record kept for an object.                                         *
+ *                                                                                             *
+ * INPUT:   object   -- The object to find the record of.                                      *
+ *                                                                                             *
+ * OUTPUT:  Returns with the record, or NULL if the object wasn't recorded at the last tick.   *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+template <class T>
+static MotionType* Snapshot_Of(TFixedIHeapClass<T>& heap, std::vector<MotionType>& table, ObjectClass const* object)
+{
+    int id = heap.ID((T const*)object);
+
+    if (id >= 0 && id < (int)table.size() && table[id].Object == object) {
+        return (&table[id]);
+    }
+    return (NULL);
+}
+
+/***********************************************************************************************
+ * Snapshot_Find -- Finds the record kept for an object of any kind.                           *
+ *                                                                                             *
+ * INPUT:   object   -- The object to find the record of.                                      *
+ *                                                                                             *
+ * OUTPUT:  Returns with the record, or NULL if the object wasn't recorded at the last tick or *
+ *          isn't of a kind that moves.                                                        *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+static MotionType* Snapshot_Find(ObjectClass const* object)
+{
+    switch (object->What_Am_I()) {
+    case RTTI_UNIT:
+        return (Snapshot_Of(Units, UnitMotion, object));
+
+    case RTTI_INFANTRY:
+        return (Snapshot_Of(Infantry, InfantryMotion, object));
+
+    case RTTI_AIRCRAFT:
+        return (Snapshot_Of(Aircraft, AircraftMotion, object));
+
+    case RTTI_BULLET:
+        return (Snapshot_Of(Bullets, BulletMotion, object));
+
+    default:
+        break;
+    }
+    return (NULL);
+}
+
+/***********************************************************************************************
+ * Interpolate_Tick -- Records where the moving objects are before a logic tick.               *
+ *                                                                                             *
+ *    Called just before Logic.AI, so that the frames drawn while waiting for the next tick    *
+ *    can slide the units, infantry, aircraft and bullets from where they were to where the    *
+ *    tick has put them.                                                                       *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void Interpolate_Tick(void)
+{
+    if (!Settings.Video.MotionInterpolation) {
+        MotionTicks.Reset();
+        MotionFraction = TickFractionClass::FRACTION_ONE;
+        return;
+    }
+
+    Snapshot_Heap(Units, UnitMotion);
+    Snapshot_Heap(Infantry, InfantryMotion);
+    Snapshot_Heap(Aircraft, AircraftMotion);
+    Snapshot_Heap(Bullets, BulletMotion);
+
+    MotionTicks.Tick(TickFractionClass::ClockType::now());
+    MotionFraction = 0;
+}
+
+/***********************************************************************************************
+ * Interpolate_Frame -- Works out how far between logic ticks the next frame is drawn.         *
+ *                                                                                             *
+ *    Called before each Map.Render. When anything recorded has moved and the fraction has     *
+ *    changed since the last frame, the whole tactical view is flagged to be redrawn, the      *
+ *    same as when it is scrolled, since the objects are not drawn where their cells are.      *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void Interpolate_Frame(void)
+{
+    if (!Settings.Video.MotionInterpolation) {
+        MotionFraction = TickFractionClass::FRACTION_ONE;
+        return;
+    }
+
+    int fraction = MotionTicks.Get_Fraction(TickFractionClass::ClockType::now());
+    if (fraction == MotionFraction) {
+        return;
+    }
+    MotionFraction = fraction;
+
+    if (!Snapshot_Moved(Units, UnitMotion) && !Snapshot_Moved(Infantry, InfantryMotion)
+        && !Snapshot_Moved(Aircraft, AircraftMotion) && !Snapshot_Moved(Bullets, BulletMotion)) {
+        return;
+    }
+
+    for (int y = -Coord_YLepton(Map.TacticalCoord); y <= Map.TacLeptonHeight + CELL_LEPTON_H; y += CELL_LEPTON_H) {
+        for (int x = -Coord_XLepton(Map.TacticalCoord); x <= Map.TacLeptonWidth + CELL_LEPTON_W; x += CELL_LEPTON_W) {
+            COORDINATE coord = Coord_Add(Map.TacticalCoord, XY_Coord(x, y));
+            CELL cell = Coord_Cell(coord);
+
+            if (cell >= 0 && cell < MAP_CELL_TOTAL) {
+                Map[cell].Redraw_Objects(true);
+            }
+        }
+    }
+    Map.Flag_To_Redraw(false);
+}
+
+/***********************************************************************************************
+ * Interpolated_Coord -- Fetches the coordinate to draw an object at.                          *
+ *                                                                                             *
+ *    This is part way between where the object was at the last tick and where it is now, by   *
+ *    how far the present time is towards the next tick. It only affects where the object is   *
+ *    drawn.                                                                                   *
+ *                                                                                             *
+ * INPUT:   object   -- The object being drawn.                                                *
+ *                                                                                             *
+ *          coord    -- Its render coordinate.                                                 *
+ *                                                                                             *
+ * OUTPUT:  Returns with the coordinate to draw the object at.                                 *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+COORDINATE Interpolated_Coord(ObjectClass const* object, COORDINATE coord)
+{
+    if (MotionFraction >= TickFractionClass::FRACTION_ONE) {
+        return (coord);
+    }
+
+    MotionType const* motion = Snapshot_Find(object);
+    if (motion == NULL || motion->Coord == coord || Distance(motion->Coord, coord) > MOTION_MAX_LEPTONS) {
+        return (coord);
+    }
+
+    int x = Coord_X(motion->Coord);
+    int y = Coord_Y(motion->Coord);
+    x += (Coord_X(coord) - x) * MotionFraction / TickFractionClass::FRACTION_ONE;
+    y += (Coord_Y(coord) - y) * MotionFraction / TickFractionClass::FRACTION_ONE;
+    return (XY_Coord(x, y));
+}
+
+/***********************************************************************************************
+ * Interpolate_Forget -- Throws away the record of an object leaving the map.                  *
+ *                                                                                             *
+ *    Called when an object is limboed. Its heap slot may be freed and given to another object *
+ *    before the next tick, and that object must not be slid from where this one was.          *
+ *                                                                                             *
+ * INPUT:   object   -- The object leaving the map.                                            *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void Interpolate_Forget(ObjectClass const* object)
+{
+    MotionType* motion = Snapshot_Find(object);
+
+    if (motion != NULL) {
+        motion->Object = NULL;
+    }
+}
+
+/***********************************************************************************************
+ * Interpolate_Clear -- Throws away every record.                                              *
+ *                                                                                             *
+ *    Called when the scenario is cleared, since the objects are then freed without leaving    *
+ *    the map one at a time.                                                                   *
+ *                                                                                             *
+ * INPUT:   none                                                                               *
+ *                                                                                             *
+ * OUTPUT:  none                                                                               *
+ *                                                                                             *
+ * WARNINGS:   none                                                                            *
+ *=============================================================================================*/
+void Interpolate_Clear(void)
+{
+    UnitMotion.clear();
+    InfantryMotion.clear();
+    AircraftMotion.clear();
+    BulletMotion.clear();
+    MotionTicks.Reset();
+    MotionFraction = TickFractionClass::FRACTION_ONE;
+}
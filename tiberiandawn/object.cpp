@@ -955,10 +955,11 @@ bool ObjectClass::Render(bool forced)
             }
         }
 
-        if (Map.Coord_To_Pixel(coord, x, y)) {
+        if (Map.Coord_To_Pixel(Interpolated_Coord(this, coord), x, y)) {
 
             /*
-            **	Draw the object itself
+            **	Draw the object itself, part way along its last move if frames are being drawn
+            **	between logic ticks.
             */
             Draw_It(x, y, WINDOW_TACTICAL);
 
@@ -1162,6 +1163,7 @@ bool ObjectClass::Limbo(void)
         }
 
         Hidden();
+        Interpolate_Forget(this);
         IsInLimbo = true;
         IsToDisplay = false;
         return (true);
@@ -362,6 +362,7 @@ void Clear_Scenario(void)
     Map.Init_Clear();
     Score.Init();
     Logic.Init();
+    Interpolate_Clear();
 
     HouseClass::Init();
     ObjectClass::Init();
@@ -640,4 +640,6 @@ void Read_Setup_Options(RawFileClass* config_file)
     */
     VideoBackBufferAllowed = ini.Get_Bool("Options", "VideoBackBuffer", true);
     AllowHardwareBlitFills = ini.Get_Bool("Options", "HardwareFills", true);
+    MFCD::IsMappingAllowed = ini.Get_Bool("Options", "MapMixFiles", true);
+    RawFileClass::ReadAheadWindow = ini.Get_Int("Options", "ReadAhead", RawFileClass::ReadAheadWindow);
 }
@@ -44,6 +44,10 @@
 **	with the mixfile system.
 */
 template <class T, class TCRC> VanillaList<MixFileClass<T, TCRC>> MixFileClass<T, TCRC>::MixList;
+template <class T, class TCRC> MixIndexClass MixFileClass<T, TCRC>::Index;
+template <class T, class TCRC> bool MixFileClass<T, TCRC>::IsIndexStale = false;
+template <class T, class TCRC> std::mutex MixFileClass<T, TCRC>::ListLock;
+template <class T, class TCRC> bool MixFileClass<T, TCRC>::IsMappingAllowed = true;
 
 void Print_Help()
 {